@@ -0,0 +1,32 @@
+// Opens COUNT keep-alive connections to PORT, sends one request on each and
+// keeps them open without further traffic. Prints `CONNECTED` once all of them
+// got their response.
+import net from "node:net";
+
+const PORT = Number(process.env.PORT);
+const COUNT = Number(process.env.COUNT ?? 1000);
+// Bounded so a large COUNT does not overflow the listen backlog.
+const BATCH = 500;
+
+const request = "GET / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n";
+const sockets = [];
+
+function open() {
+  const { promise, resolve, reject } = Promise.withResolvers();
+  const socket = net.connect(PORT, "127.0.0.1", () => socket.write(request));
+  socket.once("data", () => resolve());
+  socket.once("error", reject);
+  sockets.push(socket);
+  return promise;
+}
+
+for (let opened = 0; opened < COUNT; opened += BATCH) {
+  const batch = [];
+  for (let i = opened; i < Math.min(COUNT, opened + BATCH); i++) batch.push(open());
+  await Promise.all(batch);
+}
+
+console.log("CONNECTED");
+
+// Stay connected until the parent kills us.
+setInterval(() => {}, 1 << 30);
@@ -0,0 +1,47 @@
+// Event loop lag of the socket timeout sweep vs number of idle connections.
+//
+//   bun run.mjs
+//   COUNTS=1000,100000 SECONDS=20 bun run.mjs
+import { spawn } from "node:child_process";
+import { once } from "node:events";
+import { createInterface } from "node:readline";
+
+const BUN = process.env.BUN ?? "bun";
+const COUNTS = (process.env.COUNTS ?? "1000,10000,50000").split(",").map(Number);
+// Three sweeps at the 4 second timeout granularity.
+const SECONDS = Number(process.env.SECONDS ?? 12);
+
+const here = new URL(".", import.meta.url).pathname;
+
+async function waitFor(proc, pattern) {
+  const rl = createInterface({ input: proc.stdout });
+  for await (const line of rl) {
+    const m = pattern.exec(line);
+    if (m) {
+      rl.close();
+      return m;
+    }
+  }
+  throw new Error(`exited before printing ${pattern}`);
+}
+
+console.log("connections".padStart(12), "max lag ms".padStart(12), "p99 lag ms".padStart(12));
+
+for (const count of COUNTS) {
+  const server = spawn(BUN, [`${here}server.mjs`], { stdio: ["pipe", "pipe", "inherit"] });
+  const [, port] = await waitFor(server, /^READY (\d+)$/);
+
+  const client = spawn(BUN, [`${here}client.mjs`], {
+    env: { ...process.env, PORT: port, COUNT: String(count) },
+    stdio: ["ignore", "pipe", "inherit"],
+  });
+  await waitFor(client, /^CONNECTED$/);
+
+  server.stdin.write(`measure ${SECONDS}\n`);
+  const [, max, p99] = await waitFor(server, /^LAG (\S+) (\S+)$/);
+  console.log(String(count).padStart(12), max.padStart(12), p99.padStart(12));
+
+  client.kill();
+  server.stdin.end();
+  await Promise.all([once(client, "exit"), once(server, "exit")]);
+}
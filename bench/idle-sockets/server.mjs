@@ -0,0 +1,43 @@
+// Serves keep-alive requests and samples event loop lag on demand.
+//
+// Prints `READY <port>`, then for every `measure <seconds>` line on stdin
+// prints `LAG <max ms> <p99 ms>` once the window is over.
+import { createInterface } from "node:readline";
+
+const server = Bun.serve({
+  port: 0,
+  // Maximum, so the sweep only has to find that nothing expired.
+  idleTimeout: 255,
+  fetch() {
+    return new Response("ok");
+  },
+});
+
+function measure(seconds) {
+  const { promise, resolve } = Promise.withResolvers();
+  const lags = [];
+  let last = performance.now();
+  const interval = setInterval(() => {
+    const now = performance.now();
+    lags.push(now - last - 1);
+    last = now;
+  }, 1);
+  setTimeout(() => {
+    clearInterval(interval);
+    lags.sort((a, b) => a - b);
+    resolve({ max: lags.at(-1), p99: lags[Math.floor(lags.length * 0.99)] });
+  }, seconds * 1000);
+  return promise;
+}
+
+console.log(`READY ${server.port}`);
+
+for await (const line of createInterface({ input: process.stdin })) {
+  const [command, seconds] = line.split(" ");
+  if (command === "measure") {
+    const { max, p99 } = await measure(Number(seconds));
+    console.log(`LAG ${max.toFixed(3)} ${p99.toFixed(3)}`);
+  }
+}
+
+server.stop(true);
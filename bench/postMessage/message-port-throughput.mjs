@@ -0,0 +1,84 @@
+// MessageChannel throughput and latency between the main thread and a worker.
+//
+// "throughput" posts MESSAGES small messages from one thread as fast as it
+// can and reports messages/s once the worker has received them all. "latency"
+// bounces one message back and forth ROUND_TRIPS times and reports the
+// round-trip percentiles. Both use a MessagePort transferred to the worker,
+// so they measure the MessagePort pipe rather than worker.postMessage.
+//
+//   bun message-port-throughput.mjs
+//   node message-port-throughput.mjs
+import { MessageChannel, Worker } from "node:worker_threads";
+
+const messages = Number(process.env.MESSAGES ?? 1_000_000);
+const roundTrips = Number(process.env.ROUND_TRIPS ?? 20_000);
+
+const workerCode = `
+  const { parentPort } = require("node:worker_threads");
+  parentPort.once("message", ({ port, mode, count }) => {
+    if (mode === "throughput") {
+      let received = 0;
+      port.on("message", () => {
+        if (++received === count) port.postMessage(received);
+      });
+    } else {
+      port.on("message", value => port.postMessage(value));
+    }
+  });
+`;
+
+async function withWorker(mode, count, fn) {
+  const worker = new Worker(workerCode, { eval: true });
+  const { port1, port2 } = new MessageChannel();
+  worker.postMessage({ port: port2, mode, count }, [port2]);
+  try {
+    return await fn(port1);
+  } finally {
+    port1.close();
+    await worker.terminate();
+  }
+}
+
+function throughput() {
+  return withWorker("throughput", messages, port => {
+    const { promise, resolve } = Promise.withResolvers();
+    port.once("message", resolve);
+    const message = { id: 1, op: "get", key: "user:1" };
+    const start = performance.now();
+    for (let i = 0; i < messages; i++) port.postMessage(message);
+    return promise.then(() => {
+      const seconds = (performance.now() - start) / 1000;
+      return { messages, seconds: +seconds.toFixed(3), messagesPerSec: Math.round(messages / seconds) };
+    });
+  });
+}
+
+function latency() {
+  return withWorker("latency", roundTrips, port => {
+    const samples = new Float64Array(roundTrips);
+    const { promise, resolve } = Promise.withResolvers();
+    let i = 0;
+    let sentAt = 0;
+    port.on("message", () => {
+      samples[i++] = performance.now() - sentAt;
+      if (i === roundTrips) return resolve();
+      sentAt = performance.now();
+      port.postMessage(i);
+    });
+    sentAt = performance.now();
+    port.postMessage(0);
+    return promise.then(() => {
+      samples.sort();
+      const us = q => +(samples[Math.min(roundTrips - 1, Math.floor(q * roundTrips))] * 1000).toFixed(1);
+      return { roundTrips, p50us: us(0.5), p99us: us(0.99), maxUs: us(1) };
+    });
+  });
+}
+
+console.log(
+  JSON.stringify({
+    runtime: process.versions.bun ? "bun" : "node",
+    throughput: await throughput(),
+    latency: await latency(),
+  }),
+);
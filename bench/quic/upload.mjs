@@ -0,0 +1,102 @@
+// HTTP/3 upload throughput: one client streams UPLOAD_MB to a server that
+// discards it, over STREAMS concurrent bidi streams on one session. Bulk
+// upload is where per-datagram send/receive cost dominates, so this is the
+// number UDP segmentation offload (GSO/GRO) moves.
+//
+// Runs unmodified on bun and on a node built with --experimental-quic. The
+// server is a child process of the same runtime so each side gets its own
+// core:
+//
+//   bun upload.mjs
+//   node --experimental-quic --no-warnings upload.mjs
+import { spawn } from "node:child_process";
+import { createPrivateKey } from "node:crypto";
+import { readFileSync } from "node:fs";
+import { join } from "node:path";
+import { connect, listen } from "node:quic";
+import { createInterface } from "node:readline";
+import { drainableProtocol as dp } from "stream/iter";
+
+const here = new URL(".", import.meta.url).pathname;
+const uploadMB = Number(process.env.UPLOAD_MB ?? 256);
+const streams = Number(process.env.STREAMS ?? 1);
+const chunkSize = Number(process.env.CHUNK_SIZE ?? 64 * 1024);
+
+if (process.argv[2] === "server") {
+  const key = createPrivateKey(readFileSync(join(here, "key.pem")));
+  const cert = readFileSync(join(here, "cert.pem"));
+  const endpoint = await listen(
+    session => {
+      session.onstream = async stream => {
+        for await (const _ of stream); // eslint-disable-line no-unused-vars
+        stream.writer.endSync();
+        await stream.closed.catch(() => {});
+      };
+      session.closed.catch(() => {});
+    },
+    {
+      sni: { "*": { keys: [key], certs: [cert] } },
+      transportParams: { maxIdleTimeout: 30 },
+      onheaders: function () {
+        this.sendHeaders({ ":status": "200" });
+      },
+    },
+  );
+  console.log(`READY ${endpoint.address.port}`);
+} else {
+  const execArgv = process.versions.bun ? [] : ["--experimental-quic", "--no-warnings"];
+  const server = spawn(process.execPath, [...execArgv, new URL(import.meta.url).pathname, "server"], {
+    stdio: ["ignore", "pipe", "inherit"],
+  });
+  let port;
+  for await (const line of createInterface({ input: server.stdout })) {
+    const m = /^READY (\d+)$/.exec(line);
+    if (m) {
+      port = Number(m[1]);
+      break;
+    }
+  }
+  if (!port) throw new Error("server exited before READY");
+
+  const session = await connect(
+    { address: "127.0.0.1", port },
+    { servername: "localhost", verifyPeer: "manual", transportParams: { maxIdleTimeout: 30 } },
+  );
+  await session.opened;
+
+  const chunk = new Uint8Array(chunkSize).fill(120);
+  const perStream = Math.ceil((uploadMB * 1024 * 1024) / streams / chunkSize);
+  const headers = { ":method": "POST", ":path": "/", ":scheme": "https", ":authority": "localhost" };
+
+  async function upload() {
+    const stream = await session.createBidirectionalStream({ headers });
+    const w = stream.writer;
+    for (let i = 0; i < perStream; i++) {
+      while (!w.writeSync(chunk)) {
+        const drainable = w[dp]();
+        if (drainable) await drainable;
+      }
+    }
+    w.endSync();
+    for await (const _ of stream); // eslint-disable-line no-unused-vars
+    await stream.closed;
+  }
+
+  const start = process.hrtime.bigint();
+  await Promise.all(Array.from({ length: streams }, upload));
+  const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+  const bytes = perStream * streams * chunkSize;
+
+  session.close();
+  server.kill("SIGKILL");
+  console.log(
+    JSON.stringify({
+      runtime: process.versions.bun ? "bun" : "node",
+      megabytes: +(bytes / 1024 / 1024).toFixed(1),
+      streams,
+      seconds: +seconds.toFixed(3),
+      gbitPerSec: +((bytes * 8) / seconds / 1e9).toFixed(2),
+    }),
+  );
+  process.exit(0);
+}
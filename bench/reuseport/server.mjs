@@ -0,0 +1,19 @@
+// Starts THREADS workers that each Bun.serve() on PORT with reusePort.
+const THREADS = Number(process.env.THREADS ?? navigator.hardwareConcurrency);
+const MODE = process.env.MODE ?? "cpu";
+const PORT = Number(process.env.PORT ?? 3000);
+
+const ready = [];
+for (let i = 0; i < THREADS; i++) {
+  const worker = new Worker(new URL("./worker.mjs", import.meta.url), {
+    env: { ...process.env, MODE, PORT: String(PORT) },
+  });
+  const { promise, resolve } = Promise.withResolvers();
+  worker.addEventListener("message", resolve, { once: true });
+  ready.push(promise);
+  // Listen in index order, the kernel numbers the reuseport group by join order.
+  await promise;
+}
+
+await Promise.all(ready);
+console.log(`${THREADS} workers listening on port ${PORT} (reusePort: ${MODE})`);
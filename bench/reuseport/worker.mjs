@@ -0,0 +1,11 @@
+const MODE = process.env.MODE === "true" ? true : process.env.MODE;
+
+Bun.serve({
+  port: Number(process.env.PORT),
+  reusePort: MODE,
+  fetch() {
+    return new Response("Hello World!");
+  },
+});
+
+postMessage("listening");
@@ -0,0 +1,32 @@
+// Route matching in Bun.serve with 10, 100 and 10k registered routes. Half are
+// static, half take a parameter; each request hits the last route registered,
+// which a linear scan of the route tree reaches last.
+import { bench, group, run } from "../runner.mjs";
+
+const servers = [];
+
+for (const count of [10, 100, 10_000]) {
+  const routes = {};
+  for (let i = 0; i < count; i++) {
+    routes[i % 2 ? `/api/v1/items${i}/list` : `/users/${i}/:id`] = () => new Response("ok");
+  }
+  const server = Bun.serve({ port: 0, routes, fetch: () => new Response("fallback") });
+  servers.push(server);
+
+  const last = count - 1;
+  const staticUrl = `${server.url}api/v1/items${last % 2 ? last : last - 1}/list`;
+  const paramUrl = `${server.url}users/${last % 2 ? last - 1 : last}/42`;
+
+  group(`${count} routes`, () => {
+    bench("static route", async () => {
+      await (await fetch(staticUrl)).text();
+    });
+    bench("parameter route", async () => {
+      await (await fetch(paramUrl)).text();
+    });
+  });
+}
+
+await run();
+
+for (const server of servers) server.stop(true);
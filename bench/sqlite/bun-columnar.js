@@ -0,0 +1,87 @@
+// Compares row-at-a-time results with columnar results for a wide scan.
+//
+//   bun bun-columnar.js            # 1,000,000 rows
+//   ROWS=100000 bun bun-columnar.js
+//
+// Time comes from mitata. Memory is the JS heap (and cell count) retained by one
+// full result after a forced GC, i.e. what a reporting job would hold on to.
+import { Database } from "bun:sqlite";
+import { heapStats } from "bun:jsc";
+import { bench, group, run } from "../runner.mjs";
+
+const ROWS = parseInt(process.env.ROWS || "1000000", 10);
+const CHUNK = parseInt(process.env.CHUNK || "65536", 10);
+
+const db = new Database(":memory:");
+db.run(`CREATE TABLE sales (id INTEGER PRIMARY KEY, amount REAL, quantity INTEGER, region TEXT, note TEXT)`);
+{
+  const regions = ["north", "south", "east", "west", "central"];
+  const insert = db.prepare("INSERT INTO sales VALUES (?, ?, ?, ?, ?)");
+  db.transaction(() => {
+    for (let i = 0; i < ROWS; i++) {
+      insert.run(i, (i % 1000) / 10, i % 17, regions[i % regions.length], i % 10 === 0 ? null : "ok");
+    }
+  })();
+}
+
+const select = db.prepare("SELECT * FROM sales");
+
+function sumRows() {
+  let total = 0;
+  for (const row of select.all()) total += row.amount;
+  return total;
+}
+
+function sumValues() {
+  let total = 0;
+  for (const row of select.values()) total += row[1];
+  return total;
+}
+
+function sumColumnar() {
+  let total = 0;
+  for (const amount of select.columnar().columns[1].values) total += amount;
+  return total;
+}
+
+function sumColumnarChunks() {
+  let total = 0;
+  for (const chunk of select.columnarChunks(CHUNK)) {
+    for (const amount of chunk.columns[1].values) total += amount;
+  }
+  return total;
+}
+
+// heapSize includes memory owned by cells but allocated outside the heap, such
+// as typed array contents, so both result shapes are measured the same way.
+function retained(fn) {
+  Bun.gc(true);
+  const before = heapStats();
+  const result = fn();
+  Bun.gc(true);
+  const after = heapStats();
+  // Keep `result` alive across the second GC.
+  if (result === undefined) throw new Error("unreachable");
+  return { bytes: after.heapSize - before.heapSize, cells: after.objectCount - before.objectCount };
+}
+
+function report(label, fn) {
+  const { bytes, cells } = retained(fn);
+  const mb = (bytes / 1024 / 1024).toFixed(1);
+  console.log(`retained ${label.padEnd(12)} ${mb.padStart(8)} MB ${cells.toLocaleString().padStart(12)} cells`);
+}
+
+console.log(`${ROWS.toLocaleString()} rows, ${select.columnNames.length} columns`);
+report("all()", () => select.all());
+report("values()", () => select.values());
+report("columnar()", () => select.columnar());
+console.log();
+
+group(`sum(amount) over ${ROWS.toLocaleString()} rows`, () => {
+  bench("all()", sumRows);
+  bench("values()", sumValues);
+  bench("columnar()", sumColumnar);
+  bench(`columnarChunks(${CHUNK})`, sumColumnarChunks);
+});
+
+await run();
@@ -1083,6 +1083,20 @@ declare module "bun" {
    * JSONC related APIs
    */
   namespace JSONC {
+    interface ParseOptions {
+      /**
+       * Build each object's properties the first time the object is read
+       * instead of all at once. Handlers that look at a few fields of a large
+       * document skip the cost of the rest. Arrays are still built eagerly.
+       *
+       * The result otherwise behaves like a normal object: it can be read,
+       * enumerated, modified and passed to `JSON.stringify`.
+       *
+       * @default false
+       */
+      lazy?: boolean;
+    }
+
     /**
      * Parse a JSONC (JSON with Comments) string into a JavaScript value.
      *
@@ -1092,6 +1106,7 @@ declare module "bun" {
      * @category Utilities
      *
      * @param input The JSONC string to parse
+     * @param options Parse options
      * @returns A JavaScript value
      * @throws {SyntaxError} If the input is not valid JSONC
      *
@@ -1104,7 +1119,7 @@ declare module "bun" {
      * }`);
      * ```
      */
-    export function parse(input: string): unknown;
+    export function parse(input: string, options?: ParseOptions): unknown;
   }
 
   /**
@@ -1201,6 +1216,44 @@ declare module "bun" {
       start?: number,
       end?: number,
     ): ParseChunkResult;
+
+    interface ParseStreamOptions {
+      /**
+       * `"jsonl"` yields one value per line. `"array"` expects a single
+       * top-level JSON array and yields its elements.
+       *
+       * @default "jsonl"
+       */
+      format?: "jsonl" | "array";
+    }
+
+    /**
+     * Parse JSON values out of a stream of chunks, yielding each value as
+     * soon as it is complete.
+     *
+     * Only the unfinished value is kept between chunks, so memory use is
+     * bounded by the largest value rather than by the size of the input.
+     * With `format: "array"`, a large JSON array body can be consumed one
+     * element at a time.
+     *
+     * Chunks may be strings, `ArrayBuffer`s or typed arrays. Breaking out of
+     * the loop cancels the source. Invalid input rejects with a `SyntaxError`
+     * after the values before it have been yielded.
+     *
+     * @param source A `ReadableStream` or any async iterable of chunks
+     *
+     * @example
+     * ```js
+     * const response = await fetch("https://example.com/records.json");
+     * for await (const record of Bun.JSONL.parseStream(response.body!, { format: "array" })) {
+     *   await handle(record);
+     * }
+     * ```
+     */
+    export function parseStream(
+      source: ReadableStream<string | NodeJS.TypedArray | ArrayBufferLike> | AsyncIterable<unknown>,
+      options?: ParseStreamOptions,
+    ): AsyncGenerator<unknown, void, undefined>;
   }
 
   /**
@@ -6049,6 +6102,86 @@ declare module "bun" {
    */
   const isMainThread: boolean;
 
+  /**
+   * A single-producer, single-consumer message ring over a `SharedArrayBuffer`.
+   *
+   * Messages are written straight into shared memory, so sending one skips
+   * `postMessage` and the structured clone algorithm entirely. Binary messages
+   * are read back as views into the ring without copying.
+   *
+   * Create the ring on one thread, send its {@link SharedRing.buffer buffer} to
+   * the other, and wrap it there with `new Bun.SharedRing(buffer)`. One thread
+   * writes, the other reads.
+   *
+   * @example
+   * ```ts
+   * const ring = new Bun.SharedRing(1024 * 1024);
+   * const worker = new Worker("./consumer.ts");
+   * worker.postMessage(ring.buffer);
+   * ring.closeWith(worker);
+   *
+   * await ring.writeAsync("hello");
+   * await ring.writeAsync(new Uint8Array([1, 2, 3]));
+   * ring.close();
+   *
+   * // consumer.ts
+   * self.onmessage = async ({ data }) => {
+   *   for await (const message of new Bun.SharedRing(data)) {
+   *     console.log(message);
+   *   }
+   * };
+   * ```
+   */
+  class SharedRing {
+    /**
+     * @param capacityOrBuffer The size of the ring in bytes, rounded up to a
+     * power of two (default 64 KiB), or the `buffer` of an existing ring.
+     */
+    constructor(capacityOrBuffer?: number | SharedArrayBuffer);
+
+    /** The shared memory backing the ring. Send this to the other thread. */
+    readonly buffer: SharedArrayBuffer;
+
+    /** Size of the ring's data region in bytes. A message can use at most half of it. */
+    readonly capacity: number;
+
+    /** Whether either side has called {@link close}. */
+    readonly closed: boolean;
+
+    /**
+     * Append a message.
+     *
+     * @returns `false` if the ring doesn't have room for the message yet
+     * @throws if the ring is closed or the message is larger than half the capacity
+     */
+    write(message: string | ArrayBufferView | ArrayBufferLike): boolean;
+
+    /** Append a message, waiting for the reader to make room if the ring is full. */
+    writeAsync(message: string | ArrayBufferView | ArrayBufferLike): Promise<void>;
+
+    /**
+     * Take the next message, or `undefined` if the ring is empty.
+     *
+     * Binary messages are views into the ring and are only valid until the
+     * next read. Call `.slice()` to keep one.
+     */
+    read(): string | Uint8Array | undefined;
+
+    /** Wait for the next message. Resolves to `undefined` once the ring is closed and drained. */
+    readAsync(): Promise<string | Uint8Array | undefined>;
+
+    [Symbol.asyncIterator](): AsyncGenerator<string | Uint8Array, void, undefined>;
+
+    /** Close the ring for both sides. The reader still receives messages already written. */
+    close(): void;
+
+    /**
+     * Close the ring when `target` goes away: a `Worker` exits, a
+     * `MessagePort` closes or an `AbortSignal` aborts.
+     */
+    closeWith(target: Worker | import("node:worker_threads").Worker | MessagePort | AbortSignal): this;
+  }
+
   /**
    * The result of importing an HTML file, at runtime or at build time.
    *
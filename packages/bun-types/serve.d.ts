@@ -833,9 +833,13 @@ declare module "bun" {
        *
        * This allows multiple processes to bind to the same port, which is useful for load balancing.
        *
+       * `"cpu"` also sets `SO_REUSEPORT`, and on Linux steers each connection to the
+       * server whose index in the port's group matches the CPU that received it. Use it
+       * with one server per {@link Worker}, each running on its own thread and event loop.
+       *
        * @default false
        */
-      reusePort?: boolean;
+      reusePort?: boolean | "cpu";
 
       /**
        * Whether the `IPV6_V6ONLY` flag should be set.
@@ -843,6 +847,19 @@ declare module "bun" {
        */
       ipv6Only?: boolean;
 
+      /**
+       * On Linux, hand record encryption for TLS 1.2 connections to the kernel (kTLS) once
+       * the handshake completes. Responses are then written without a user-space copy,
+       * and large files are sent with `sendfile()` as they are over plain HTTP.
+       *
+       * Requires the `tls` kernel module. TLS 1.3 connections, other ciphers than AES-GCM
+       * and ChaCha20-Poly1305, and other platforms keep encrypting in user space. Set
+       * `tls.maxVersion` to TLS 1.2 (`0x0303`) to have every connection use it.
+       *
+       * @default false
+       */
+      kernelTLS?: boolean;
+
       /**
        * Also listen for HTTP/3 (QUIC) on the same port. Requires {@link tls}.
        * @default false
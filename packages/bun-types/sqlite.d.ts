@@ -84,6 +84,18 @@ declare module "bun:sqlite" {
     strict?: boolean;
   }
 
+  /**
+   * Options for {@link Database.pool}
+   */
+  export interface DatabasePoolOptions {
+    /**
+     * The maximum number of read connections the pool opens.
+     *
+     * @default 4
+     */
+    readers?: number;
+  }
+
   /**
    * A SQLite3 database
    *
@@ -578,6 +590,77 @@ declare module "bun:sqlite" {
      * @link https://www.sqlite.org/c3ref/file_control.html
      */
     fileControl(zDbName: string, op: number, arg?: ArrayBufferView | number): number;
+
+    /**
+     * Open a pool of connections to the same database file that runs queries
+     * on background threads and resolves with the results.
+     *
+     * Reads run concurrently on up to `readers` connections. Writes run one at
+     * a time on a single connection. The pool switches the database to
+     * `journal_mode = WAL` so readers are not blocked by the writer.
+     *
+     * The pool does not share this connection's transactions, functions or
+     * loaded extensions. It is closed when the database is closed.
+     *
+     * @example
+     * ```ts
+     * const db = new Database("mydb.sqlite");
+     * const pool = db.pool({ readers: 4 });
+     * const rows = await pool.all("SELECT * FROM foo WHERE bar = ?", "baz");
+     * await pool.run("INSERT INTO foo (bar) VALUES (?)", "qux");
+     * ```
+     *
+     * @param options The pool options
+     * @throws If the database is in-memory
+     */
+    pool(options?: DatabasePoolOptions): DatabasePool;
+  }
+
+  /**
+   * A pool of background connections returned by {@link Database.pool}.
+   *
+   * Bindings are passed the same way as {@link Statement.all}. Named bindings
+   * must match the parameter name in the query, including its prefix unless
+   * the database was opened with `strict: true`.
+   *
+   * @category Database
+   */
+  export class DatabasePool implements Disposable {
+    /**
+     * Run the query and resolve with every row as an object
+     */
+    all<ReturnType = unknown>(query: string, ...bindings: SQLQueryBindings[]): Promise<ReturnType[]>;
+
+    /**
+     * Run the query and resolve with the first row as an object, or `null` if there are no rows
+     */
+    get<ReturnType = unknown>(query: string, ...bindings: SQLQueryBindings[]): Promise<ReturnType | null>;
+
+    /**
+     * Run the query and resolve with every row as an array of values
+     */
+    values(
+      query: string,
+      ...bindings: SQLQueryBindings[]
+    ): Promise<Array<Array<string | bigint | number | boolean | Uint8Array>>>;
+
+    /**
+     * Run the query on the writer connection and resolve with the changes it made
+     */
+    run(query: string, ...bindings: SQLQueryBindings[]): Promise<Changes>;
+
+    /**
+     * `true` once {@link close} has been called
+     */
+    readonly closed: boolean;
+
+    /**
+     * Stop accepting queries. Queries that were already submitted still
+     * settle, and each connection closes once it is idle.
+     */
+    close(): void;
+
+    [Symbol.dispose](): void;
   }
 
   /**
@@ -774,6 +857,49 @@ declare module "bun:sqlite" {
      */
     raw(...params: ParamsType): Array<Array<Uint8Array | null>>;
 
+    /**
+     * Execute the prepared statement and return every row in columnar form:
+     * one typed array per column instead of one object per row.
+     *
+     * Integer and float columns are `Float64Array`s (`BigInt64Array` for
+     * integers when `safeIntegers` is enabled). Text columns are
+     * dictionary-encoded: `values` is a `Uint32Array` of indices into
+     * `dictionary`. A column whose values do not share one of those types is
+     * returned as a plain array.
+     *
+     * @param params optional values to bind to the statement. If omitted, the
+     * statement is run with the last bound values or no parameters if there are
+     * none.
+     *
+     * @example
+     * ```ts
+     * const stmt = db.prepare("SELECT id, city FROM users");
+     * const { length, columns } = stmt.columnar();
+     * const [id, city] = columns;
+     * for (let i = 0; i < length; i++) {
+     *   console.log(id.values[i], city.dictionary[city.values[i]]);
+     * }
+     * ```
+     */
+    columnar(...params: ParamsType): ColumnarChunk;
+
+    /**
+     * Like {@link columnar}, but steps the statement `rowsPerChunk` rows at a
+     * time so that large results never have to be held in memory at once.
+     *
+     * @param rowsPerChunk the maximum number of rows in each chunk
+     * @param params optional values to bind to the statement.
+     *
+     * @example
+     * ```ts
+     * let total = 0;
+     * for (const chunk of db.query("SELECT amount FROM sales").columnarChunks(65536)) {
+     *   for (const amount of chunk.columns[0].values as Float64Array) total += amount;
+     * }
+     * ```
+     */
+    columnarChunks(rowsPerChunk: number, ...params: ParamsType): IterableIterator<ColumnarChunk>;
+
     /**
      * The names of the columns returned by the prepared statement.
      * @example
@@ -1321,4 +1447,29 @@ declare module "bun:sqlite" {
      */
     lastInsertRowid: number | bigint;
   }
+
+  /**
+   * A column of a {@link ColumnarChunk}.
+   *
+   * When `nulls` is present, a `1` marks a `NULL` row and the matching slot in
+   * `values` is `0`.
+   */
+  export type ColumnarColumn =
+    | { name: string; type: "integer" | "float"; values: Float64Array; nulls?: Uint8Array }
+    | { name: string; type: "integer"; values: BigInt64Array; nulls?: Uint8Array }
+    | { name: string; type: "text"; values: Uint32Array; dictionary: string[]; nulls?: Uint8Array }
+    | { name: string; type: "null"; values: null[] }
+    | { name: string; type: "mixed"; values: Array<string | bigint | number | Uint8Array | null> };
+
+  /**
+   * Rows returned by {@link Statement.columnar} and {@link Statement.columnarChunks}.
+   */
+  export interface ColumnarChunk {
+    /**
+     * The number of rows in this chunk.
+     */
+    length: number;
+
+    columns: ColumnarColumn[];
+  }
 }
@@ -52,10 +52,17 @@ static void init_debug_logging() {
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <stddef.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#ifdef __linux__
+#include <linux/filter.h>
+#if __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#endif
+#endif
 #else /* _WIN32 */
 #include <mstcpip.h>
 #endif
@@ -139,11 +146,66 @@ int bsd_sendmmsg(LIBUS_SOCKET_DESCRIPTOR fd, struct udp_sendbuf* sendbuf, int fl
 #else
     while (1) {
         int ret = sendmmsg(fd, sendbuf->msgvec, sendbuf->num, flags | MSG_NOSIGNAL);
-        if (ret >= 0 || errno != EINTR) return ret;
+        if (ret >= 0 || errno != EINTR) {
+            /* Callers count datagrams; a UDP_SEGMENT entry holds one per iovec. */
+            if (ret > 0 && sendbuf->has_segments) {
+                int datagrams = 0;
+                for (int i = 0; i < ret; i++) {
+                    datagrams += (int) sendbuf->msgvec[i].msg_hdr.msg_iovlen;
+                }
+                return datagrams;
+            }
+            return ret;
+        }
     }
 #endif
 }
 
+#if defined(__linux__)
+/* Returns how many datagrams the first `count` received messages hold. When
+ * none was coalesced by UDP_GRO that is just `count` and the accessors index
+ * msgvec directly; otherwise every message is cut at its segment size into
+ * the segment table (the kernel never coalesces more than 64 per message, so
+ * the table can't overflow). */
+static int bsd_udp_split_gro(struct udp_recvbuf *recvbuf, int count) {
+    unsigned int gso_size[LIBUS_UDP_RECV_COUNT];
+    int coalesced = 0;
+    for (int i = 0; i < count; i++) {
+        struct msghdr *mh = &recvbuf->msgvec[i].msg_hdr;
+        gso_size[i] = 0;
+        for (struct cmsghdr *cm = CMSG_FIRSTHDR(mh); cm; cm = CMSG_NXTHDR(mh, cm)) {
+            if (cm->cmsg_level == SOL_UDP && cm->cmsg_type == UDP_GRO) {
+                int size = 0;
+                memcpy(&size, CMSG_DATA(cm), sizeof(size));
+                if (size > 0) gso_size[i] = (unsigned int) size;
+                break;
+            }
+        }
+        if (gso_size[i] && gso_size[i] < recvbuf->msgvec[i].msg_len) coalesced = 1;
+    }
+    if (!coalesced) return count;
+
+    const unsigned int capacity = sizeof(recvbuf->segment) / sizeof(recvbuf->segment[0]);
+    unsigned int n = 0;
+    for (int i = 0; i < count && n < capacity; i++) {
+        unsigned int len = recvbuf->msgvec[i].msg_len;
+        if (len > LIBUS_UDP_MAX_SIZE) len = LIBUS_UDP_MAX_SIZE;
+        unsigned int step = gso_size[i] ? gso_size[i] : len;
+        unsigned int offset = 0;
+        do {
+            unsigned int length = len - offset < step ? len - offset : step;
+            recvbuf->segment[n].msg = (unsigned int) i;
+            recvbuf->segment[n].offset = offset;
+            recvbuf->segment[n].length = length;
+            n++;
+            offset += length;
+        } while (offset < len && n < capacity);
+    }
+    recvbuf->segments = n;
+    return (int) n;
+}
+#endif
+
 int bsd_recvmmsg(LIBUS_SOCKET_DESCRIPTOR fd, struct udp_recvbuf *recvbuf, int flags, int max_packets) {
     if (max_packets > LIBUS_UDP_RECV_COUNT) max_packets = LIBUS_UDP_RECV_COUNT;
 #if defined(_WIN32)
@@ -193,6 +255,7 @@ int bsd_recvmmsg(LIBUS_SOCKET_DESCRIPTOR fd, struct udp_recvbuf *recvbuf, int fl
 #else
     while (1) {
         int ret = recvmmsg(fd, (struct mmsghdr *)&recvbuf->msgvec, max_packets, flags, 0);
+        if (ret > 0) return bsd_udp_split_gro(recvbuf, ret);
         if (ret >= 0 || errno != EINTR) return ret;
     }
 #endif
@@ -204,7 +267,12 @@ void bsd_udp_setup_recvbuf(struct udp_recvbuf *recvbuf, void *databuf, size_t da
     recvbuf->buflen = databuflen;
 #else
     // assert(databuflen > LIBUS_UDP_MAX_SIZE * LIBUS_UDP_RECV_COUNT);
+#if defined(__linux__)
+    /* The GRO segment table is only read once `segments` is set. */
+    memset(recvbuf, 0, offsetof(struct udp_recvbuf, segment));
+#else
     memset(recvbuf, 0, sizeof(struct udp_recvbuf));
+#endif
     for (size_t i = 0; i < LIBUS_UDP_RECV_COUNT; i++) {
         recvbuf->iov[i].iov_base = (char*)databuf + i * LIBUS_UDP_MAX_SIZE;
         recvbuf->iov[i].iov_len = LIBUS_UDP_MAX_SIZE;
@@ -222,8 +290,40 @@ void bsd_udp_setup_recvbuf(struct udp_recvbuf *recvbuf, void *databuf, size_t da
 #endif
 }
 
-int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloads, size_t* lengths, void** addresses, int num) {
+int bsd_udp_same_peer(const struct sockaddr *a, const struct sockaddr *b) {
+    /* Anything but inet/inet6 is sent without an address (see below). */
+    int fa = a ? a->sa_family : AF_UNSPEC;
+    int fb = b ? b->sa_family : AF_UNSPEC;
+    if (fa != AF_INET && fa != AF_INET6) fa = AF_UNSPEC;
+    if (fb != AF_INET && fb != AF_INET6) fb = AF_UNSPEC;
+    if (fa != fb) return 0;
+    if (fa == AF_INET) {
+        const struct sockaddr_in *x = (const struct sockaddr_in *) a, *y = (const struct sockaddr_in *) b;
+        return x->sin_port == y->sin_port && x->sin_addr.s_addr == y->sin_addr.s_addr;
+    }
+    if (fa == AF_INET6) {
+        const struct sockaddr_in6 *x = (const struct sockaddr_in6 *) a, *y = (const struct sockaddr_in6 *) b;
+        return x->sin6_port == y->sin6_port && x->sin6_scope_id == y->sin6_scope_id &&
+            memcmp(&x->sin6_addr, &y->sin6_addr, sizeof(x->sin6_addr)) == 0;
+    }
+    return 1;
+}
+
+/* UDP_SEGMENT is readable on every kernel that accepts it on send. */
+int bsd_udp_gso_supported(LIBUS_SOCKET_DESCRIPTOR fd) {
+#if defined(__linux__)
+    int size = 0;
+    socklen_t len = sizeof(size);
+    return getsockopt(fd, SOL_UDP, UDP_SEGMENT, &size, &len) == 0;
+#else
+    (void) fd;
+    return 0;
+#endif
+}
+
+int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloads, size_t* lengths, void** addresses, int num, int gso) {
 #if defined(_WIN32)
+    (void) gso;
     buf->payloads = payloads;
     buf->lengths = lengths;
     buf->addresses = addresses;
@@ -235,15 +335,23 @@ int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloa
 
     // sendmsg_x docs states it does not support addresses.
     buf->has_addresses = 0;
+    buf->has_segments = 0;
 
     struct mmsghdr *msgvec = buf->msgvec;
     // todo check this math
-    size_t count = (bufsize - sizeof(struct udp_sendbuf)) / (sizeof(struct mmsghdr) + sizeof(struct iovec));
+    size_t count = (bufsize - sizeof(struct udp_sendbuf)) / (sizeof(struct mmsghdr) + sizeof(struct iovec) + LIBUS_UDP_GSO_CONTROL_SPACE);
     if (count > num) {
         count = num;
     }
     struct iovec *iov = (struct iovec *) (msgvec + count);
-    for (int i = 0; i < count; i++) {
+#if defined(__linux__)
+    char *control = (char *) (iov + count);
+#else
+    (void) gso;
+#endif
+    /* One msgvec entry per datagram, unless GSO folds a run into one. */
+    unsigned int m = 0;
+    for (int i = 0; i < count; i++, m++) {
         struct sockaddr *addr = (struct sockaddr *)addresses[i];
         socklen_t addr_len = 0;
         if (addr) {
@@ -256,21 +364,56 @@ int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloa
         }
         iov[i].iov_base = payloads[i];
         iov[i].iov_len = lengths[i];
-        msgvec[i].msg_hdr.msg_name = addresses[i];
-        msgvec[i].msg_hdr.msg_namelen = addr_len;
-        msgvec[i].msg_hdr.msg_control = NULL;
-        msgvec[i].msg_hdr.msg_controllen = 0;
-        msgvec[i].msg_hdr.msg_iov = iov + i;
-        msgvec[i].msg_hdr.msg_iovlen = 1;
-        msgvec[i].msg_hdr.msg_flags = 0;
-        msgvec[i].msg_len = 0;
+        msgvec[m].msg_hdr.msg_name = addresses[i];
+        msgvec[m].msg_hdr.msg_namelen = addr_len;
+        msgvec[m].msg_hdr.msg_control = NULL;
+        msgvec[m].msg_hdr.msg_controllen = 0;
+        msgvec[m].msg_hdr.msg_iov = iov + i;
+        msgvec[m].msg_hdr.msg_iovlen = 1;
+        msgvec[m].msg_hdr.msg_flags = 0;
+        msgvec[m].msg_len = 0;
 
 
         if (lengths[i] == 0) {
             buf->has_empty = 1;
         }
+
+#if defined(__linux__)
+        /* Fold the datagrams that follow into this entry while they go to the
+         * same peer at the same size; a shorter one is allowed last. */
+        if (gso && lengths[i] > 0 && lengths[i] <= LIBUS_UDP_GSO_MAX_SEGMENT_SIZE) {
+            size_t segment = lengths[i];
+            size_t total = segment;
+            int run = 1;
+            while (i + run < count && run < LIBUS_UDP_GSO_MAX_SEGMENTS) {
+                size_t next = lengths[i + run];
+                if (next == 0 || next > segment || total + next > LIBUS_UDP_GSO_MAX_BYTES) break;
+                if (!bsd_udp_same_peer(addresses[i], addresses[i + run])) break;
+                iov[i + run].iov_base = payloads[i + run];
+                iov[i + run].iov_len = next;
+                total += next;
+                run++;
+                if (next < segment) break;
+            }
+            if (run > 1) {
+                char *cbuf = control + (size_t) m * LIBUS_UDP_GSO_CONTROL_SPACE;
+                memset(cbuf, 0, LIBUS_UDP_GSO_CONTROL_SPACE);
+                struct cmsghdr *cm = (struct cmsghdr *) cbuf;
+                cm->cmsg_level = SOL_UDP;
+                cm->cmsg_type = UDP_SEGMENT;
+                cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                uint16_t gso_size = (uint16_t) segment;
+                memcpy(CMSG_DATA(cm), &gso_size, sizeof(gso_size));
+                msgvec[m].msg_hdr.msg_control = cbuf;
+                msgvec[m].msg_hdr.msg_controllen = LIBUS_UDP_GSO_CONTROL_SPACE;
+                msgvec[m].msg_hdr.msg_iovlen = run;
+                buf->has_segments = 1;
+                i += run - 1;
+            }
+        }
+#endif
     }
-    buf->num = count;
+    buf->num = m;
     return count;
 #endif
 }
@@ -279,6 +422,11 @@ char *bsd_udp_packet_buffer_peer(struct udp_recvbuf *msgvec, int index) {
 #if defined(_WIN32)
     return (char *)&msgvec->addr[index];
 #else
+#if defined(__linux__)
+    if (msgvec->segments) {
+        return msgvec->msgvec[msgvec->segment[index].msg].msg_hdr.msg_name;
+    }
+#endif
     return ((struct mmsghdr *) msgvec)[index].msg_hdr.msg_name;
 #endif
 }
@@ -287,6 +435,12 @@ char *bsd_udp_packet_buffer_payload(struct udp_recvbuf *msgvec, int index) {
 #if defined(_WIN32)
     return msgvec->buf + (size_t) index * LIBUS_UDP_MAX_SIZE;
 #else
+#if defined(__linux__)
+    if (msgvec->segments) {
+        const struct udp_recv_segment *seg = &msgvec->segment[index];
+        return (char *) msgvec->iov[seg->msg].iov_base + seg->offset;
+    }
+#endif
     return ((struct mmsghdr *) msgvec)[index].msg_hdr.msg_iov[0].iov_base;
 #endif
 }
@@ -295,6 +449,11 @@ int bsd_udp_packet_buffer_payload_length(struct udp_recvbuf *msgvec, int index)
 #if defined(_WIN32)
     return (int) msgvec->recvlen[index];
 #else
+#if defined(__linux__)
+    if (msgvec->segments) {
+        return (int) msgvec->segment[index].length;
+    }
+#endif
     /* Clamp to the per-datagram buffer capacity so a truncated datagram can
      * never report more bytes than we actually copied, even if the underlying
      * kernel (e.g. Darwin's recvmsg_x) reports the original datagram length. */
@@ -309,6 +468,17 @@ int bsd_udp_packet_buffer_truncated(struct udp_recvbuf *msgvec, int index) {
      * which we don't currently surface here. */
     return 0;
 #else
+#if defined(__linux__)
+    if (msgvec->segments) {
+        /* A coalesced message can only lose bytes off its end, so only its
+         * last segment was truncated; the ones before it are whole. */
+        const struct udp_recv_segment *seg = &msgvec->segment[index];
+        unsigned int len = msgvec->msgvec[seg->msg].msg_len;
+        if (len > LIBUS_UDP_MAX_SIZE) len = LIBUS_UDP_MAX_SIZE;
+        if (seg->offset + seg->length < len) return 0;
+        index = (int) seg->msg;
+    }
+#endif
     return (((struct mmsghdr *) msgvec)[index].msg_hdr.msg_flags & MSG_TRUNC) ? 1 : 0;
 #endif
 }
@@ -1095,6 +1265,23 @@ static int bsd_set_reuseport(LIBUS_SOCKET_DESCRIPTOR listenFd) {
 #endif
 }
 
+/* Classic BPF returning the receiving CPU as the index of the listener to pick.
+ * The program belongs to the whole reuseport group; an index past the group's
+ * size makes the kernel fall back to its hash, so fewer listeners than CPUs is
+ * fine. Failure (old kernel, seccomp) leaves plain hashing in place. */
+static void bsd_set_reuseport_cpu_steering(LIBUS_SOCKET_DESCRIPTOR listenFd) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    struct sock_filter code[] = {
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, (uint32_t) (SKF_AD_OFF + SKF_AD_CPU) },
+        { BPF_RET | BPF_A, 0, 0, 0 },
+    };
+    struct sock_fprog prog = { .len = sizeof(code) / sizeof(code[0]), .filter = code };
+    setsockopt(listenFd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog));
+#else
+    (void) listenFd;
+#endif
+}
+
 static int bsd_set_reuse(LIBUS_SOCKET_DESCRIPTOR listenFd, int options) {
     int result = 0;
 
@@ -1127,6 +1314,10 @@ static int bsd_set_reuse(LIBUS_SOCKET_DESCRIPTOR listenFd, int options) {
 
             return result;
         }
+
+        if ((options & LIBUS_LISTEN_REUSE_PORT_CPU)) {
+            bsd_set_reuseport_cpu_steering(listenFd);
+        }
     }
 
     return 0;
@@ -1187,6 +1378,137 @@ int bsd_set_defer_accept(LIBUS_SOCKET_DESCRIPTOR listenFd) {
 #endif
 }
 
+/* Returns 1 when TCP_NODELAY was set on the listener and accepted sockets inherit
+ * it, which saves a setsockopt per accepted connection. Linux copies the option
+ * when cloning the listener, the BSDs and XNU copy TF_NODELAY from the listener
+ * in the syncache; Winsock makes no such promise. */
+int bsd_set_listen_nodelay(LIBUS_SOCKET_DESCRIPTOR listenFd) {
+#if defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)
+    int enabled = 1;
+    return setsockopt(listenFd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled)) == 0;
+#else
+    (void) listenFd;
+    return 0;
+#endif
+}
+
+#if defined(__linux__) && defined(TLS_TX)
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+static void *(*const volatile bsd_ktls_wipe)(void *, int, size_t) = memset;
+#endif
+
+/* Hand the TLS 1.2 write keys of a connected socket to the kernel: attach the
+ * "tls" upper-layer protocol and configure TLS_TX. From then on plain send(),
+ * writev() and sendfile() carry plaintext that the kernel seals into records
+ * starting at `rec_seq`. Returns 1 on success; 0 (old kernel, tls module not
+ * loaded, cipher not built in) leaves the socket untouched for user-space
+ * records. A socket whose ULP attached but whose TLS_TX failed still passes
+ * writes through unchanged. */
+int bsd_socket_enable_ktls_tx(LIBUS_SOCKET_DESCRIPTOR fd, int cipher,
+                              const unsigned char *key, const unsigned char *iv,
+                              const unsigned char *rec_seq) {
+#if defined(__linux__) && defined(TLS_TX)
+    union {
+        struct tls12_crypto_info_aes_gcm_128 aes_128_gcm;
+        struct tls12_crypto_info_aes_gcm_256 aes_256_gcm;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+        struct tls12_crypto_info_chacha20_poly1305 chacha20_poly1305;
+#endif
+    } info;
+    socklen_t info_len;
+    memset(&info, 0, sizeof(info));
+
+    /* TLS 1.2 GCM: `iv` is the 4-byte implicit salt and the explicit nonce
+     * continues from the record sequence number, as BoringSSL writes it.
+     * ChaCha20-Poly1305 has no explicit nonce; the 12-byte IV is XORed with
+     * the sequence number. */
+    switch (cipher) {
+    case BSD_KTLS_AES_128_GCM:
+        info.aes_128_gcm.info.version = TLS_1_2_VERSION;
+        info.aes_128_gcm.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+        memcpy(info.aes_128_gcm.key, key, TLS_CIPHER_AES_GCM_128_KEY_SIZE);
+        memcpy(info.aes_128_gcm.salt, iv, TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+        memcpy(info.aes_128_gcm.iv, rec_seq, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+        memcpy(info.aes_128_gcm.rec_seq, rec_seq, TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE);
+        info_len = sizeof(info.aes_128_gcm);
+        break;
+    case BSD_KTLS_AES_256_GCM:
+        info.aes_256_gcm.info.version = TLS_1_2_VERSION;
+        info.aes_256_gcm.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+        memcpy(info.aes_256_gcm.key, key, TLS_CIPHER_AES_GCM_256_KEY_SIZE);
+        memcpy(info.aes_256_gcm.salt, iv, TLS_CIPHER_AES_GCM_256_SALT_SIZE);
+        memcpy(info.aes_256_gcm.iv, rec_seq, TLS_CIPHER_AES_GCM_256_IV_SIZE);
+        memcpy(info.aes_256_gcm.rec_seq, rec_seq, TLS_CIPHER_AES_GCM_256_REC_SEQ_SIZE);
+        info_len = sizeof(info.aes_256_gcm);
+        break;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case BSD_KTLS_CHACHA20_POLY1305:
+        info.chacha20_poly1305.info.version = TLS_1_2_VERSION;
+        info.chacha20_poly1305.info.cipher_type = TLS_CIPHER_CHACHA20_POLY1305;
+        memcpy(info.chacha20_poly1305.key, key, TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE);
+        memcpy(info.chacha20_poly1305.iv, iv, TLS_CIPHER_CHACHA20_POLY1305_IV_SIZE);
+        memcpy(info.chacha20_poly1305.rec_seq, rec_seq, TLS_CIPHER_CHACHA20_POLY1305_REC_SEQ_SIZE);
+        info_len = sizeof(info.chacha20_poly1305);
+        break;
+#endif
+    default:
+        return 0;
+    }
+
+    int ok = setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0 &&
+             setsockopt(fd, SOL_TLS, TLS_TX, &info, info_len) == 0;
+    /* The keys are dead after this; wipe them through a volatile pointer so
+     * the store is not elided. */
+    bsd_ktls_wipe(&info, 0, sizeof(info));
+    return ok;
+#else
+    (void) fd;
+    (void) cipher;
+    (void) key;
+    (void) iv;
+    (void) rec_seq;
+    return 0;
+#endif
+}
+
+/* Send one record of a non-application content type (an alert) on a socket
+ * whose TLS_TX is configured. Returns the bytes written, or -1. */
+int bsd_socket_ktls_send_record(LIBUS_SOCKET_DESCRIPTOR fd, unsigned char record_type,
+                                const char *data, int length) {
+#if defined(__linux__) && defined(TLS_TX)
+    char control[CMSG_SPACE(sizeof(unsigned char))];
+    struct iovec iov = { .iov_base = (void *) data, .iov_len = (size_t) length };
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = record_type;
+
+    ssize_t written;
+    do {
+        written = sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+    } while (IS_EINTR(written));
+    return (int) written;
+#else
+    (void) fd;
+    (void) record_type;
+    (void) data;
+    (void) length;
+    return -1;
+#endif
+}
+
 // return LIBUS_SOCKET_ERROR or the fd that represents listen socket
 // listen both on ipv6 and ipv4
 int bsd_socket_export_size(void) {
@@ -1634,6 +1956,10 @@ static void bsd_apply_udp_recv_options(LIBUS_SOCKET_DESCRIPTOR fd, int family, i
      * (Node's dgram never passes it). Opt-in only: on a shared unconnected
      * socket (the HTTP/3 fetch client) it also makes a queued ICMP fail the
      * next send to a different, live peer. */
+    /* Coalesced receive; bsd_recvmmsg cuts it back into datagrams. Fails
+     * harmlessly (ENOPROTOOPT) before Linux 5.0. */
+    setsockopt(fd, SOL_UDP, UDP_GRO, &enabled, sizeof(enabled));
+
     if (options & LIBUS_UDP_LINUX_RECVERR) {
 #ifdef IP_RECVERR
         setsockopt(fd, IPPROTO_IP, IP_RECVERR, &enabled, sizeof(enabled));
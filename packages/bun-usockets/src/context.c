@@ -218,13 +218,19 @@ void us_internal_socket_group_link_socket(struct us_socket_group_t *group, struc
     group->head_sockets = s;
     us_internal_group_touched(group);
     us_internal_enable_sweep_timer(group->loop);
+    /* Relinked after the low-priority queue, or a connect socket that inherited
+     * its connecting socket's timeouts */
+    if (s->timeout != 255 || s->long_timeout != 255) {
+        us_internal_timeout_wheel_schedule(s);
+    }
 }
 
 void us_internal_socket_group_unlink_socket(struct us_socket_group_t *group, struct us_socket_t *s) {
-    /* We have to properly update the iterator used to sweep sockets for timeouts */
+    /* We have to properly update the iterator used by close_all */
     if (s == group->iterator) {
         group->iterator = s->next;
     }
+    us_internal_timeout_wheel_unlink(s);
 
     struct us_socket_t* prev = s->prev;
     struct us_socket_t* next = s->next;
@@ -357,6 +363,7 @@ static void us_internal_init_listen_socket(struct us_listen_socket_t *ls,
     s->ssl = NULL;
     s->timeout = 255;
     s->long_timeout = 255;
+    s->timeout_wheel_slot = LIBUS_TIMEOUT_WHEEL_UNLINKED;
     s->flags.low_prio_state = 0;
     s->flags.is_paused = 0;
     s->flags.is_ipc = 0;
@@ -378,6 +385,8 @@ static void us_internal_init_listen_socket(struct us_listen_socket_t *ls,
     ls->on_server_name = NULL;
     ls->socket_ext_size = socket_ext_size;
     ls->deferred_accept = 0;
+    ls->inherits_nodelay = 0;
+    ls->kernel_tls = ssl_ctx && (options & LIBUS_LISTEN_KERNEL_TLS);
 
     /* Link into the group so close_all() / test-isolation can find it. */
     ls->next = group->head_listen_sockets;
@@ -409,6 +418,7 @@ struct us_listen_socket_t *us_socket_group_listen(struct us_socket_group_t *grou
 
     struct us_listen_socket_t *ls = (struct us_listen_socket_t *) p;
     us_internal_init_listen_socket(ls, group, kind, ssl_ctx, options, socket_ext_size);
+    ls->inherits_nodelay = bsd_set_listen_nodelay(listen_socket_fd);
 
     if (options & LIBUS_LISTEN_DEFER_ACCEPT) {
         ls->deferred_accept = bsd_set_defer_accept(listen_socket_fd);
@@ -443,6 +453,8 @@ struct us_listen_socket_t *us_socket_group_listen_fd(struct us_socket_group_t *g
 
     struct us_listen_socket_t *ls = (struct us_listen_socket_t *) p;
     us_internal_init_listen_socket(ls, group, kind, ssl_ctx, options, socket_ext_size);
+    /* Fails harmlessly when the inherited fd is not TCP */
+    ls->inherits_nodelay = bsd_set_listen_nodelay(fd);
 
     if (options & LIBUS_LISTEN_DEFER_ACCEPT) {
         ls->deferred_accept = bsd_set_defer_accept(fd);
@@ -535,6 +547,7 @@ static inline void us_internal_init_connect_socket(struct us_socket_t *s,
     s->ssl = NULL;
     s->timeout = 255;
     s->long_timeout = 255;
+    s->timeout_wheel_slot = LIBUS_TIMEOUT_WHEEL_UNLINKED;
     s->flags.low_prio_state = 0;
     s->flags.allow_half_open = (options & LIBUS_SOCKET_ALLOW_HALF_OPEN);
     s->flags.is_paused = 0;
@@ -664,6 +664,15 @@ static int BIO_s_custom_write(BIO *bio, const char *data, int length) {
     return length;
   }
 
+  /* The kernel owns this socket's write keys and sequence numbers: a record
+   * BoringSSL sealed (a fatal alert on a bad peer record) would be wrapped
+   * again by the kernel and garble the stream. close_notify is sent through
+   * the kernel by ssl_kernel_tls_close_notify instead. */
+  if (loop_ssl_data->ssl_socket && loop_ssl_data->ssl_socket->ssl_kernel_tls_tx) {
+    BIO_clear_retry_flags(bio);
+    return length;
+  }
+
   if (loop_ssl_data->ssl_write_batching) {
     /* Append the sealed record; the batch hits the kernel once, after
      * SSL_write returns. Reporting the full length keeps BoringSSL sealing
@@ -1597,6 +1606,7 @@ void us_internal_ssl_attach(struct us_socket_t *s, SSL_CTX *ctx,
   s->ssl_end_delivered = 0;
   s->ssl_in_use = 0;
   s->ssl_pending_detach = 0;
+  s->ssl_kernel_tls_tx = 0;
   s->ssl_pending_close_code = 0;
   s->ssl_is_server = is_client ? 0 : 1;
 }
@@ -1749,6 +1759,75 @@ static int ssl_dispatch_parked_reason(struct us_socket_t *s) {
   return 1;
 }
 
+/* LIBUS_LISTEN_KERNEL_TLS: once a TLS 1.2 server handshake completes, move
+ * record sealing for this socket into the kernel so writes (and sendfile)
+ * carry plaintext. Only the write direction moves; reads, and with them peer
+ * alerts and close_notify, stay with BoringSSL. TLS 1.3 stays in user space:
+ * BoringSSL's C API does not export the traffic secrets, and a peer
+ * KeyUpdate would need the kernel's keys rotated from here. Any failure
+ * leaves the socket on the user-space path. */
+static void ssl_enable_kernel_tls_tx(struct us_socket_t *s) {
+#ifdef __linux__
+  SSL *ssl = s_ssl(s);
+  if (!s->ssl_is_server || us_ssl_listener_ex_idx < 0 || SSL_version(ssl) != TLS1_2_VERSION) return;
+  struct us_listen_socket_t *ls = (struct us_listen_socket_t *)SSL_get_ex_data(ssl, us_ssl_listener_ex_idx);
+  if (!ls || !ls->kernel_tls) return;
+  /* Records already sealed in user space must reach the wire first. */
+  struct loop_ssl_data *loop_ssl_data = (struct loop_ssl_data *)s->group->loop->data.ssl_data;
+  if (loop_ssl_data && loop_ssl_data->ssl_spill_owner == s) return;
+
+  int cipher;
+  size_t key_len, iv_len;
+  switch (SSL_CIPHER_get_cipher_nid(SSL_get_current_cipher(ssl))) {
+  case NID_aes_128_gcm:
+    cipher = BSD_KTLS_AES_128_GCM;
+    key_len = 16;
+    iv_len = 4;
+    break;
+  case NID_aes_256_gcm:
+    cipher = BSD_KTLS_AES_256_GCM;
+    key_len = 32;
+    iv_len = 4;
+    break;
+  case NID_chacha20_poly1305:
+    cipher = BSD_KTLS_CHACHA20_POLY1305;
+    key_len = 32;
+    iv_len = 12;
+    break;
+  default:
+    return;
+  }
+
+  /* client MAC | server MAC | client key | server key | client IV | server IV;
+   * the AEAD suites have no MAC keys. */
+  uint8_t key_block[2 * (32 + 12)];
+  size_t key_block_len = 2 * (key_len + iv_len);
+  if (SSL_get_key_block_len(ssl) != key_block_len ||
+      !SSL_generate_key_block(ssl, key_block, key_block_len)) {
+    ERR_clear_error();
+    return;
+  }
+  uint64_t seq = SSL_get_write_sequence(ssl);
+  uint8_t rec_seq[8];
+  for (int i = 7; i >= 0; i--, seq >>= 8) rec_seq[i] = (uint8_t)seq;
+
+  s->ssl_kernel_tls_tx = bsd_socket_enable_ktls_tx(us_poll_fd(&s->p), cipher, key_block + key_len,
+                                                   key_block + 2 * key_len + iv_len, rec_seq) != 0;
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+#else
+  (void)s;
+#endif
+}
+
+/* BoringSSL's own close_notify is dropped by the BIO once the kernel seals
+ * this socket's records; have the kernel send one. Runs before SSL_shutdown
+ * records the alert as sent. */
+static void ssl_kernel_tls_close_notify(struct us_socket_t *s) {
+  if (!s->ssl_kernel_tls_tx || (SSL_get_shutdown(s_ssl(s)) & SSL_SENT_SHUTDOWN)) return;
+  static const char close_notify[2] = {SSL3_AL_WARNING, SSL_AD_CLOSE_NOTIFY};
+  bsd_socket_ktls_send_record(us_poll_fd(&s->p), SSL3_RT_ALERT, close_notify, sizeof(close_notify));
+}
+
 static void ssl_trigger_handshake(struct us_socket_t *s, int success) {
   /* Read before the state flip below turns tripped() off. */
   int inline_rejected = us_ssl_inline_reject_tripped(s);
@@ -1784,6 +1863,8 @@ static void ssl_trigger_handshake(struct us_socket_t *s, int success) {
   if (!success && ssl_dispatch_parked_reason(s)) {
     return;
   }
+  /* Before the dispatch, so the first response bytes already go through the kernel. */
+  if (success) ssl_enable_kernel_tls_tx(s);
   struct us_bun_verify_error_t verify_error = us_internal_ssl_verify_error(s);
   us_dispatch_handshake(s, success, verify_error);
 }
@@ -1858,6 +1939,7 @@ static int ssl_handle_shutdown(struct us_socket_t *s, int force_fast_shutdown) {
   int received_shutdown = state & SSL_RECEIVED_SHUTDOWN;
   if (!sent_shutdown || !received_shutdown) {
     ssl_set_loop_data(s);
+    ssl_kernel_tls_close_notify(s);
     int ret = SSL_shutdown(s_ssl(s));
     if (ret == 0 && force_fast_shutdown) ret = SSL_shutdown(s_ssl(s));
     if (ret < 0) {
@@ -2476,6 +2558,11 @@ unsigned int us_internal_ssl_spill_pending(struct us_socket_t *s) {
 int us_internal_ssl_write(struct us_socket_t *s, const char *data, int length) {
   if (us_socket_is_closed(s) || us_internal_ssl_is_shut_down(s) || length == 0) return 0;
 
+  /* The kernel seals the records; a partial write re-arms writable like TCP. */
+  if (s->ssl_kernel_tls_tx) {
+    return us_socket_raw_write(s, data, length);
+  }
+
   /* Fast-path connect attaches SSL eagerly on a SEMI_SOCKET (see
    * us_socket_group_connect_resolved_dns); on_open hasn't fired yet so
    * SNI/ALPN aren't on the SSL. SSL_write here would serialize the
@@ -2600,6 +2687,7 @@ void us_internal_ssl_shutdown(struct us_socket_t *s) {
   loop_ssl_data->ssl_read_input_length = 0;
   loop_ssl_data->ssl_socket = s;
 
+  ssl_kernel_tls_close_notify(s);
   int ret = SSL_shutdown(s_ssl(s));
 
   if (SSL_in_init(s_ssl(s)) || SSL_get_quiet_shutdown(s_ssl(s))) {
@@ -55,9 +55,16 @@ void us_loop_run_bun_tick(struct us_loop_t *loop, const struct timespec* timeout
 #endif
 #endif
 
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+static void us_internal_accept_ring_free(void);
+#endif
+
 /* Loop */
 void us_loop_free(struct us_loop_t *loop) {
     us_internal_loop_data_free(loop);
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+    us_internal_accept_ring_free();
+#endif
     close(loop->fd);
     us_free(loop);
 }
@@ -218,6 +225,207 @@ static int bun_kevent64_wait(int kqfd, struct kevent64_s *eventlist, int nevents
 
 #endif
 
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+
+// Same numbers on every architecture that uses the generic syscall table
+#ifndef SYS_io_uring_setup
+#define SYS_io_uring_setup 425
+#endif
+#ifndef SYS_io_uring_enter
+#define SYS_io_uring_enter 426
+#endif
+#ifndef IORING_SETUP_SUBMIT_ALL
+#define IORING_SETUP_SUBMIT_ALL (1U << 7)
+#endif
+// Linux 6.10 (checked by Bun__isIoUringAcceptSupportedOnLinuxKernel): fail with
+// -EAGAIN instead of arming a poll when the backlog is empty
+#ifndef IORING_ACCEPT_DONTWAIT
+#define IORING_ACCEPT_DONTWAIT (1U << 1)
+#endif
+
+extern int Bun__isIoUringAcceptSupportedOnLinuxKernel();
+
+/* -1 until the first loop is created */
+static int has_io_uring_accept = -1;
+
+/* The ring only ever holds one batch of accepts, and every one of them completes
+ * inline (IORING_ACCEPT_DONTWAIT), so it carries no state between calls and one
+ * per thread serves every loop on that thread, including re-entrant ticks. */
+struct us_internal_accept_ring_t {
+    int fd;
+    unsigned sq_mask;
+    unsigned cq_mask;
+    unsigned *sq_tail;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *rings;
+    size_t rings_size;
+    size_t sqes_size;
+};
+
+static _Thread_local struct us_internal_accept_ring_t accept_ring = { .fd = -1 };
+static _Thread_local int accept_ring_failed = 0;
+
+static int us_internal_accept_ring_init(struct us_internal_accept_ring_t *ring) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_SUBMIT_ALL;
+    int fd = (int) syscall(SYS_io_uring_setup, LIBUS_ACCEPT_BATCH, &params);
+    if (fd < 0) {
+        return -1;
+    }
+
+    /* Every kernel with IORING_ACCEPT_DONTWAIT maps both rings with one mmap */
+    size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    size_t rings_size = sq_size > cq_size ? sq_size : cq_size;
+    size_t sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *rings = MAP_FAILED;
+    void *sqes = MAP_FAILED;
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        rings = mmap(NULL, rings_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    }
+    if (rings != MAP_FAILED) {
+        sqes = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    }
+    if (sqes == MAP_FAILED) {
+        if (rings != MAP_FAILED) {
+            munmap(rings, rings_size);
+        }
+        close(fd);
+        return -1;
+    }
+
+    char *base = (char *) rings;
+    ring->fd = fd;
+    ring->sq_mask = *(unsigned *) (base + params.sq_off.ring_mask);
+    ring->cq_mask = *(unsigned *) (base + params.cq_off.ring_mask);
+    ring->sq_tail = (unsigned *) (base + params.sq_off.tail);
+    ring->cq_head = (unsigned *) (base + params.cq_off.head);
+    ring->cq_tail = (unsigned *) (base + params.cq_off.tail);
+    ring->sqes = (struct io_uring_sqe *) sqes;
+    ring->cqes = (struct io_uring_cqe *) (base + params.cq_off.cqes);
+    ring->rings = rings;
+    ring->rings_size = rings_size;
+    ring->sqes_size = sqes_size;
+
+    /* SQ slot i always holds SQE i */
+    unsigned *sq_array = (unsigned *) (base + params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; i++) {
+        sq_array[i] = i;
+    }
+    return 0;
+}
+
+static void us_internal_accept_ring_free(void) {
+    if (accept_ring.fd < 0) {
+        return;
+    }
+    munmap(accept_ring.sqes, accept_ring.sqes_size);
+    munmap(accept_ring.rings, accept_ring.rings_size);
+    close(accept_ring.fd);
+    accept_ring.fd = -1;
+}
+
+/* Waits until the ring has posted at least `wanted` completions */
+static int us_internal_accept_ring_wait(struct us_internal_accept_ring_t *ring, unsigned to_submit, unsigned wanted) {
+    for (;;) {
+        int ret = (int) syscall(SYS_io_uring_enter, ring->fd, to_submit, wanted, IORING_ENTER_GETEVENTS, NULL, 0);
+        /* io_uring_enter only fails with EINTR before it submits anything */
+        if (LIKELY(ret >= 0) || errno != EINTR) {
+            return ret;
+        }
+    }
+}
+
+int us_internal_accept_batch(LIBUS_SOCKET_DESCRIPTOR listen_fd, struct us_internal_accept_batch_t *batch, int max) {
+    if (LIKELY(has_io_uring_accept != 1)) {
+        return -1;
+    }
+    struct us_internal_accept_ring_t *ring = &accept_ring;
+    if (ring->fd < 0) {
+        if (accept_ring_failed || us_internal_accept_ring_init(ring) != 0) {
+            accept_ring_failed = 1;
+            return -1;
+        }
+    }
+
+    unsigned count = max < LIBUS_ACCEPT_BATCH ? (unsigned) max : LIBUS_ACCEPT_BATCH;
+    unsigned sq_tail = *ring->sq_tail;
+    for (unsigned i = 0; i < count; i++) {
+        struct io_uring_sqe *sqe = &ring->sqes[(sq_tail + i) & ring->sq_mask];
+        memset(sqe, 0, sizeof(*sqe));
+        batch->addrs[i].len = sizeof(batch->addrs[i].mem);
+        sqe->opcode = IORING_OP_ACCEPT;
+        sqe->fd = listen_fd;
+        sqe->addr = (uint64_t) (uintptr_t) &batch->addrs[i].mem;
+        sqe->addr2 = (uint64_t) (uintptr_t) &batch->addrs[i].len;
+        sqe->accept_flags = SOCK_CLOEXEC | SOCK_NONBLOCK;
+        sqe->ioprio = IORING_ACCEPT_DONTWAIT;
+        sqe->user_data = i;
+        batch->fds[i] = LIBUS_SOCKET_ERROR;
+    }
+    __atomic_store_n(ring->sq_tail, sq_tail + count, __ATOMIC_RELEASE);
+
+    int submitted = us_internal_accept_ring_wait(ring, count, count);
+    if (submitted < 0) {
+        /* The SQEs may still be queued; drop the ring rather than let a later
+         * io_uring_enter submit them with this batch's stack addresses */
+        us_internal_accept_ring_free();
+        accept_ring_failed = 1;
+        return -1;
+    }
+
+    unsigned seen = 0;
+    unsigned cq_head = *ring->cq_head;
+    while (seen < (unsigned) submitted) {
+        if (cq_head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            if (us_internal_accept_ring_wait(ring, 0, submitted - seen) < 0) {
+                break;
+            }
+            continue;
+        }
+        struct io_uring_cqe *cqe = &ring->cqes[cq_head & ring->cq_mask];
+        if (cqe->res >= 0) {
+            batch->fds[cqe->user_data] = cqe->res;
+        }
+        cq_head++;
+        seen++;
+    }
+    __atomic_store_n(ring->cq_head, cq_head, __ATOMIC_RELEASE);
+
+    if (UNLIKELY(seen != count)) {
+        /* Something is left in the ring that a later batch would misread; stop using it */
+        us_internal_accept_ring_free();
+        accept_ring_failed = 1;
+    }
+
+    /* Keep accept order and pack the accepted fds to the front; the ip pointers are
+     * only set once each address is in its final slot */
+    int accepted = 0;
+    for (unsigned i = 0; i < count; i++) {
+        if (batch->fds[i] == LIBUS_SOCKET_ERROR) {
+            continue;
+        }
+        if (accepted != (int) i) {
+            batch->fds[accepted] = batch->fds[i];
+            batch->addrs[accepted] = batch->addrs[i];
+        }
+        internal_finalize_bsd_addr(&batch->addrs[accepted]);
+        accepted++;
+    }
+    batch->count = accepted;
+    batch->next = 0;
+    return accepted;
+}
+
+#endif
+
 /* Loop */
 struct us_loop_t *us_create_loop(void *hint, void (*wakeup_cb)(struct us_loop_t *loop), void (*pre_cb)(struct us_loop_t *loop), void (*post_cb)(struct us_loop_t *loop), unsigned int ext_size) {
     struct us_loop_t *loop = (struct us_loop_t *) us_calloc(1, sizeof(struct us_loop_t) + ext_size);
@@ -229,6 +437,9 @@ struct us_loop_t *us_create_loop(void *hint, void (*wakeup_cb)(struct us_loop_t
     loop->bun_polls = 0;
 
 #ifdef LIBUS_USE_EPOLL
+    /* loop->fd is not private to usockets: Bun's FilePoll (src/io) registers pipes, files,
+     * signals and timers on it with epoll_ctl directly, so readiness stays with epoll and
+     * io_uring is only used to batch accepts (us_internal_accept_batch). */
     loop->fd = epoll_create1(EPOLL_CLOEXEC);
 
     if (has_epoll_pwait2 == -1) {
@@ -237,6 +448,12 @@ struct us_loop_t *us_create_loop(void *hint, void (*wakeup_cb)(struct us_loop_t
         }
     }
 
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+    if (has_io_uring_accept == -1) {
+        has_io_uring_accept = Bun__isIoUringAcceptSupportedOnLinuxKernel();
+    }
+#endif
+
 #else
     loop->fd = kqueue();
 #endif
@@ -106,6 +106,30 @@ struct us_loop_t {
 #endif
 };
 
+/* Opt-in (BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT) io_uring submission path for
+ * accepting connections. Readiness still comes from epoll; only the accept4() calls a
+ * ready listen socket would make are batched into one io_uring_enter. Android's app
+ * seccomp policy does not allow io_uring, so it is never built there. */
+#if defined(LIBUS_USE_EPOLL) && !defined(__ANDROID__)
+#define LIBUS_USE_IO_URING_ACCEPT
+
+/* Most accepts submitted per io_uring_enter; also the ring's SQ size */
+#define LIBUS_ACCEPT_BATCH 8
+
+struct us_internal_accept_batch_t {
+    int count;
+    /* Next entry us_internal_accept_next hands out */
+    int next;
+    LIBUS_SOCKET_DESCRIPTOR fds[LIBUS_ACCEPT_BATCH];
+    struct bsd_addr_t addrs[LIBUS_ACCEPT_BATCH];
+};
+
+/* Accepts up to max connections off listen_fd with one io_uring_enter. Returns how many
+ * were taken, or -1 when the ring is disabled or unsupported and the caller should use
+ * bsd_accept_socket. Nothing is left in flight when it returns. */
+int us_internal_accept_batch(LIBUS_SOCKET_DESCRIPTOR listen_fd, struct us_internal_accept_batch_t *batch, int max);
+#endif
+
 struct us_poll_t {
     alignas(LIBUS_EXT_ALIGNMENT) struct {
         signed int fd : 27; // we could have this unsigned if we wanted to, -1 should never be used
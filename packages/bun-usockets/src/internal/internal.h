@@ -160,6 +160,14 @@ extern struct addrinfo_result *Bun__addrinfo_getRequestResult(struct addrinfo_re
 #define LIBUS_POLL_HANGUP 2
 void us_internal_dispatch_ready_poll(struct us_poll_t *p, int error, int eof, int events);
 void us_internal_timer_sweep(us_loop_r loop);
+/* Timeout wheel: a socket with a timeout or long timeout set sits in the
+ * bucket of the sweep tick on which it must next be looked at, so a sweep only
+ * visits sockets that may expire. Scheduling is lazy: moving a deadline later
+ * leaves the socket where it is and it is re-bucketed when its old tick comes
+ * up. Only sockets linked into their group's head_sockets are in the wheel. */
+#define LIBUS_TIMEOUT_WHEEL_UNLINKED 255
+void us_internal_timeout_wheel_schedule(struct us_socket_t *s);
+void us_internal_timeout_wheel_unlink(struct us_socket_t *s);
 void us_internal_enable_sweep_timer(struct us_loop_t *loop);
 void us_internal_disable_sweep_timer(struct us_loop_t *loop);
 #ifndef LIBUS_USE_LIBUV
@@ -316,6 +324,10 @@ struct us_socket_t {
    * the driver's epilogue via ssl_pending_detach. */
   unsigned char ssl_in_use : 1;
   unsigned char ssl_pending_detach : 1;
+  /* The kernel seals this socket's outgoing records (kTLS TLS_TX, see
+   * LIBUS_LISTEN_KERNEL_TLS): writes bypass SSL_write and BoringSSL's own
+   * record writes are dropped. */
+  unsigned char ssl_kernel_tls_tx : 1;
   /* Peer FIN was dispatched as on_end on a half-open socket; readable interest is never re-added and on_end never re-fires. */
   unsigned char read_eof : 1;
   /* The close code passed to the deferred close (e.g. a reset requested from
@@ -327,12 +339,16 @@ struct us_socket_t {
    * us_socket_write_check_error). Reset by any send that makes progress.
    * Lives in the pad-to-pointer gap before `group`, so it costs nothing. */
   unsigned char unclassified_send_failures;
+  /* Bucket of loop->data.timeout_wheel we are linked in, or
+   * LIBUS_TIMEOUT_WHEEL_UNLINKED. */
+  unsigned char timeout_wheel_slot;
 
   struct us_socket_group_t *group;
   /* NULL for plain TCP. Direct BoringSSL `SSL*`; set by us_internal_ssl_attach
    * in adopt_tls / connect-with-ssl_ctx / accept-with-ssl_ctx. */
   struct ssl_st *ssl;
   struct us_socket_t *prev, *next;
+  struct us_socket_t *timeout_prev, *timeout_next;
   struct us_socket_t *connect_next;
   struct us_connecting_socket_t *connect_state;
 };
@@ -404,6 +420,9 @@ struct us_udp_socket_t {
     uint16_t closed : 1;
     uint16_t connected : 1;
     uint16_t shared_fd : 1;
+    /* Kernel accepts UDP_SEGMENT; cleared for good the first time a
+     * segmented send is refused. */
+    uint16_t gso : 1;
     struct us_udp_socket_t *next;
 };
 
@@ -471,6 +490,10 @@ struct us_listen_socket_t {
   unsigned char accept_kind;
   /* Set when TCP_DEFER_ACCEPT/SO_ACCEPTFILTER was successfully applied. */
   unsigned char deferred_accept;
+  /* Set when accepted sockets inherit TCP_NODELAY from the listener. */
+  unsigned char inherits_nodelay;
+  /* LIBUS_LISTEN_KERNEL_TLS: offload TLS 1.2 record writes to the kernel. */
+  unsigned char kernel_tls;
 };
 
 void us_internal_socket_group_link_connecting_socket(us_socket_group_r group, struct us_connecting_socket_t *c);
@@ -36,6 +36,10 @@ typedef void* zig_mutex_t;
 struct us_quic_socket_context_s;
 struct us_nq_driver_s;
 
+/* One bucket per short-timeout tick; deadlines further out than that (long
+ * timeouts) are re-bucketed when they come up. */
+#define LIBUS_TIMEOUT_WHEEL_SLOTS 240
+
 struct us_internal_loop_data_t {
 #ifdef LIBUS_USE_LIBUV
     struct us_timer_t *sweep_timer;
@@ -93,6 +97,11 @@ struct us_internal_loop_data_t {
      * sockets must be deferred to the outermost tick so the outer dispatch
      * doesn't read a freed poll. */
     int tick_depth;
+    /* Sweep ticks since the loop was created; the wheel slot of the current
+     * tick is timeout_wheel_tick % LIBUS_TIMEOUT_WHEEL_SLOTS. */
+    uint32_t timeout_wheel_tick;
+    /* Sockets bucketed by the sweep tick that may expire them (see internal.h) */
+    struct us_socket_t *timeout_wheel[LIBUS_TIMEOUT_WHEEL_SLOTS];
 };
 
 #endif // LOOP_DATA_H
@@ -58,6 +58,40 @@ struct bsd_addr_t {
 
 #define LIBUS_UDP_RECV_COUNT (LIBUS_RECV_BUFFER_LENGTH / LIBUS_UDP_MAX_SIZE)
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+/* UDP_SEGMENT (Linux 4.18+) sends a run of equal-sized datagrams to one peer
+ * as a single sendmmsg entry and lets the stack or NIC cut it back up. A
+ * segment must fit the route MTU or the whole send fails with EINVAL, so only
+ * datagrams that fit a 1500-byte IPv6 path are coalesced; the run as a whole
+ * must stay under the largest UDP payload. */
+#define LIBUS_UDP_GSO_MAX_SEGMENTS 64
+#define LIBUS_UDP_GSO_MAX_SEGMENT_SIZE 1452
+#define LIBUS_UDP_GSO_MAX_BYTES 65507
+#define LIBUS_UDP_GSO_CONTROL_SPACE CMSG_SPACE(sizeof(uint16_t))
+/* UDP_GRO (Linux 5.0+) is the receive-side mirror: up to 64 datagrams from
+ * one peer arrive in one recvmmsg slot with their segment size in a control
+ * message. bsd_recvmmsg splits them back out into this table so the packet
+ * buffer accessors keep indexing individual datagrams. */
+#define LIBUS_UDP_GRO_MAX_SEGMENTS 64
+struct udp_recv_segment {
+    unsigned int msg;
+    unsigned int offset;
+    unsigned int length;
+};
+#else
+#define LIBUS_UDP_GSO_CONTROL_SPACE 0
+#endif
+
 #ifdef __APPLE__
 /*
  * Extended version for sendmsg_x() and recvmsg_x() calls
@@ -142,6 +176,12 @@ struct udp_recvbuf {
     struct iovec iov[LIBUS_UDP_RECV_COUNT];
     struct sockaddr_storage addr[LIBUS_UDP_RECV_COUNT];
     char control[LIBUS_UDP_RECV_COUNT][256];
+#if defined(__linux__)
+    /* Zero unless a UDP_GRO message was received; then every index goes
+     * through segment[] instead of msgvec[]. */
+    unsigned int segments;
+    struct udp_recv_segment segment[LIBUS_UDP_RECV_COUNT * LIBUS_UDP_GRO_MAX_SEGMENTS];
+#endif
 #endif
 };
 
@@ -154,6 +194,8 @@ struct udp_sendbuf {
 #else
     unsigned int has_empty : 1;
     unsigned int has_addresses : 1;
+    /* Some entry carries several datagrams under UDP_SEGMENT. */
+    unsigned int has_segments : 1;
     unsigned int num;
     struct mmsghdr msgvec[];
 #endif
@@ -162,7 +204,9 @@ struct udp_sendbuf {
 int bsd_sendmmsg(LIBUS_SOCKET_DESCRIPTOR fd, struct udp_sendbuf* sendbuf, int flags);
 int bsd_recvmmsg(LIBUS_SOCKET_DESCRIPTOR fd, struct udp_recvbuf *recvbuf, int flags, int max_packets);
 void bsd_udp_setup_recvbuf(struct udp_recvbuf *recvbuf, void *databuf, size_t databuflen);
-int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloads, size_t* lengths, void** addresses, int num);
+int bsd_udp_setup_sendbuf(struct udp_sendbuf *buf, size_t bufsize, void** payloads, size_t* lengths, void** addresses, int num, int gso);
+int bsd_udp_gso_supported(LIBUS_SOCKET_DESCRIPTOR fd);
+int bsd_udp_same_peer(const struct sockaddr *a, const struct sockaddr *b);
 int bsd_udp_packet_buffer_payload_length(struct udp_recvbuf *msgvec, int index);
 char *bsd_udp_packet_buffer_payload(struct udp_recvbuf *msgvec, int index);
 char *bsd_udp_packet_buffer_peer(struct udp_recvbuf *msgvec, int index);
@@ -173,6 +217,19 @@ LIBUS_SOCKET_DESCRIPTOR apple_no_sigpipe(LIBUS_SOCKET_DESCRIPTOR fd);
 LIBUS_SOCKET_DESCRIPTOR bsd_set_nonblocking(LIBUS_SOCKET_DESCRIPTOR fd);
 void bsd_socket_nodelay(LIBUS_SOCKET_DESCRIPTOR fd, int enabled);
 int bsd_set_defer_accept(LIBUS_SOCKET_DESCRIPTOR listenFd);
+int bsd_set_listen_nodelay(LIBUS_SOCKET_DESCRIPTOR listenFd);
+
+/* Ciphers bsd_socket_enable_ktls_tx can hand to the kernel. */
+enum {
+    BSD_KTLS_AES_128_GCM = 1,
+    BSD_KTLS_AES_256_GCM = 2,
+    BSD_KTLS_CHACHA20_POLY1305 = 3,
+};
+int bsd_socket_enable_ktls_tx(LIBUS_SOCKET_DESCRIPTOR fd, int cipher,
+                              const unsigned char *key, const unsigned char *iv,
+                              const unsigned char *rec_seq);
+int bsd_socket_ktls_send_record(LIBUS_SOCKET_DESCRIPTOR fd, unsigned char record_type,
+                                const char *data, int length);
 int bsd_socket_broadcast(LIBUS_SOCKET_DESCRIPTOR fd, int enabled);
 int bsd_socket_ttl_unicast(LIBUS_SOCKET_DESCRIPTOR fd, int ttl);
 int bsd_socket_ttl_multicast(LIBUS_SOCKET_DESCRIPTOR fd, int ttl);
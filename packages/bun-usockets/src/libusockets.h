@@ -94,6 +94,13 @@
 /* 512kb shared receive buffer */
 #define LIBUS_RECV_BUFFER_LENGTH 524288
 
+/* Most connections a listen socket accepts per readiness event. The rest stay
+ * in the backlog and the (level-triggered) poll reports the listener again on
+ * the next iteration, so a connection storm cannot starve established sockets */
+#ifndef LIBUS_ACCEPT_BUDGET
+#define LIBUS_ACCEPT_BUDGET 64
+#endif
+
 /* Small 16KB shared send buffer for UDP packet metadata */
 #define LIBUS_SEND_BUFFER_LENGTH (1 << 14)
 /* A timeout granularity of 4 seconds means give or take 4 seconds from set timeout */
@@ -160,6 +167,15 @@ enum {
      * unconnected socket it also makes the next send fail for a datagram
      * bound to a different, live peer. */
     LIBUS_UDP_LINUX_RECVERR = 128,
+    /* With LIBUS_LISTEN_REUSE_PORT on Linux, steer each new connection to the listener
+     * of the reuseport group whose index matches the CPU that received it, so one
+     * listener per loop thread keeps a connection on the core that took its interrupt.
+     * CPUs without a matching listener fall back to the kernel's hash. Best effort. */
+    LIBUS_LISTEN_REUSE_PORT_CPU = 256,
+    /* On Linux, hand the write keys of TLS 1.2 connections accepted by this listener to
+     * the kernel (kTLS) once the handshake completes, so writes and sendfile() skip
+     * user-space encryption. Connections the kernel cannot take stay in user space. */
+    LIBUS_LISTEN_KERNEL_TLS = 512,
 };
 
 /* Library types publicly available */
@@ -630,6 +646,10 @@ struct us_poll_t *us_poll_resize(us_poll_r p, us_loop_r loop, unsigned int old_e
 
 /* SSL* if TLS, else (void*)(intptr_t)fd. */
 void *us_socket_get_native_handle(us_socket_r s) nonnull_fn_decl;
+/* The fd of a TLS socket whose outgoing records the kernel seals (see
+ * LIBUS_LISTEN_KERNEL_TLS), so plaintext may be sendfile()d into it; -1 for
+ * every other socket. */
+int us_socket_kernel_tls_fd(us_socket_r s) nonnull_fn_decl;
 
 /* Plaintext write (TLS-encrypts if `s->ssl`). Returns bytes accepted; on
  * partial write the next on_writable will fire. */
@@ -180,9 +180,9 @@ void us_internal_loop_link_group(struct us_loop_t *loop, struct us_socket_group_
 
 /* Unlink is called before the embedding owner frees its storage */
 void us_internal_loop_unlink_group(struct us_loop_t *loop, struct us_socket_group_t *group) {
-    /* If a timeout callback in us_internal_timer_sweep deinits the current group,
-     * advance the sweep iterator before group->next is cleared — otherwise the sweep
-     * walks into freed storage and skips active groups. */
+    /* If a callback run from a walk over the group list deinits the current group,
+     * advance the walk's iterator before group->next is cleared — otherwise the walk
+     * reads freed storage and skips active groups. */
     if (group == loop->data.iterator) {
         loop->data.iterator = group->next;
     }
@@ -227,69 +227,132 @@ int us_loop_close_all_groups(struct us_loop_t *loop) {
     return any;
 }
 
+/* Number of sweeps from now until the one that expires this socket's short
+ * or long timeout, whichever comes first, or 0 if neither is set. A sweep
+ * first advances the group's global_tick and then compares, so the k:th sweep
+ * from now sees timestamp (global_tick + k) % 240 and long timestamp
+ * ((global_tick + k) / 15) % 240. */
+static unsigned int us_internal_sweeps_until_timeout(struct us_socket_t *s) {
+    unsigned int g = s->group->global_tick;
+    unsigned int sweeps = 0;
+
+    if (s->timeout != 255) {
+        sweeps = ((s->timeout + 480 - (g + 1) % 240) % 240) + 1;
+    }
+
+    if (s->long_timeout != 255) {
+        unsigned int next_long_tick = (g + 1) / 15;
+        unsigned int long_ticks_left = (s->long_timeout + 240 - next_long_tick % 240) % 240;
+        unsigned int long_sweeps = long_ticks_left ? (next_long_tick + long_ticks_left) * 15 - g : 1;
+        if (!sweeps || long_sweeps < sweeps) {
+            sweeps = long_sweeps;
+        }
+    }
+
+    return sweeps;
+}
+
+void us_internal_timeout_wheel_unlink(struct us_socket_t *s) {
+    if (s->timeout_wheel_slot == LIBUS_TIMEOUT_WHEEL_UNLINKED) {
+        return;
+    }
+
+    struct us_internal_loop_data_t *loop_data = &s->group->loop->data;
+    if (s->timeout_prev) {
+        s->timeout_prev->timeout_next = s->timeout_next;
+    } else {
+        loop_data->timeout_wheel[s->timeout_wheel_slot] = s->timeout_next;
+    }
+    if (s->timeout_next) {
+        s->timeout_next->timeout_prev = s->timeout_prev;
+    }
+    s->timeout_wheel_slot = LIBUS_TIMEOUT_WHEEL_UNLINKED;
+}
+
+/* Called whenever a deadline may have moved closer. Cheap when it did not:
+ * a socket already bucketed at or before its new deadline stays put and is
+ * re-bucketed by the sweep that visits it. */
+void us_internal_timeout_wheel_schedule(struct us_socket_t *s) {
+    if (us_socket_is_closed(s) || s->flags.low_prio_state == 1) {
+        /* Not in head_sockets, us_internal_socket_group_link_socket schedules us */
+        return;
+    }
+
+    unsigned int sweeps = us_internal_sweeps_until_timeout(s);
+    if (!sweeps) {
+        /* Left in the wheel, if linked, until its bucket comes up */
+        return;
+    }
+    /* Further out than one lap: look again in one lap minus a tick */
+    if (sweeps >= LIBUS_TIMEOUT_WHEEL_SLOTS) {
+        sweeps = LIBUS_TIMEOUT_WHEEL_SLOTS - 1;
+    }
+
+    struct us_internal_loop_data_t *loop_data = &s->group->loop->data;
+    unsigned int current_slot = loop_data->timeout_wheel_tick % LIBUS_TIMEOUT_WHEEL_SLOTS;
+    if (s->timeout_wheel_slot != LIBUS_TIMEOUT_WHEEL_UNLINKED) {
+        /* The bucket of the sweep in progress counts as a full lap away */
+        unsigned int scheduled_sweeps = (s->timeout_wheel_slot + LIBUS_TIMEOUT_WHEEL_SLOTS - current_slot) % LIBUS_TIMEOUT_WHEEL_SLOTS;
+        if (scheduled_sweeps && scheduled_sweeps <= sweeps) {
+            return;
+        }
+        us_internal_timeout_wheel_unlink(s);
+    }
+
+    unsigned int slot = (current_slot + sweeps) % LIBUS_TIMEOUT_WHEEL_SLOTS;
+    s->timeout_wheel_slot = (unsigned char) slot;
+    s->timeout_prev = 0;
+    s->timeout_next = loop_data->timeout_wheel[slot];
+    if (s->timeout_next) {
+        s->timeout_next->timeout_prev = s;
+    }
+    loop_data->timeout_wheel[slot] = s;
+}
+
 /* This functions should never run recursively */
 void us_internal_timer_sweep(struct us_loop_t *loop) {
     struct us_internal_loop_data_t *loop_data = &loop->data;
-    /* For all socket groups in this loop */
-    loop_data->iterator = loop_data->head;
-    while (loop_data->iterator) {
-
-        struct us_socket_group_t *group = loop_data->iterator;
 
-        /* Update this group's timestamps (this could be moved to loop and done once) */
+    /* Advancing the clocks is the only per-group work; no handler runs here */
+    for (struct us_socket_group_t *group = loop_data->head; group; group = group->next) {
         group->global_tick++;
-        unsigned char short_ticks = group->timestamp = group->global_tick % 240;
-        unsigned char long_ticks = group->long_timestamp = (group->global_tick / 15) % 240;
-
-        /* Begin at head */
-        struct us_socket_t *s = group->head_sockets;
-        while (s) {
-            /* Seek until end or timeout found (tightest loop) */
-            while (1) {
-                /* We only read from 1 random cache line here */
-                if (short_ticks == s->timeout || long_ticks == s->long_timeout) {
-                    break;
-                }
+        group->timestamp = group->global_tick % 240;
+        group->long_timestamp = (group->global_tick / 15) % 240;
+    }
 
-                /* Did we reach the end without a find? */
-                if ((s = s->next) == 0) {
-                    goto next_group;
-                }
-            }
+    /* Only visit the sockets bucketed for this tick. Each one is unlinked before
+     * its handlers run and can only be re-bucketed into a later tick, so popping
+     * the head until the bucket is empty terminates and tolerates handlers that
+     * close or reschedule any other socket. */
+    loop_data->timeout_wheel_tick++;
+    unsigned int slot = loop_data->timeout_wheel_tick % LIBUS_TIMEOUT_WHEEL_SLOTS;
+    struct us_socket_t *s;
+    while ((s = loop_data->timeout_wheel[slot])) {
+        us_internal_timeout_wheel_unlink(s);
 
-            /* Here we have a timeout to emit (slow path) */
-            group->iterator = s;
+        if (s->group->timestamp == s->timeout) {
+            s->timeout = 255;
+            us_dispatch_timeout(s);
+        }
 
-            if (short_ticks == s->timeout) {
-                s->timeout = 255;
-                us_dispatch_timeout(s);
-            }
-            /* A timeout handler may have closed every socket and the owner may
-             * have deinit'd the embedding group in response (release builds —
-             * deinit() asserts iterator==NULL in debug). loop_data->iterator
-             * would have been advanced past `group` by unlink_group(); if so,
-             * `group` is freed storage and we must not touch it again. */
-            if (loop_data->iterator != group) goto outer_continue;
-
-            if (group->iterator == s && long_ticks == s->long_timeout) {
-                s->long_timeout = 255;
-                us_dispatch_long_timeout(s);
-            }
-            if (loop_data->iterator != group) goto outer_continue;
+        /* The handler may have closed or adopted the socket, or parked it in the
+         * low-priority queue; closed sockets stay readable until the end of the
+         * tick. The group is only known to be alive while the socket is. */
+        if (us_socket_is_closed(s) || s->flags.low_prio_state == 1) {
+            continue;
+        }
 
-            /* Check for unlink / link (if the event handler did not modify the chain, we step 1) */
-            if (s == group->iterator) {
-                s = s->next;
-            } else {
-                /* The iterator was changed by event handler */
-                s = group->iterator;
+        if (s->group->long_timestamp == s->long_timeout) {
+            s->long_timeout = 255;
+            us_dispatch_long_timeout(s);
+            if (us_socket_is_closed(s) || s->flags.low_prio_state == 1) {
+                continue;
             }
         }
-        next_group:
-        /* Only safe to write back / step ->next if the group survived dispatch. */
-        group->iterator = 0;
-        loop_data->iterator = group->next;
-        outer_continue:;
+
+        /* Not due (an earlier lap, or moved later since it was bucketed), or
+         * still has the other kind of timeout pending */
+        us_internal_timeout_wheel_schedule(s);
     }
 }
 
@@ -431,6 +494,131 @@ void us_internal_loop_post(struct us_loop_t *loop) {
 #define us_ioctl ioctl
 #endif
 
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+/* Next connection off the backlog: handed out of an io_uring accept batch, or from
+ * accept4() when the ring is off. batch->count starts at LIBUS_ACCEPT_BATCH (a full
+ * batch, so fetch another) and is -1 once the ring turned out to be unavailable. */
+static LIBUS_SOCKET_DESCRIPTOR us_internal_accept_next(LIBUS_SOCKET_DESCRIPTOR listen_fd, struct us_internal_accept_batch_t *batch, int budget, struct bsd_addr_t *addr, struct bsd_addr_t **client_addr) {
+    if (batch->next < batch->count) {
+        *client_addr = &batch->addrs[batch->next];
+        return batch->fds[batch->next++];
+    }
+    if (batch->count == LIBUS_ACCEPT_BATCH) {
+        if (us_internal_accept_batch(listen_fd, batch, budget) >= 0) {
+            return us_internal_accept_next(listen_fd, batch, budget, addr, client_addr);
+        }
+        batch->count = -1;
+    }
+    if (batch->count < 0) {
+        *client_addr = addr;
+        return bsd_accept_socket(listen_fd, addr);
+    }
+    /* The last batch came back short: the backlog is empty, skip the EAGAIN */
+    return LIBUS_SOCKET_ERROR;
+}
+#endif
+
+/* Kept out of us_internal_dispatch_ready_poll so the accept batch is only on the stack
+ * while a listen socket is being served */
+__attribute__((noinline)) static void us_internal_listen_socket_accept(struct us_listen_socket_t *listen_socket) {
+    struct us_poll_t *p = (struct us_poll_t *) listen_socket;
+    struct us_socket_group_t *accept_group = listen_socket->accept_group;
+    struct us_loop_t *loop = accept_group->loop;
+    struct bsd_addr_t addr;
+    struct bsd_addr_t *client_addr = &addr;
+    int accept_budget = LIBUS_ACCEPT_BUDGET;
+
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+    struct us_internal_accept_batch_t batch;
+    batch.count = batch.next = LIBUS_ACCEPT_BATCH;
+#define US_ACCEPT_NEXT() us_internal_accept_next(us_poll_fd(p), &batch, accept_budget, &addr, &client_addr)
+#else
+#define US_ACCEPT_NEXT() bsd_accept_socket(us_poll_fd(p), &addr)
+#endif
+
+    LIBUS_SOCKET_DESCRIPTOR client_fd = US_ACCEPT_NEXT();
+    if (client_fd == LIBUS_SOCKET_ERROR) {
+        /* Todo: start timer here */
+
+    } else {
+
+        /* Todo: stop timer if any */
+
+        do {
+            struct us_poll_t *accepted_p = us_create_poll(loop, 0, sizeof(struct us_socket_t) - sizeof(struct us_poll_t) + listen_socket->socket_ext_size);
+            us_poll_init(accepted_p, client_fd, POLL_TYPE_SOCKET);
+            if (us_poll_start_rc(accepted_p, loop, LIBUS_SOCKET_READABLE) != 0) {
+                /* EPOLL_CTL_ADD failed (e.g. ENOSPC). Close the fd so the
+                 * peer sees a RST instead of a connection that silently
+                 * never answers. */
+                bsd_close_socket(client_fd);
+                us_poll_free(accepted_p, loop);
+                continue;
+            }
+
+            struct us_socket_t *s = (struct us_socket_t *) accepted_p;
+
+            s->group = accept_group;
+            s->kind = listen_socket->accept_kind;
+            s->ssl = NULL;
+            s->connect_state = NULL;
+            s->timeout = 255;
+            s->long_timeout = 255;
+            s->timeout_wheel_slot = LIBUS_TIMEOUT_WHEEL_UNLINKED;
+            s->flags.low_prio_state = 0;
+            s->flags.allow_half_open = listen_socket->s.flags.allow_half_open;
+            s->flags.is_paused = 0;
+            s->flags.is_ipc = 0;
+            s->flags.is_closed = 0;
+            s->flags.adopted = 0;
+            s->flags.last_write_failed = 0;
+            s->unclassified_send_failures = 0;
+            s->read_eof = 0;
+
+            /* We always use nodelay, usually inherited from the listener */
+            if (!listen_socket->inherits_nodelay) {
+                bsd_socket_nodelay(client_fd, 1);
+            }
+
+            us_internal_socket_group_link_socket(accept_group, s);
+
+            if (listen_socket->ssl_ctx) {
+                us_internal_ssl_attach(s, listen_socket->ssl_ctx, /*is_client*/ 0, NULL, listen_socket);
+                us_internal_ssl_on_open(s, 0, bsd_addr_get_ip(client_addr), bsd_addr_get_ip_length(client_addr));
+            } else {
+                us_dispatch_open(s, 0, bsd_addr_get_ip(client_addr), bsd_addr_get_ip_length(client_addr));
+            }
+            /* After socket adoption, track the new socket; the old one becomes invalid */
+            s = us_internal_socket_follow_adopted(s);
+
+            /* When the kernel deferred the accept until data arrived (TCP_DEFER_ACCEPT
+             * on Linux, SO_ACCEPTFILTER on FreeBSD), the request/ClientHello is already
+             * in the buffer. Dispatch readable now instead of returning to epoll just to
+             * learn what we already know. The POLL_TYPE_SOCKET handler tolerates
+             * EWOULDBLOCK for the rare case where the defer timed out with no data. */
+            if (listen_socket->deferred_accept && s && !us_socket_is_closed(s)) {
+                us_internal_dispatch_ready_poll((struct us_poll_t *) s, 0, 0, LIBUS_SOCKET_READABLE);
+            }
+
+            /* Exit accept loop if listen socket was closed in on_open or the request handler */
+            if (us_socket_is_closed(&listen_socket->s)) {
+                break;
+            }
+
+        /* Once the budget is spent the rest of the backlog waits for the next iteration */
+        } while (--accept_budget > 0 && (client_fd = US_ACCEPT_NEXT()) != LIBUS_SOCKET_ERROR);
+    }
+#undef US_ACCEPT_NEXT
+
+#ifdef LIBUS_USE_IO_URING_ACCEPT
+    /* The listen socket was closed from a callback with part of a batch unopened.
+     * Batches never exceed the remaining budget, so this is the only way here */
+    while (batch.next < batch.count) {
+        bsd_close_socket(batch.fds[batch.next++]);
+    }
+#endif
+}
+
 void us_internal_dispatch_ready_poll(struct us_poll_t *p, int error, int eof, int events) {
     switch (us_internal_poll_type(p)) {
     case POLL_TYPE_CALLBACK: {
@@ -469,79 +657,7 @@ void us_internal_dispatch_ready_poll(struct us_poll_t *p, int error, int eof, in
                 }
                 us_internal_socket_after_open((struct us_socket_t *) p, connect_error);
             } else {
-                struct us_listen_socket_t *listen_socket = (struct us_listen_socket_t *) p;
-                struct us_socket_group_t *accept_group = listen_socket->accept_group;
-                struct us_loop_t *loop = accept_group->loop;
-                struct bsd_addr_t addr;
-
-                LIBUS_SOCKET_DESCRIPTOR client_fd = bsd_accept_socket(us_poll_fd(p), &addr);
-                if (client_fd == LIBUS_SOCKET_ERROR) {
-                    /* Todo: start timer here */
-
-                } else {
-
-                    /* Todo: stop timer if any */
-
-                    do {
-                        struct us_poll_t *accepted_p = us_create_poll(loop, 0, sizeof(struct us_socket_t) - sizeof(struct us_poll_t) + listen_socket->socket_ext_size);
-                        us_poll_init(accepted_p, client_fd, POLL_TYPE_SOCKET);
-                        if (us_poll_start_rc(accepted_p, loop, LIBUS_SOCKET_READABLE) != 0) {
-                            /* EPOLL_CTL_ADD failed (e.g. ENOSPC). Close the fd so the
-                             * peer sees a RST instead of a connection that silently
-                             * never answers. */
-                            bsd_close_socket(client_fd);
-                            us_poll_free(accepted_p, loop);
-                            continue;
-                        }
-
-                        struct us_socket_t *s = (struct us_socket_t *) accepted_p;
-
-                        s->group = accept_group;
-                        s->kind = listen_socket->accept_kind;
-                        s->ssl = NULL;
-                        s->connect_state = NULL;
-                        s->timeout = 255;
-                        s->long_timeout = 255;
-                        s->flags.low_prio_state = 0;
-                        s->flags.allow_half_open = listen_socket->s.flags.allow_half_open;
-                        s->flags.is_paused = 0;
-                        s->flags.is_ipc = 0;
-                        s->flags.is_closed = 0;
-                        s->flags.adopted = 0;
-                        s->flags.last_write_failed = 0;
-                        s->unclassified_send_failures = 0;
-                        s->read_eof = 0;
-
-                        /* We always use nodelay */
-                        bsd_socket_nodelay(client_fd, 1);
-
-                        us_internal_socket_group_link_socket(accept_group, s);
-
-                        if (listen_socket->ssl_ctx) {
-                            us_internal_ssl_attach(s, listen_socket->ssl_ctx, /*is_client*/ 0, NULL, listen_socket);
-                            us_internal_ssl_on_open(s, 0, bsd_addr_get_ip(&addr), bsd_addr_get_ip_length(&addr));
-                        } else {
-                            us_dispatch_open(s, 0, bsd_addr_get_ip(&addr), bsd_addr_get_ip_length(&addr));
-                        }
-                        /* After socket adoption, track the new socket; the old one becomes invalid */
-                        s = us_internal_socket_follow_adopted(s);
-
-                        /* When the kernel deferred the accept until data arrived (TCP_DEFER_ACCEPT
-                         * on Linux, SO_ACCEPTFILTER on FreeBSD), the request/ClientHello is already
-                         * in the buffer. Dispatch readable now instead of returning to epoll just to
-                         * learn what we already know. The POLL_TYPE_SOCKET handler tolerates
-                         * EWOULDBLOCK for the rare case where the defer timed out with no data. */
-                        if (listen_socket->deferred_accept && s && !us_socket_is_closed(s)) {
-                            us_internal_dispatch_ready_poll((struct us_poll_t *) s, 0, 0, LIBUS_SOCKET_READABLE);
-                        }
-
-                        /* Exit accept loop if listen socket was closed in on_open or the request handler */
-                        if (us_socket_is_closed(&listen_socket->s)) {
-                            break;
-                        }
-
-                    } while ((client_fd = bsd_accept_socket(us_poll_fd(p), &addr)) != LIBUS_SOCKET_ERROR);
-                }
+                us_internal_listen_socket_accept((struct us_listen_socket_t *) p);
             }
         break;
     }
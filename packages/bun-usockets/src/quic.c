@@ -248,30 +248,94 @@ static int us_quic_send_one(LIBUS_SOCKET_DESCRIPTOR fd, const struct lsquic_out_
 #endif
 }
 
+#if defined(__linux__)
+static size_t us_quic_spec_len(const struct lsquic_out_spec *spec) {
+    size_t len = 0;
+    for (size_t i = 0; i < spec->iovlen; i++) len += spec->iov[i].iov_len;
+    return len;
+}
+
+/* How many specs starting at `first` can go out as one UDP_SEGMENT send:
+ * same socket, peer and ECN marking, equal sizes with a shorter one allowed
+ * last, and their iovecs must fit the `iov_room` left in the caller's array. */
+static unsigned us_quic_gso_run(const struct lsquic_out_spec *specs, unsigned first, unsigned n,
+                                size_t iov_room) {
+    const struct lsquic_out_spec *head = &specs[first];
+    size_t segment = us_quic_spec_len(head);
+    if (segment == 0 || segment > LIBUS_UDP_GSO_MAX_SEGMENT_SIZE || head->iovlen > iov_room) return 1;
+    size_t total = segment, iovs = head->iovlen;
+    unsigned run = 1;
+    while (first + run < n && run < LIBUS_UDP_GSO_MAX_SEGMENTS) {
+        const struct lsquic_out_spec *sp = &specs[first + run];
+        if (sp->peer_ctx != head->peer_ctx || sp->ecn != head->ecn) break;
+        if (!bsd_udp_same_peer(sp->dest_sa, head->dest_sa)) break;
+        size_t len = us_quic_spec_len(sp);
+        if (len == 0 || len > segment || total + len > LIBUS_UDP_GSO_MAX_BYTES) break;
+        if (iovs + sp->iovlen > iov_room) break;
+        total += len;
+        iovs += sp->iovlen;
+        run++;
+        if (len < segment) break;
+    }
+    return run;
+}
+#endif
+
 /* lsquic hands back packets in batches; on Linux push them through one
- * sendmmsg() so a 32-packet flight is a single syscall. macOS's sendmsg_x
- * can't carry per-datagram addresses (which QUIC needs), so it falls back to
- * the per-packet path along with everything else non-Linux. The recv side
- * already goes through bsd_recvmmsg in loop.c. */
+ * sendmmsg() so a 32-packet flight is a single syscall, and where the kernel
+ * has UDP_SEGMENT fold each run of same-size packets to one peer into a
+ * single entry so the stack walks it once instead of once per packet. macOS's
+ * sendmsg_x can't carry per-datagram addresses (which QUIC needs), so it falls
+ * back to the per-packet path along with everything else non-Linux. The recv
+ * side already goes through bsd_recvmmsg in loop.c, which also undoes GRO. */
 static int us_quic_packets_out(void *out_ctx, const struct lsquic_out_spec *specs, unsigned n) {
     (void) out_ctx;
     unsigned sent = 0;
 
 #if defined(__linux__)
-    enum { BATCH = 64 };
+    enum { BATCH = 64, BATCH_IOV = 256 };
     struct mmsghdr mm[BATCH];
+    /* specs folded into each mm entry, to turn sendmmsg's count back into lsquic's */
+    unsigned folded[BATCH];
+    struct iovec iov[BATCH_IOV];
+    alignas(struct cmsghdr) char control[BATCH][LIBUS_UDP_GSO_CONTROL_SPACE];
     while (sent < n) {
         us_quic_listen_socket_t *ls = (us_quic_listen_socket_t *) specs[sent].peer_ctx;
         if (!ls->udp) { errno = EBADF; break; }
         int fd = us_poll_fd((struct us_poll_t *) ls->udp);
-        unsigned k = 0;
-        while (k < BATCH && sent + k < n && specs[sent + k].peer_ctx == (void *) ls) {
-            const struct lsquic_out_spec *sp = &specs[sent + k];
+        int gso = ls->udp->gso;
+        int segmented = 0;
+        unsigned k = 0, next = sent;
+        size_t niov = 0;
+        while (k < BATCH && next < n && specs[next].peer_ctx == (void *) ls) {
+            const struct lsquic_out_spec *sp = &specs[next];
             memset(&mm[k], 0, sizeof(mm[k]));
             mm[k].msg_hdr.msg_name = (void *) sp->dest_sa;
             mm[k].msg_hdr.msg_namelen = sa_len(sp->dest_sa);
             mm[k].msg_hdr.msg_iov = sp->iov;
             mm[k].msg_hdr.msg_iovlen = sp->iovlen;
+            unsigned run = gso ? us_quic_gso_run(specs, next, n, BATCH_IOV - niov) : 1;
+            if (run > 1) {
+                mm[k].msg_hdr.msg_iov = &iov[niov];
+                for (unsigned j = 0; j < run; j++) {
+                    const struct lsquic_out_spec *part = &specs[next + j];
+                    memcpy(&iov[niov], part->iov, part->iovlen * sizeof(struct iovec));
+                    niov += part->iovlen;
+                }
+                mm[k].msg_hdr.msg_iovlen = niov - (size_t) (mm[k].msg_hdr.msg_iov - iov);
+                memset(control[k], 0, sizeof(control[k]));
+                struct cmsghdr *cm = (struct cmsghdr *) control[k];
+                cm->cmsg_level = SOL_UDP;
+                cm->cmsg_type = UDP_SEGMENT;
+                cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                uint16_t gso_size = (uint16_t) us_quic_spec_len(sp);
+                memcpy(CMSG_DATA(cm), &gso_size, sizeof(gso_size));
+                mm[k].msg_hdr.msg_control = control[k];
+                mm[k].msg_hdr.msg_controllen = sizeof(control[k]);
+                segmented = 1;
+            }
+            folded[k] = run;
+            next += run;
             k++;
         }
         int r;
@@ -284,6 +348,13 @@ static int us_quic_packets_out(void *out_ctx, const struct lsquic_out_spec *spec
             }
             (void) injected; (void) unused;
         }
+        /* EIO (no checksum offload on the egress device) or EINVAL (a
+         * segment over the route MTU) refuses the whole segmented entry, so
+         * the batch is rebuilt unsegmented and this socket stops trying. */
+        if (r < 0 && segmented && (errno == EIO || errno == EINVAL)) {
+            ls->udp->gso = 0;
+            continue;
+        }
         /* sendmmsg(2) BUGS: on a short return the error code is lost and the
          * caller is expected to retry starting at the first failed message.
          * udp(7): an unconnected socket surfaces async ICMP from an earlier
@@ -300,7 +371,7 @@ static int us_quic_packets_out(void *out_ctx, const struct lsquic_out_spec *spec
             do { r = sendmmsg(fd, mm, k, 0); } while (r < 0 && errno == EINTR);
         }
         if (r < 0) break;
-        sent += (unsigned) r;
+        for (int m = 0; m < r && m < (int) k; m++) sent += folded[m];
     }
 #else
     for (; sent < n; sent++) {
@@ -100,6 +100,7 @@ unsigned char us_connecting_socket_kind(struct us_connecting_socket_t *c) {
 __attribute__((always_inline)) void us_socket_timeout(struct us_socket_t *s, unsigned int seconds) {
     if (seconds) {
         s->timeout = ((unsigned int)s->group->timestamp + ((seconds + 3) >> 2)) % 240;
+        us_internal_timeout_wheel_schedule(s);
     } else {
         s->timeout = 255;
     }
@@ -116,6 +117,7 @@ void us_connecting_socket_timeout(struct us_connecting_socket_t *c, unsigned int
 __attribute__((always_inline)) void us_socket_long_timeout(struct us_socket_t *s, unsigned int minutes) {
     if (minutes) {
         s->long_timeout = ((unsigned int)s->group->long_timestamp + minutes) % 240;
+        us_internal_timeout_wheel_schedule(s);
     } else {
         s->long_timeout = 255;
     }
@@ -450,6 +452,7 @@ struct us_socket_t *us_socket_from_fd(struct us_socket_group_t *group, unsigned
     s->ssl = NULL;
     s->timeout = 255;
     s->long_timeout = 255;
+    s->timeout_wheel_slot = LIBUS_TIMEOUT_WHEEL_UNLINKED;
     s->flags.low_prio_state = 0;
     s->flags.allow_half_open = (options & LIBUS_SOCKET_ALLOW_HALF_OPEN) != 0;
     s->flags.is_paused = 0;
@@ -485,6 +488,15 @@ void *us_socket_get_native_handle(struct us_socket_t *s) {
     return (void *) (uintptr_t) us_poll_fd((struct us_poll_t *) s);
 }
 
+int us_socket_kernel_tls_fd(struct us_socket_t *s) {
+#ifndef _WIN32
+    if (s->ssl && s->ssl_kernel_tls_tx) {
+        return us_poll_fd((struct us_poll_t *) s);
+    }
+#endif
+    return -1;
+}
+
 void *us_connecting_socket_get_native_handle(struct us_connecting_socket_t *c) {
     return (void *) (uintptr_t) -1;
 }
@@ -48,13 +48,22 @@ int us_udp_socket_send(struct us_udp_socket_t *s, void** payloads, size_t* lengt
 
     int total_sent = 0;
     while (num > 0) {
-        int count = bsd_udp_setup_sendbuf(buf, LIBUS_SEND_BUFFER_LENGTH, payloads, lengths, addresses, num);
+        int count = bsd_udp_setup_sendbuf(buf, LIBUS_SEND_BUFFER_LENGTH, payloads, lengths, addresses, num, s->gso);
+        // TODO nohang flag?
+        int sent = bsd_sendmmsg(fd, buf, MSG_DONTWAIT);
+#if defined(__linux__)
+        /* EIO: the egress device can't checksum-offload; EINVAL: a segment
+         * doesn't fit the route MTU. Either way nothing in this batch went
+         * out, so rebuild it as plain datagrams and stop segmenting. */
+        if (sent < 0 && buf->has_segments && (errno == EIO || errno == EINVAL)) {
+            s->gso = 0;
+            continue;
+        }
+#endif
         payloads += count;
         lengths += count;
         addresses += count;
         num -= count;
-        // TODO nohang flag?
-        int sent = bsd_sendmmsg(fd, buf, MSG_DONTWAIT);
         if (sent < 0) {
             /* Linux sendmmsg reports EAGAIN as -1 (per-msg-loop platforms
              * report it as sent==0): re-arm writable so on_drain fires and
@@ -207,6 +216,7 @@ struct us_udp_socket_t *us_create_udp_socket_from_fd(
 
     udp->closed = 0;
     udp->shared_fd = shared ? 1 : 0;
+    udp->gso = bsd_udp_gso_supported(fd);
     udp->connected = 0;
     udp->on_data = data_cb;
     udp->on_drain = drain_cb;
@@ -275,6 +285,7 @@ struct us_udp_socket_t *us_create_udp_socket(
 
     udp->closed = 0;
     udp->shared_fd = 0;
+    udp->gso = bsd_udp_gso_supported(fd);
     udp->connected = 0;
     udp->on_data = data_cb;
     udp->on_drain = drain_cb;
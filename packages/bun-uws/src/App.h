@@ -236,12 +236,14 @@ public:
         if (message.length() >= LoopData::CORK_BUFFER_SIZE) {
             PublishStatus worst = PublishStatus::SUCCESS;
             bool hasReceivers = false;
-            topicTree->publishBig(nullptr, topic, {message, opCode, compress}, [&worst, &hasReceivers](Subscriber *s, TopicTreeBigMessage &message) {
+            /* Compressed once for every subscriber on the shared compressor */
+            std::string sharedFrame;
+            topicTree->publishBig(nullptr, topic, {message, opCode, compress}, [&worst, &hasReceivers, &sharedFrame](Subscriber *s, TopicTreeBigMessage &message) {
                 hasReceivers = true;
                 auto *ws = (WebSocket<SSL, true, int> *) s->user;
 
                 /* Send will drain if needed */
-                worst = WebSocket<SSL, true, int>::worseStatus(worst, (PublishStatus) ws->send(message.message, (OpCode)message.opCode, message.compress));
+                worst = WebSocket<SSL, true, int>::worseStatus(worst, (PublishStatus) ws->sendPublished(message.message, (OpCode)message.opCode, message.compress, sharedFrame));
             });
             return hasReceivers ? worst : PublishStatus::DROPPED;
         } else {
@@ -467,7 +469,7 @@ public:
                 }
 
                 /* If we ever overstep maxBackpresure, exit immediately */
-                if (WebSocket<SSL, true, int>::SendStatus::DROPPED == ws->send(message.message, (OpCode)message.opCode, message.compress)) {
+                if (WebSocket<SSL, true, int>::SendStatus::DROPPED == ws->sendPublished(message.message, (OpCode)message.opCode, message.compress, message.sharedFrame)) {
                     if (needsUncork) {
                         ((AsyncSocket<SSL> *)ws)->uncork();
                         needsUncork = false;
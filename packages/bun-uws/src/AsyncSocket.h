@@ -107,7 +107,8 @@ public:
         getLoopData()->unborrowCorkSlot(this);
     }
 
-    /* Cork this socket. Two sockets may be corked per-loop at once. */
+    /* Cork this socket. Up to LoopData::MAX_CORK_SLOTS sockets may be corked
+     * per-loop at once. */
     void cork() {
         LoopData *loopData = getLoopData();
 
@@ -121,8 +122,9 @@ public:
             return;
         }
 
-        /* Both slots hold data from other sockets. Force-uncork the least
-         * recently used one to make room. */
+        /* The pool is full and every slot holds data from another socket.
+         * Force-uncork the least recently used one to make room. */
+        loopData->recordCorkEviction();
         int victimSlot = loopData->getLRUCorkSlot();
         auto *vs = loopData->getCorkSlot(victimSlot);
         void *victim = vs->socket;
@@ -150,14 +152,15 @@ public:
         bool corked = slot != LoopData::INVALID_CORK_SLOT;
         unsigned int currentOffset = corked ? loopData->getCorkSlot(slot)->offset : 0;
 
-        if ((!existingBackpressure) && (corked || loopData->canCork()) && (currentOffset + size <= LoopData::CORK_BUFFER_SIZE)) {
+        if ((!existingBackpressure) && (corked || loopData->canCork()) && (currentOffset + size <= LoopData::CORK_SLAB_SIZE)) {
             if (!corked) {
                 slot = loopData->acquireCorkSlot(this, SSL);
             }
+            loopData->reserveCorkSlot(slot, currentOffset + (unsigned int) size);
             auto *s = loopData->getCorkSlot(slot);
             char *sendBuffer = s->buffer + s->offset;
             s->offset += (unsigned int) size;
-            ASSERT(s->offset <= LoopData::CORK_BUFFER_SIZE);
+            ASSERT(s->offset <= s->capacity);
             loopData->touchCorkSlot(slot);
             return {sendBuffer, corked ? SendBufferAttribute::NEEDS_NOTHING : SendBufferAttribute::NEEDS_UNCORK};
         } else {
@@ -337,11 +340,12 @@ public:
             if (slot != LoopData::INVALID_CORK_SLOT) {
                 /* We are corked */
                 auto *s = loopData->getCorkSlot(slot);
-                if (LoopData::CORK_BUFFER_SIZE - s->offset >= (unsigned int) length) {
-                    /* If the entire chunk fits in cork buffer */
+                if (loopData->reserveCorkSlot(slot, s->offset + (unsigned int) length)) {
+                    /* If the entire chunk fits in cork buffer (growing it
+                     * onto a slab if need be) */
                     memcpy(s->buffer + s->offset, src, (unsigned int) length);
                     s->offset += (unsigned int) length;
-                    ASSERT(s->offset <= LoopData::CORK_BUFFER_SIZE);
+                    ASSERT(s->offset <= s->capacity);
                     loopData->touchCorkSlot(slot);
                     /* Fall through to default return */
                 } else {
@@ -395,6 +399,7 @@ public:
         loopData->releaseCorkSlot(slot);
 
         if (offset) {
+            loopData->recordCorkFlush(offset);
             /* Corked data is already accounted for via its write call */
             auto [written, failed] = write(buffer, (int) offset, false, length);
 
@@ -42,6 +42,12 @@
 #include "QueryParser.h"
 #include "HttpErrors.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #if defined(_WIN32)
 #define strncasecmp _strnicmp
 #endif
@@ -517,8 +523,8 @@ struct HttpResponseData;
             if (section.size() < 4) {
                 return 0;
             }
-            /* tryConsumeFieldValue stops at the 8-byte word CONTAINING the value's
-             * '\r', not at it, so its last load can reach 3 bytes past the final
+            /* tryConsumeFieldValue loads the 16 bytes starting at or before the
+             * value's '\r', so its last load can reach 11 bytes past the final
              * CRLF CRLF without this padding (the NULs stay past `end`). */
             size_t length = section.size();
             section.append(MINIMUM_HTTP_POST_PADDING, '\0');
@@ -657,6 +663,63 @@ struct HttpResponseData;
             return (( ((x)+~0ULL/255*(127-(n))) |(x))&~0ULL/255*128);
         }
 
+        /* The scanners below load 16 bytes at a time from a position at or before the
+         * post-padded sentinel, so they stay within MINIMUM_HTTP_POST_PADDING */
+        static_assert(MINIMUM_HTTP_POST_PADDING >= 16);
+
+        /* Index of the first of the 16 bytes at p that is below limit, or 16 */
+        static inline unsigned int firstByteBelow16(const char *p, unsigned char limit) {
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128i bytes = _mm_loadu_si128((const __m128i *) p);
+            /* Unsigned less-than: the byte is its own minimum with limit - 1 */
+            __m128i below = _mm_cmpeq_epi8(_mm_min_epu8(bytes, _mm_set1_epi8((char) (limit - 1))), bytes);
+            unsigned int mask = (unsigned int) _mm_movemask_epi8(below);
+            return mask ? (unsigned int) __builtin_ctz(mask) : 16;
+#elif defined(__ARM_NEON)
+            uint8x16_t below = vcltq_u8(vld1q_u8((const uint8_t *) p), vdupq_n_u8(limit));
+            /* Narrow each byte to a nibble of a 64-bit mask */
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(below), 4)), 0);
+            return mask ? (unsigned int) __builtin_ctzll(mask) / 4 : 16;
+#else
+            for (unsigned int i = 0; i < 16; i += 8) {
+                uint64_t word;
+                memcpy(&word, p + i, sizeof(uint64_t));
+                if (hasLess(word, limit)) {
+                    while ((unsigned char) p[i] >= limit) i++;
+                    return i;
+                }
+            }
+            return 16;
+#endif
+        }
+
+        /* Index of the first of the 16 bytes at p that is not an ASCII letter or hyphen, or 16 */
+        static inline unsigned int firstNonAlphaOrHyphen16(const char *p) {
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128i bytes = _mm_loadu_si128((const __m128i *) p);
+            /* Folding case maps exactly the letters onto 'a'..'z' */
+            __m128i offset = _mm_sub_epi8(_mm_or_si128(bytes, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            __m128i alpha = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+            __m128i accepted = _mm_or_si128(alpha, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('-')));
+            unsigned int mask = ~(unsigned int) _mm_movemask_epi8(accepted) & 0xffff;
+            return mask ? (unsigned int) __builtin_ctz(mask) : 16;
+#elif defined(__ARM_NEON)
+            uint8x16_t bytes = vld1q_u8((const uint8_t *) p);
+            uint8x16_t offset = vsubq_u8(vorrq_u8(bytes, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+            uint8x16_t accepted = vorrq_u8(vcleq_u8(offset, vdupq_n_u8(25)), vceqq_u8(bytes, vdupq_n_u8('-')));
+            uint64_t mask = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(accepted), 4)), 0);
+            return mask ? (unsigned int) __builtin_ctzll(mask) / 4 : 16;
+#else
+            for (unsigned int i = 0; i < 16; i++) {
+                unsigned char c = (unsigned char) p[i];
+                if (!((((c | 0x20) >= 'a') & ((c | 0x20) <= 'z')) | (c == '-'))) {
+                    return i;
+                }
+            }
+            return 16;
+#endif
+        }
+
         static inline uint64_t hasBetween(uint64_t x, uint64_t m, uint64_t n) {
             return (( (~0ULL/255*(127+(n))-((x)&~0ULL/255*127)) &~(x)& (((x)&~0ULL/255*127)+~0ULL/255*(127-(m))) )&~0ULL/255*128);
         }
@@ -695,24 +758,17 @@ struct HttpResponseData;
         }
 
         static inline char *consumeFieldName(char *p) {
-            /* Best case fast path (particularly useful with clang) */
+            /* Best case fast path: letters and hyphens, 16 bytes at a time */
             while (true) {
-                while ((*p >= 65) & (*p <= 90)) [[likely]] {
-                    p++;
-                }
-                while (((*p >= 97) & (*p <= 122))) [[likely]] {
-                    p++;
-                }
-                if (*p == ':') {
-                    return p;
-                }
-                if (*p == '-') {
-                    p++;
-                } else if (!((*p >= 65) & (*p <= 90))) {
-                    /* Exit fast path parsing */
+                unsigned int length = firstNonAlphaOrHyphen16(p);
+                p += length;
+                if (length < 16) [[likely]] {
                     break;
                 }
             }
+            if (*p == ':') [[likely]] {
+                return p;
+            }
 
             /* Generic */
             while (isFieldNameByte(*(unsigned char *)p)) {
@@ -852,14 +908,13 @@ struct HttpResponseData;
                 }
                 /* Scan for less than 33 (catches post padded CR and fails) */
                 start = data;
-                for (; true; data += 8) {
-                    uint64_t word;
-                    memcpy(&word, data, sizeof(uint64_t));
+                for (; true; data += 16) {
                     if(maxHeaderSize && (uintptr_t)(data - start) > maxHeaderSize) {
                         return ConsumeRequestLineResult::error(HTTP_HEADER_PARSER_ERROR_REQUEST_HEADER_FIELDS_TOO_LARGE);
                     }
-                    if (hasLess(word, 33)) {
-                        while (*(unsigned char *)data > 32) data++;
+                    unsigned int length = firstByteBelow16(data, 33);
+                    if (length < 16) {
+                        data += length;
                         if(maxHeaderSize && (uintptr_t)(data - start) > maxHeaderSize) {
                             return ConsumeRequestLineResult::error(HTTP_HEADER_PARSER_ERROR_REQUEST_HEADER_FIELDS_TOO_LARGE);
                         }
@@ -927,12 +982,10 @@ struct HttpResponseData;
         * Field values containing CR, LF, or NUL characters are invalid and dangerous [...]
         * Field values containing other CTL characters are also invalid. */
         static inline char * tryConsumeFieldValue(char *p) {
-            for (; true; p += 8) {
-                uint64_t word;
-                memcpy(&word, p, sizeof(uint64_t));
-                if (hasLess(word, 32)) {
-                    while (*(unsigned char *)p > 31) p++;
-                    return p;
+            for (; true; p += 16) {
+                unsigned int length = firstByteBelow16(p, 32);
+                if (length < 16) {
+                    return p + length;
                 }
             }
         }
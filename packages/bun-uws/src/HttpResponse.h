@@ -549,6 +549,14 @@ public:
         return this;
     }
 
+    /* Write already serialized "key: value\r\n" header lines in one go */
+    HttpResponse *writeHeaderBlock(std::string_view block) {
+        writeStatus(HTTP_200_OK);
+
+        Super::write(block.data(), (int) block.length());
+        return this;
+    }
+
     /* Write an HTTP header with unsigned int value */
     HttpResponse *writeHeader(std::string_view key, uint64_t value) {
         writeStatus(HTTP_200_OK);
@@ -27,6 +27,8 @@
 #include <memory>
 #include <utility>
 #include <span>
+#include <bit>
+#include <cstdint>
 
 #include "MoveOnlyFunction.h"
 
@@ -62,6 +64,43 @@ private:
         explicit constexpr Node(std::string name) noexcept : name(std::move(name)) {}
     } root {"rootNode"};
 
+    /* Read-only, flat copy of the matching tree which route() walks. It is rebuilt on the
+     * first route() after add() or remove(), so once an app stops registering routes (at
+     * listen) it is built exactly once. Children of a node are contiguous, every run of
+     * static siblings is sorted for binary search, and chains of static nodes that have no
+     * handlers and a single static child are merged into one node spanning several URL
+     * segments */
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
+    enum NodeKind : uint8_t { STATIC_NODE, PARAMETER_NODE, WILDCARD_NODE };
+    struct CompiledNode {
+        /* Name in compiledNames, segments joined by '/' when merged */
+        uint32_t name = 0, nameLength = 0, firstSegmentLength = 0;
+        uint32_t segments = 1;
+        uint32_t firstChild = 0, childCount = 0;
+        uint32_t firstHandler = 0, handlerCount = 0;
+        /* Length of the sorted run of static siblings starting at this node */
+        uint32_t staticRun = 0;
+        NodeKind kind = STATIC_NODE;
+        bool isHighPriority = false;
+    };
+    std::vector<CompiledNode> compiledNodes;
+    std::string compiledNames;
+    std::vector<uint32_t> compiledHandlers;
+    bool compiledIsStale = true;
+    /* The node whose handlers route() already ran from the static table */
+    uint32_t skipNode = NO_NODE;
+
+    /* Perfect hash (hash and displace) of the fully static routes that a tree walk would
+     * reach before anything else, keyed by method node and URL */
+    struct StaticRoute {
+        uint64_t hash = 0;
+        uint32_t method = NO_NODE, node = NO_NODE;
+        uint32_t path = 0, pathLength = 0;
+    };
+    std::vector<StaticRoute> staticRoutes;
+    std::vector<uint32_t> staticSeeds;
+    std::string staticPaths;
+
     /* Sort wildcards after alphanum */
     int lexicalOrder(std::string_view name) {
         if (name.empty()) {
@@ -162,46 +201,301 @@ private:
         return {urlSegmentVector[urlSegment], false};
     }
 
-    /* Executes as many handlers it can */
-    bool executeHandlers(Node *parent, int urlSegment, UserDataType &userData) {
+    std::string_view compiledName(const CompiledNode &node) {
+        return std::string_view(compiledNames).substr(node.name, node.nameLength);
+    }
 
-        auto [segment, isStop] = getUrlSegment(urlSegment);
+    bool executeNodeHandlers(const CompiledNode &node) {
+        for (uint32_t i = node.firstHandler; i < node.firstHandler + node.handlerCount; i++) {
+            if (handlers[compiledHandlers[i] & HANDLER_MASK](this)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* Executes as many handlers it can. We stand on the slash at position, which is
+     * urlSegment segments into currentUrl */
+    bool executeHandlers(uint32_t parentIndex, size_t position, uint32_t urlSegment) {
+        const CompiledNode &parent = compiledNodes[parentIndex];
 
         /* If we are on STOP, return where we may stand */
-        if (isStop) {
+        if (position >= currentUrl.length() || urlSegment > MAX_URL_SEGMENTS - 1) {
             /* We have reached accross the entire URL with no stoppage, execute */
-            for (uint32_t handler : parent->handlers) {
-                if (handlers[handler & HANDLER_MASK](this)) {
+            return parentIndex != skipNode && executeNodeHandlers(parent);
+        }
+
+        /* We always stand on a slash here, so step over it */
+        size_t segmentStart = position + 1;
+        size_t segmentEnd = currentUrl.find('/', segmentStart);
+        if (segmentEnd == std::string_view::npos) {
+            segmentEnd = currentUrl.length();
+        }
+        std::string_view segment = currentUrl.substr(segmentStart, segmentEnd - segmentStart);
+
+        for (uint32_t i = parent.firstChild; i < parent.firstChild + parent.childCount; ) {
+            const CompiledNode &p = compiledNodes[i];
+            if (p.kind == WILDCARD_NODE) {
+                /* Wildcard match (can be seen as a shortcut) */
+                if (executeNodeHandlers(p)) {
                     return true;
                 }
+                i++;
+            } else if (p.kind == PARAMETER_NODE) {
+                /* Parameter match */
+                if (!segment.empty()) {
+                    routeParameters.push(segment);
+                    if (executeHandlers(i, segmentEnd, urlSegment + 1)) {
+                        return true;
+                    }
+                    routeParameters.pop();
+                }
+                i++;
+            } else {
+                /* Static match, names are unique within a run */
+                uint32_t runEnd = i + p.staticRun;
+                auto match = std::lower_bound(compiledNodes.begin() + i, compiledNodes.begin() + runEnd, segment, [this](const CompiledNode &a, std::string_view b) {
+                    return compiledName(a).substr(0, a.firstSegmentLength) < b;
+                });
+                if (match != compiledNodes.begin() + runEnd && compiledName(*match).substr(0, match->firstSegmentLength) == segment) {
+                    uint32_t matchIndex = (uint32_t) (match - compiledNodes.begin());
+                    size_t matchEnd = segmentEnd;
+                    bool matches = true;
+                    if (match->segments > 1) {
+                        /* A merged node must match all of its segments, within the segment limit */
+                        std::string_view name = compiledName(*match);
+                        matchEnd = segmentStart + name.length();
+                        matches = urlSegment + match->segments <= MAX_URL_SEGMENTS && currentUrl.substr(segmentStart, name.length()) == name &&
+                            (matchEnd == currentUrl.length() || currentUrl[matchEnd] == '/');
+                    }
+                    if (matches && executeHandlers(matchIndex, matchEnd, urlSegment + match->segments)) {
+                        return true;
+                    }
+                }
+                i = runEnd;
             }
-            /* We reached the end, so go back */
-            return false;
         }
+        return false;
+    }
 
-        for (auto &p : parent->children) {
-            if (p->name.starts_with('*')) {
-                /* Wildcard match (can be seen as a shortcut) */
-                for (uint32_t handler : p->handlers) {
-                    if (handlers[handler & HANDLER_MASK](this)) {
-                        return true;
+    static constexpr uint64_t mixHash(uint64_t h) {
+        /* Murmur3 finalizer */
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static uint64_t hashStaticRoute(uint32_t method, std::string_view url) {
+        /* FNV-1a */
+        uint64_t h = 0xcbf29ce484222325ull ^ (method * 0x9e3779b97f4a7c15ull);
+        for (unsigned char c : url) {
+            h = (h ^ c) * 0x100000001b3ull;
+        }
+        return mixHash(h);
+    }
+
+    static constexpr size_t staticSlot(uint64_t hash, uint32_t seed, size_t slots) {
+        return mixHash(hash ^ (seed * 0x9e3779b97f4a7c15ull)) & (slots - 1);
+    }
+
+    /* Returns the node of the static route for this method and URL, or NO_NODE */
+    uint32_t findStaticRoute(uint32_t method, std::string_view url) {
+        if (staticRoutes.empty()) {
+            return NO_NODE;
+        }
+        uint64_t hash = hashStaticRoute(method, url);
+        const StaticRoute &route = staticRoutes[staticSlot(hash, staticSeeds[hash & (staticSeeds.size() - 1)], staticRoutes.size())];
+        if (route.hash == hash && route.method == method && std::string_view(staticPaths).substr(route.path, route.pathLength) == url) {
+            return route.node;
+        }
+        return NO_NODE;
+    }
+
+    /* Places every route in a slot of its own, displacing the largest buckets first.
+     * Returns false if some bucket found no seed, the caller then grows the table */
+    bool placeStaticRoutes(std::vector<StaticRoute> &routes, size_t slotCount) {
+        size_t bucketCount = std::bit_ceil(std::max<size_t>(1, routes.size() / 4));
+        std::vector<std::vector<uint32_t>> buckets(bucketCount);
+        for (uint32_t i = 0; i < routes.size(); i++) {
+            buckets[routes[i].hash & (bucketCount - 1)].push_back(i);
+        }
+        std::vector<uint32_t> order(bucketCount);
+        for (uint32_t i = 0; i < bucketCount; i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&buckets](uint32_t a, uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        staticRoutes.assign(slotCount, StaticRoute{});
+        staticSeeds.assign(bucketCount, 0);
+        std::vector<size_t> slots;
+        for (uint32_t bucket : order) {
+            if (buckets[bucket].empty()) {
+                break;
+            }
+            uint32_t seed = 0;
+            for (;; seed++) {
+                if (seed == 1 << 16) {
+                    return false;
+                }
+                slots.clear();
+                bool fits = true;
+                for (uint32_t route : buckets[bucket]) {
+                    size_t slot = staticSlot(routes[route].hash, seed, slotCount);
+                    if (staticRoutes[slot].node != NO_NODE || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                        fits = false;
+                        break;
                     }
+                    slots.push_back(slot);
                 }
-            } else if (p->name.starts_with(':') && !segment.empty()) {
-                /* Parameter match */
-                routeParameters.push(segment);
-                if (executeHandlers(p.get(), urlSegment + 1, userData)) {
-                    return true;
+                if (fits) {
+                    break;
                 }
-                routeParameters.pop();
-            } else if (p->name == segment) {
-                /* Static match */
-                if (executeHandlers(p.get(), urlSegment + 1, userData)) {
-                    return true;
+            }
+            staticSeeds[bucket] = seed;
+            for (unsigned int i = 0; i < slots.size(); i++) {
+                staticRoutes[slots[i]] = routes[buckets[bucket][i]];
+            }
+        }
+        return true;
+    }
+
+    void buildStaticRoutes(std::vector<StaticRoute> &routes) {
+        staticRoutes.clear();
+        staticSeeds.clear();
+        if (routes.empty()) {
+            return;
+        }
+        /* Load factor between 0.4 and 0.8; a few doublings cover even identical hashes */
+        size_t slotCount = std::bit_ceil(routes.size() + routes.size() / 4 + 1);
+        for (int attempt = 0; attempt < 3; attempt++, slotCount *= 2) {
+            if (placeStaticRoutes(routes, slotCount)) {
+                return;
+            }
+        }
+        /* Give up on the table, the tree walk alone is still correct */
+        staticRoutes.clear();
+        staticSeeds.clear();
+    }
+
+    static NodeKind nodeKind(std::string_view name) {
+        if (name.starts_with('*')) {
+            return WILDCARD_NODE;
+        }
+        if (name.starts_with(':')) {
+            return PARAMETER_NODE;
+        }
+        return STATIC_NODE;
+    }
+
+    /* Lays out the children of node as compiledNodes[index]'s children, then recurses. The
+     * path of a node is a static route key as long as the tree walk reaches it first */
+    void compileChildren(Node *node, uint32_t index, bool isRoot, uint32_t method, const std::string &path, bool isFirst, uint32_t depth, std::vector<StaticRoute> &routes) {
+        uint32_t firstChild = (uint32_t) compiledNodes.size();
+        uint32_t childCount = (uint32_t) node->children.size();
+        compiledNodes[index].firstChild = firstChild;
+        compiledNodes[index].childCount = childCount;
+        compiledNodes.resize(firstChild + childCount);
+
+        struct Child {
+            Node *tail;
+            std::string name;
+            uint32_t segments;
+            NodeKind kind;
+            bool isHighPriority;
+            bool isFirst;
+        };
+        std::vector<Child> children;
+        children.reserve(childCount);
+        for (uint32_t i = 0; i < childCount; i++) {
+            Node *child = node->children[i].get();
+            Child c {child, child->name, 1, isRoot ? STATIC_NODE : nodeKind(child->name), child->isHighPriority, isFirst && !isRoot};
+            if (c.kind == STATIC_NODE && !isRoot) {
+                /* Merge the chain, the walk can only leave it at its end */
+                while (c.tail->handlers.empty() && c.tail->children.size() == 1 && nodeKind(c.tail->children[0]->name) == STATIC_NODE) {
+                    c.tail = c.tail->children[0].get();
+                    c.name += '/';
+                    c.name += c.tail->name;
+                    c.segments++;
+                }
+                /* Reached first only if every earlier sibling is a static node that cannot match */
+                for (uint32_t j = 0; j < i && c.isFirst; j++) {
+                    const std::string &sibling = node->children[j]->name;
+                    c.isFirst = nodeKind(sibling) == STATIC_NODE && sibling != child->name;
                 }
+            } else {
+                c.isFirst = false;
             }
+            children.push_back(std::move(c));
         }
-        return false;
+
+        /* Sort each run of static siblings of equal priority by first segment */
+        for (uint32_t i = 0; i < childCount; ) {
+            uint32_t runEnd = i + 1;
+            if (!isRoot && children[i].kind == STATIC_NODE) {
+                while (runEnd < childCount && children[runEnd].kind == STATIC_NODE && children[runEnd].isHighPriority == children[i].isHighPriority) {
+                    runEnd++;
+                }
+                std::sort(children.begin() + i, children.begin() + runEnd, [](const Child &a, const Child &b) {
+                    return std::string_view(a.name).substr(0, a.name.find('/')) < std::string_view(b.name).substr(0, b.name.find('/'));
+                });
+            }
+            compiledNodes[firstChild + i].staticRun = runEnd - i;
+            i = runEnd;
+        }
+
+        for (uint32_t i = 0; i < childCount; i++) {
+            Child &c = children[i];
+            CompiledNode &compiled = compiledNodes[firstChild + i];
+            compiled.name = (uint32_t) compiledNames.length();
+            compiled.nameLength = (uint32_t) c.name.length();
+            compiled.firstSegmentLength = (uint32_t) std::min(c.name.find('/'), c.name.length());
+            compiled.segments = c.segments;
+            compiled.kind = c.kind;
+            compiled.isHighPriority = c.isHighPriority;
+            compiled.firstHandler = (uint32_t) compiledHandlers.size();
+            compiled.handlerCount = (uint32_t) c.tail->handlers.size();
+            compiledNames += c.name;
+            compiledHandlers.insert(compiledHandlers.end(), c.tail->handlers.begin(), c.tail->handlers.end());
+        }
+
+        for (uint32_t i = 0; i < childCount; i++) {
+            Child &c = children[i];
+            uint32_t childIndex = firstChild + i;
+            uint32_t childMethod = isRoot ? childIndex : method;
+            uint32_t childDepth = isRoot ? 0 : depth + c.segments;
+            std::string childPath = isRoot ? std::string() : path + "/" + c.name;
+            bool childIsFirst = (isRoot || c.isFirst) && childDepth <= MAX_URL_SEGMENTS;
+            if (!isRoot && childIsFirst && !c.tail->handlers.empty()) {
+                routes.push_back({hashStaticRoute(childMethod, childPath), childMethod, childIndex, (uint32_t) staticPaths.length(), (uint32_t) childPath.length()});
+                staticPaths += childPath;
+            }
+            compileChildren(c.tail, childIndex, false, childMethod, childPath, childIsFirst, childDepth, routes);
+        }
+    }
+
+    void compile() {
+        compiledNodes.assign(1, CompiledNode{});
+        compiledNames.clear();
+        compiledHandlers.clear();
+        staticPaths.clear();
+        std::vector<StaticRoute> routes;
+        compileChildren(&root, 0, true, NO_NODE, std::string(), true, 0, routes);
+        buildStaticRoutes(routes);
+        compiledIsStale = false;
+    }
+
+    /* Routes the URL under one method node, trying its static route first */
+    bool routeMethod(uint32_t method) {
+        skipNode = findStaticRoute(method, currentUrl);
+        if (skipNode != NO_NODE && executeNodeHandlers(compiledNodes[skipNode])) {
+            return true;
+        }
+        return executeHandlers(method, 0, 0);
     }
 
     /* Scans for one matching handler, returning the handler and its priority or UINT32_MAX for not found */
@@ -253,15 +547,19 @@ public:
 
     /* Fast path */
     bool route(std::string_view method, std::string_view url) {
-        /* Reset url parsing cache */
-        setUrl(url);
+        if (compiledIsStale) [[unlikely]] {
+            compile();
+        }
+
+        currentUrl = url;
         routeParameters.reset();
 
         /* Begin by finding the method node */
-        for (auto &p : root.children) {
-            if (p->name == method) {
+        const CompiledNode &compiledRoot = compiledNodes[0];
+        for (uint32_t i = compiledRoot.firstChild; i < compiledRoot.firstChild + compiledRoot.childCount; i++) {
+            if (compiledName(compiledNodes[i]) == method) {
                 /* Then route the url */
-                if (executeHandlers(p.get(), 0, userData)) {
+                if (routeMethod(i)) {
                     return true;
                 } else {
                     break;
@@ -270,10 +568,10 @@ public:
         }
 
         /* Always test any route last (this check should not be necessary if we always have at least one handler) */
-        if (root.children.empty()) [[unlikely]] {
+        if (!compiledRoot.childCount) [[unlikely]] {
             return false;
         }
-        return executeHandlers(root.children.back().get(), 0, userData);
+        return routeMethod(compiledRoot.firstChild + compiledRoot.childCount - 1);
     }
 
     /* Adds the corresponding entires in matching tree and handler list */
@@ -301,6 +599,7 @@ public:
 
         /* Alloate this handler */
         handlers.emplace_back(std::move(handler));
+        compiledIsStale = true;
 
         /* ANY method must be last, GET must be first */
         std::sort(root.children.begin(), root.children.end(), [](const auto &a, const auto &b) {
@@ -373,6 +672,7 @@ public:
 
         /* Now remove the actual handler */
         handlers.erase(handlers.begin() + (handler & HANDLER_MASK));
+        compiledIsStale = true;
 
         return true;
     }
@@ -53,8 +53,8 @@ private:
             p.second((Loop *) loop);
         }
 
-        /* Drain any leftover corks. Two slots max. */
-        for (int i = 0; i < 2; i++) {
+        /* Drain any leftover corks, at most one per slot. */
+        for (size_t i = 0, slots = loopData->getCorkSlotCount(); i < slots; i++) {
             bool ssl;
             void *corkedSocket = loopData->getAnyCorkedSocket(&ssl);
             if (!corkedSocket) break;
@@ -64,6 +64,7 @@ private:
                 ((uWS::AsyncSocket<false> *) corkedSocket)->uncork();
             }
         }
+        loopData->trimCorkSlots();
     }
 
     static void postCb(us_loop_t *loop) {
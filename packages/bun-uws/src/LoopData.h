@@ -19,6 +19,7 @@
 #define UWS_LOOPDATA_H
 
 #include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <functional>
 #include <map>
@@ -47,30 +48,100 @@ private:
     /* Map from void ptr to handler */
     std::map<void *, MoveOnlyFunction<void(Loop *)>> postHandlers, preHandlers;
 
-    /* Cork data: two independent slots so a nested cork (e.g. a resumed async
-     * request writing while the outer request is still corked) doesn't force
-     * the outer socket down the uncorked slow path. cork() grabs whichever
-     * slot is free; uncork() releases the slot you're in. No ordering. */
+    /* Cork data: a pool of independent slots, so a socket corking while
+     * others are still corked gets its own buffer instead of forcing them
+     * down the uncorked slow path. HttpResponse::cork() and the HttpContext
+     * data handler uncork as soon as their handler returns, so Bun.serve
+     * rarely holds more than two at once. cork() grabs a free slot and
+     * adds one while the pool is under MAX_CORK_SLOTS; only a full pool
+     * force-uncorks its LRU victim. uncork() releases the slot you're in. No
+     * ordering. The pool is trimmed back one slot per tick once fewer
+     * sockets cork at a time (trimCorkSlots). */
     struct CorkSlot {
+        /* Where corked bytes go: `base` (CORK_BUFFER_SIZE), or a slab of
+         * CORK_SLAB_SIZE while a response is too big for it. */
         char *buffer = nullptr;
+        char *base = nullptr;
         void *socket = nullptr;
         unsigned int offset = 0;
+        unsigned int capacity = 0;
+        /* corkClock at the last write; the smallest one is the LRU victim. */
+        uint64_t touched = 0;
         unsigned int ssl : 1 = 0;
     };
 
-    CorkSlot corkSlots[2];
+    /* Reserved to MAX_CORK_SLOTS up front so growing never moves a slot out
+     * from under a CorkSlot pointer held across acquireCorkSlot. */
+    std::vector<CorkSlot> corkSlots;
 
-    /* 1 = slot 1 was touched most recently, 0 = slot 0. Used to pick the LRU
-     * victim when both slots have data and we must force-uncork one. */
-    unsigned int lastTouchedSlot1 : 1 = 0;
+    /* Spare slabs, so back-to-back large responses don't hit the allocator. */
+    std::vector<char *> corkSlabs;
+
+    uint64_t corkClock = 0;
+
+    /* Slots holding a socket right now, and the most at once since the last
+     * trimCorkSlots. */
+    unsigned int corkSlotsInUse = 0;
+    unsigned int corkSlotsInUsePeak = 0;
+
+    void addCorkSlot() {
+        CorkSlot &s = corkSlots.emplace_back();
+        s.buffer = s.base = new char[CORK_BUFFER_SIZE];
+        s.capacity = CORK_BUFFER_SIZE;
+    }
+
+    /* Hand a slot's slab back and return it to its base buffer. Only done
+     * to slots nobody is corked in, and never from releaseCorkSlot: uncork()
+     * still writes from the old buffer after releasing it. */
+    void dropCorkSlab(CorkSlot &s) {
+        if (s.buffer == s.base) return;
+        if (corkSlabs.size() < MAX_SPARE_CORK_SLABS) {
+            corkSlabs.push_back(s.buffer);
+        } else {
+            delete [] s.buffer;
+        }
+        s.buffer = s.base;
+        s.capacity = CORK_BUFFER_SIZE;
+    }
+
+    int findFreeCorkSlot() {
+        for (size_t i = 0; i < corkSlots.size(); i++) {
+            if (corkSlots[i].socket == nullptr) return (int) i;
+        }
+        return INVALID_CORK_SLOT;
+    }
+
+    /* A borrowed-but-unwritten slot (offset == 0) we can steal without
+     * flushing. */
+    int findEmptyCorkSlot() {
+        for (size_t i = 0; i < corkSlots.size(); i++) {
+            if (corkSlots[i].offset == 0) return (int) i;
+        }
+        return INVALID_CORK_SLOT;
+    }
 
 public:
     /* INVALID_CORK_SLOT means "not corked with us". */
     static constexpr int INVALID_CORK_SLOT = -1;
 
+    /* Counters for sizing the cork pool, read through uws_loop_cork_stats. */
+    struct CorkStats {
+        /* Sockets force-uncorked because every slot held data. */
+        uint64_t evictions = 0;
+        /* Uncorks that had data, and how many bytes they handed to the socket. */
+        uint64_t flushes = 0;
+        uint64_t flushedBytes = 0;
+        /* Flushes that had outgrown CORK_BUFFER_SIZE into a slab. */
+        uint64_t slabFlushes = 0;
+        /* Current pool size, and the most slots ever held at once. */
+        uint64_t slots = 0;
+        uint64_t peakSlots = 0;
+    };
+
     LoopData() {
-        corkSlots[0].buffer = new char[CORK_BUFFER_SIZE];
-        corkSlots[1].buffer = new char[CORK_BUFFER_SIZE];
+        corkSlots.reserve(MAX_CORK_SLOTS);
+        addCorkSlot();
+        addCorkSlot();
         updateDate();
     }
 
@@ -81,55 +152,90 @@ public:
             delete inflationStream;
             delete deflationStream;
         }
-        delete [] corkSlots[0].buffer;
-        delete [] corkSlots[1].buffer;
+        for (CorkSlot &s : corkSlots) {
+            if (s.buffer != s.base) delete [] s.buffer;
+            delete [] s.base;
+        }
+        for (char *slab : corkSlabs) {
+            delete [] slab;
+        }
     }
 
     /* Returns the slot index this socket is corked in, or INVALID_CORK_SLOT. */
     int findCorkSlot(void *socket) {
-        if (corkSlots[0].socket == socket) return 0;
-        if (corkSlots[1].socket == socket) return 1;
-        return INVALID_CORK_SLOT;
-    }
-
-    /* Returns a slot we can borrow: prefers a free slot, falls back to a
-     * borrowed-but-unwritten slot (offset == 0) that we can steal without
-     * flushing. Returns INVALID_CORK_SLOT only if both slots hold data. */
-    int findBorrowableCorkSlot() {
-        if (corkSlots[0].socket == nullptr) return 0;
-        if (corkSlots[1].socket == nullptr) return 1;
-        if (corkSlots[0].offset == 0) return 0;
-        if (corkSlots[1].offset == 0) return 1;
+        for (size_t i = 0; i < corkSlots.size(); i++) {
+            if (corkSlots[i].socket == socket) return (int) i;
+        }
         return INVALID_CORK_SLOT;
     }
 
-    /* Borrow a slot for this socket. Returns the slot index, or
-     * INVALID_CORK_SLOT if both slots have data that must be flushed. */
+    /* Borrow a slot for this socket: a free one, then a new one while the
+     * pool can grow, then an unwritten one stolen from another socket.
+     * Returns INVALID_CORK_SLOT only if the pool is full and every slot
+     * holds data that must be flushed. */
     int acquireCorkSlot(void *socket, bool ssl) {
-        int slot = findBorrowableCorkSlot();
+        int slot = findFreeCorkSlot();
+        if (slot == INVALID_CORK_SLOT && corkSlots.size() < MAX_CORK_SLOTS) {
+            addCorkSlot();
+            slot = (int) corkSlots.size() - 1;
+        }
         if (slot != INVALID_CORK_SLOT) {
-            corkSlots[slot].socket = socket;
-            corkSlots[slot].ssl = ssl;
-            corkSlots[slot].offset = 0;
-            lastTouchedSlot1 = (slot == 1);
+            if (++corkSlotsInUse > corkSlotsInUsePeak) {
+                corkSlotsInUsePeak = corkSlotsInUse;
+                if (corkSlotsInUsePeak > corkStats.peakSlots) corkStats.peakSlots = corkSlotsInUsePeak;
+            }
+        } else {
+            slot = findEmptyCorkSlot();
+            if (slot == INVALID_CORK_SLOT) return slot;
         }
+        CorkSlot &s = corkSlots[slot];
+        dropCorkSlab(s);
+        s.socket = socket;
+        s.ssl = ssl;
+        s.offset = 0;
+        s.touched = ++corkClock;
         return slot;
     }
 
+    /* Make room for `size` corked bytes in total, moving the slot onto a
+     * slab if it outgrows its base buffer. Fails only past CORK_SLAB_SIZE. */
+    bool reserveCorkSlot(int slot, unsigned int size) {
+        CorkSlot &s = corkSlots[slot];
+        if (size <= s.capacity) return true;
+        if (size > CORK_SLAB_SIZE) return false;
+        char *slab;
+        if (corkSlabs.empty()) {
+            slab = new char[CORK_SLAB_SIZE];
+        } else {
+            slab = corkSlabs.back();
+            corkSlabs.pop_back();
+        }
+        memcpy(slab, s.buffer, s.offset);
+        s.buffer = slab;
+        s.capacity = CORK_SLAB_SIZE;
+        return true;
+    }
+
     /* Mark a slot as recently used. Call when writing into it so LRU eviction
-     * picks the other slot. */
+     * picks another slot. */
     void touchCorkSlot(int slot) {
-        lastTouchedSlot1 = (slot == 1);
+        corkSlots[slot].touched = ++corkClock;
     }
 
     /* Returns the least-recently-used slot index for force-uncork eviction. */
     int getLRUCorkSlot() {
-        return lastTouchedSlot1 ? 0 : 1;
+        int lru = 0;
+        for (size_t i = 1; i < corkSlots.size(); i++) {
+            if (corkSlots[i].touched < corkSlots[lru].touched) lru = (int) i;
+        }
+        return lru;
     }
 
-    /* Release a slot. */
+    /* Release a slot. Its buffer stays valid until the slot is acquired
+     * again. */
     void releaseCorkSlot(int slot) {
-        ASSERT(slot == 0 || slot == 1);
+        ASSERT(slot >= 0 && slot < (int) corkSlots.size());
+        if (corkSlots[slot].socket) corkSlotsInUse--;
         corkSlots[slot].socket = nullptr;
         corkSlots[slot].offset = 0;
     }
@@ -137,36 +243,75 @@ public:
     /* Transfer ownership of a slot to a new socket (used during WebSocket
      * upgrade to hand the HTTP socket's cork buffer to the new WebSocket). */
     void transferCorkSlot(int slot, void *socket, bool ssl) {
-        ASSERT(slot == 0 || slot == 1);
+        ASSERT(slot >= 0 && slot < (int) corkSlots.size());
         corkSlots[slot].socket = socket;
         corkSlots[slot].ssl = ssl;
     }
 
     CorkSlot *getCorkSlot(int slot) {
-        ASSERT(slot == 0 || slot == 1);
+        ASSERT(slot >= 0 && slot < (int) corkSlots.size());
         return &corkSlots[slot];
     }
 
     bool canCork() {
-        return findBorrowableCorkSlot() != INVALID_CORK_SLOT;
+        return corkSlots.size() < MAX_CORK_SLOTS || findFreeCorkSlot() != INVALID_CORK_SLOT ||
+            findEmptyCorkSlot() != INVALID_CORK_SLOT;
     }
 
     /* Remove this socket from any cork slot it occupies. Must be called from
      * socket close/destroy paths to avoid leaving a dangling pointer that the
      * drain loop would later dereference. */
     void unborrowCorkSlot(void *socket) {
-        if (corkSlots[0].socket == socket) { corkSlots[0].socket = nullptr; corkSlots[0].offset = 0; }
-        if (corkSlots[1].socket == socket) { corkSlots[1].socket = nullptr; corkSlots[1].offset = 0; }
+        int slot = findCorkSlot(socket);
+        if (slot != INVALID_CORK_SLOT) releaseCorkSlot(slot);
     }
 
-    /* Legacy accessor for drain loops: returns any corked socket (slot 0 first)
-     * so the caller can uncork it. Returns nullptr if both slots are empty. */
+    /* Accessor for drain loops: returns any corked socket (lowest slot first)
+     * so the caller can uncork it. Returns nullptr if every slot is empty. */
     void *getAnyCorkedSocket(bool *outSsl) {
-        if (corkSlots[0].socket) { *outSsl = corkSlots[0].ssl; return corkSlots[0].socket; }
-        if (corkSlots[1].socket) { *outSsl = corkSlots[1].ssl; return corkSlots[1].socket; }
+        for (CorkSlot &s : corkSlots) {
+            if (s.socket) { *outSsl = s.ssl; return s.socket; }
+        }
         return nullptr;
     }
 
+    size_t getCorkSlotCount() {
+        return corkSlots.size();
+    }
+
+    /* Called once per tick after the leftover corks are drained: frees one
+     * idle slot while the pool is bigger than this tick's peak needed, and
+     * hands idle slots' slabs back. */
+    void trimCorkSlots() {
+        unsigned int target = corkSlotsInUsePeak > MIN_CORK_SLOTS ? corkSlotsInUsePeak : MIN_CORK_SLOTS;
+        if (corkSlots.size() > target && corkSlots.back().socket == nullptr) {
+            CorkSlot &s = corkSlots.back();
+            if (s.buffer != s.base) delete [] s.buffer;
+            delete [] s.base;
+            corkSlots.pop_back();
+        }
+        for (CorkSlot &s : corkSlots) {
+            if (s.socket == nullptr) dropCorkSlab(s);
+        }
+        corkSlotsInUsePeak = corkSlotsInUse;
+    }
+
+    void recordCorkEviction() {
+        corkStats.evictions++;
+    }
+
+    void recordCorkFlush(unsigned int bytes) {
+        corkStats.flushes++;
+        corkStats.flushedBytes += bytes;
+        if (bytes > CORK_BUFFER_SIZE) corkStats.slabFlushes++;
+    }
+
+    CorkStats getCorkStats() {
+        CorkStats stats = corkStats;
+        stats.slots = corkSlots.size();
+        return stats;
+    }
+
     void updateDate() {
         time_t now = time(0);
         struct tm tstruct = {};
@@ -200,6 +345,17 @@ public:
     /* Good 16k for SSL perf. */
     static constexpr unsigned int CORK_BUFFER_SIZE = 16 * 1024;
 
+    /* A response that outgrows CORK_BUFFER_SIZE moves onto a slab of this
+     * size, so headers and a body up to it still go out in one write. */
+    static constexpr unsigned int CORK_SLAB_SIZE = 64 * 1024;
+
+    /* The pool starts at (and never trims below) MIN_CORK_SLOTS slots. */
+    static constexpr unsigned int MIN_CORK_SLOTS = 2;
+    static constexpr unsigned int MAX_CORK_SLOTS = 64;
+    static constexpr unsigned int MAX_SPARE_CORK_SLABS = 4;
+
+    CorkStats corkStats;
+
     /* Per message deflate data */
     ZlibContext *zlibContext = nullptr;
     InflationStream *inflationStream = nullptr;
@@ -27,11 +27,19 @@
 #include <functional>
 #include <set>
 #include <string>
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
 
 namespace uWS {
 
 struct Subscriber;
 
+/* Every published message gets a tree-wide, strictly increasing sequence number.
+ * A Subscriber only remembers the sequence number of the last message it saw,
+ * which is enough to merge the logs of all its topics back into publish order. */
+using MessageSequence = uint64_t;
+
 struct Topic : std::unordered_set<Subscriber *> {
 
     Topic(std::string_view topic) : name(topic) {
@@ -39,6 +47,16 @@ struct Topic : std::unordered_set<Subscriber *> {
     }
 
     std::string name;
+
+private:
+    template <typename, typename> friend struct TopicTree;
+
+    /* Intrusive links into TopicTree::dirtyTopics, only valid while hasPendingMessages */
+    Topic *prevDirty = nullptr, *nextDirty = nullptr;
+    bool hasPendingMessages = false;
+
+    /* Sequence number of the newest message in our log */
+    MessageSequence lastPublished = 0;
 };
 
 struct Subscriber {
@@ -49,15 +67,13 @@ private:
     /* We use a factory */
     Subscriber() = default;
 
-    /* State of prev, next does not matter unless we are needsDrainage() since we are not in the list */
-    Subscriber *prev, *next;
+    /* Sequence number of the last message this subscriber was handed (or chose to skip).
+     * Anything newer in any of our topics' logs is pending for us. */
+    MessageSequence cursor = 0;
 
-    /* Any one subscriber can be part of at most 32 publishes before it needs a drain,
-     * or whatever encoding of runs or whatever we might do in the future */
-    uint16_t messageIndices[32];
-
-    /* This one matters the most, if it is 0 we are not in the list of drainableSubscribers */
-    unsigned char numMessageIndices = 0;
+    /* Sequence number of our last publish, so that freeSubscriber knows whether
+     * any pending message still names us as its sender */
+    MessageSequence lastPublished = 0;
 
 public:
 
@@ -66,10 +82,6 @@ public:
 
     /* User data */
     void *user;
-
-    bool needsDrainage() {
-        return numMessageIndices;
-    }
 };
 
 template <typename T, typename B>
@@ -89,8 +101,37 @@ struct TopicTree {
     /* Whomever is iterating this topic is locked to not modify its own list */
     Subscriber *iteratingSubscriber = nullptr;
 
+    /* A single topic may buffer this many messages within one loop iteration before
+     * its subscribers are drained early. Other topics are unaffected. */
+    static constexpr size_t MAX_PENDING_MESSAGES_PER_TOPIC = UINT16_MAX;
+
 private:
 
+    /* One entry of a topic's message log */
+    struct PendingMessage {
+        MessageSequence sequence;
+        Subscriber *sender;
+        T message;
+    };
+
+    /* Per-topic message logs live next to the topic rather than inside it since
+     * Topic is not templated on the message type */
+    struct TopicLog {
+        std::vector<PendingMessage> messages;
+        /* Running average of how many messages a loop iteration leaves in this log */
+        size_t typicalSize = 0;
+    };
+
+    /* Logs that grew past this many messages in a burst give the memory back once the
+     * burst has drained and their capacity is far above what they usually hold */
+    static constexpr size_t SHRINK_LOG_CAPACITY = 1024;
+
+    /* Cursor into one topic log while merging a subscriber's topics */
+    struct MergeHead {
+        std::vector<PendingMessage> *messages;
+        size_t index;
+    };
+
     /* The drain callback must not publish, unsubscribe or subscribe.
      * It must only cork, uncork, send, write */
     std::function<bool(Subscriber *, T &, IteratorFlags)> cb;
@@ -98,11 +139,20 @@ private:
     /* The topics */
     std::unordered_map<std::string_view, std::unique_ptr<Topic>> topics;
 
-    /* List of subscribers that needs drainage */
-    Subscriber *drainableSubscribers = nullptr;
+    /* Message logs of topics, only topics that ever had a message published have one */
+    std::unordered_map<Topic *, TopicLog> logs;
 
-    /* Palette of outgoing messages, up to 64k */
-    std::vector<T> outgoingMessages;
+    /* Topics with messages published since the last drain, linked through Topic::nextDirty */
+    Topic *dirtyTopics = nullptr;
+
+    /* Last sequence number handed out by publish */
+    MessageSequence lastSequence = 0;
+
+    /* Value of lastSequence at the time of the last full drain */
+    MessageSequence drainedSequence = 0;
+
+    /* Scratch space for drainImpl, kept around to not allocate per drain */
+    std::vector<MergeHead> mergeHeads;
 
     void checkIteratingSubscriber(Subscriber *s) {
         if (iteratingSubscriber == s) {
@@ -110,37 +160,137 @@ private:
         }
     }
 
-    /* Warning: does NOT unlink from drainableSubscribers or modify next, prev. */
+    void linkDirtyTopic(Topic *t) {
+        t->hasPendingMessages = true;
+        t->prevDirty = nullptr;
+        t->nextDirty = dirtyTopics;
+        if (dirtyTopics) {
+            dirtyTopics->prevDirty = t;
+        }
+        dirtyTopics = t;
+    }
+
+    void unlinkDirtyTopic(Topic *t) {
+        if (t->prevDirty) {
+            t->prevDirty->nextDirty = t->nextDirty;
+        }
+        if (t->nextDirty) {
+            t->nextDirty->prevDirty = t->prevDirty;
+        }
+        if (dirtyTopics == t) {
+            dirtyTopics = t->nextDirty;
+        }
+        t->hasPendingMessages = false;
+    }
+
+    /* Forgets all pending messages of a topic, keeping the log's capacity for the next loop iteration
+     * unless a burst left it far larger than usual */
+    void clearTopicLog(Topic *t) {
+        unlinkDirtyTopic(t);
+        TopicLog &log = logs[t];
+        log.typicalSize = (log.typicalSize * 7 + log.messages.size()) / 8;
+        if (log.messages.capacity() > SHRINK_LOG_CAPACITY && log.messages.capacity() > log.typicalSize * 4) {
+            std::vector<PendingMessage>().swap(log.messages);
+            log.messages.reserve(log.typicalSize);
+        } else {
+            log.messages.clear();
+        }
+    }
+
+    /* Removes a topic along with its log */
+    void eraseTopic(Topic *t) {
+        if (t->hasPendingMessages) {
+            unlinkDirtyTopic(t);
+        }
+        logs.erase(t);
+        /* Unique_ptr deletes the topic */
+        topics.erase(t->name);
+    }
+
+    /* Whether any of our topics holds a message newer than our cursor */
+    bool needsDrainage(Subscriber *s) {
+        /* Fast path: nothing was published since we last drained */
+        if (!dirtyTopics || s->cursor == lastSequence) {
+            return false;
+        }
+        for (Topic *t : s->topics) {
+            if (t->hasPendingMessages && t->lastPublished > s->cursor) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* Hands every pending message of this subscriber to cb, merged across topics in publish order */
     void drainImpl(Subscriber *s) {
-        /* Before we call cb we need to make sure this subscriber will not report needsDrainage()
-         * since WebSocket::send will call drain from within the cb in that case.*/
-        int numMessageIndices = s->numMessageIndices;
-        s->numMessageIndices = 0;
+        MessageSequence from = s->cursor;
+
+        /* Before we call cb we need to make sure this subscriber will not report pending messages
+         * since WebSocket::send will call drain from within the cb in that case. */
+        s->cursor = lastSequence;
 
-        /* Then we emit cb */
-        for (int i = 0; i < numMessageIndices; i++) {
-            T &outgoingMessage = outgoingMessages[s->messageIndices[i]];
+        /* Find where we left off in every topic with pending messages */
+        mergeHeads.clear();
+        for (Topic *t : s->topics) {
+            if (!t->hasPendingMessages) {
+                continue;
+            }
+            std::vector<PendingMessage> &messages = logs[t].messages;
+            auto it = std::upper_bound(messages.begin(), messages.end(), from, [](MessageSequence sequence, const PendingMessage &m) {
+                return sequence < m.sequence;
+            });
+            if (it != messages.end()) {
+                mergeHeads.push_back({&messages, (size_t) (it - messages.begin())});
+            }
+        }
 
-            int flags = (i == numMessageIndices - 1) ? LAST : NONE;
+        /* Picks the oldest message among our heads and skips our own publishes.
+         * Linear in number of heads which is the number of our dirty topics, most often one. */
+        auto next = [this, s]() -> PendingMessage * {
+            while (true) {
+                MergeHead *oldest = nullptr;
+                for (MergeHead &head : mergeHeads) {
+                    if (head.index < head.messages->size() && (!oldest || (*head.messages)[head.index].sequence < (*oldest->messages)[oldest->index].sequence)) {
+                        oldest = &head;
+                    }
+                }
+                if (!oldest) {
+                    return nullptr;
+                }
+                PendingMessage *m = &(*oldest->messages)[oldest->index++];
+                if (m->sender != s) {
+                    return m;
+                }
+            }
+        };
+
+        /* Then we emit cb, looking one message ahead to know which one is the last */
+        PendingMessage *current = next();
+        int flags = FIRST;
+        while (current) {
+            PendingMessage *following = next();
+            if (!following) {
+                flags |= LAST;
+            }
 
             /* Returning true will stop drainage short (such as when backpressure is too high) */
-            if (cb(s, outgoingMessage, (IteratorFlags)(flags | (i == 0 ? FIRST : NONE)))) {
+            if (cb(s, current->message, (IteratorFlags) flags)) {
                 break;
             }
+
+            current = following;
+            flags = NONE;
         }
     }
 
-    void unlinkDrainableSubscriber(Subscriber *s) {
-        if (s->prev) {
-            s->prev->next = s->next;
-        }
-        if (s->next) {
-            s->next->prev = s->prev;
-        }
-        /* If we are the head, then we also need to reset the head */
-        if (drainableSubscribers == s) {
-            drainableSubscribers = s->next;
+    /* Drains every subscriber of one topic, after which nobody needs its log anymore */
+    void drainTopic(Topic *t) {
+        for (Subscriber *s : *t) {
+            if (s->cursor != lastSequence) {
+                drainImpl(s);
+            }
         }
+        clearTopicLog(t);
     }
 
 public:
@@ -170,11 +320,16 @@ public:
             topicPtr = newTopic;
         }
 
-        /* Insert us in topic, insert topic in us */
-        auto [it, inserted] = s->topics.insert(topicPtr);
-        if (!inserted) {
+        if (s->topics.count(topicPtr)) {
             return nullptr;
         }
+
+        /* Messages published before we subscribed are not ours. Our cursor is shared
+         * by all our topics, so deliver what is pending elsewhere before moving it. */
+        drain(s);
+
+        /* Insert us in topic, insert topic in us */
+        s->topics.insert(topicPtr);
         topicPtr->insert(s);
 
         /* Success */
@@ -192,10 +347,16 @@ public:
             return {false, false, -1};
         }
 
-        /* Erase from our list first */
-        if (s->topics.erase(topicPtr) == 0) {
+        /* Messages published while we were subscribed are still ours */
+        if (!s->topics.count(topicPtr)) {
             return {false, false, -1};
         }
+        if (topicPtr->hasPendingMessages) {
+            drain(s);
+        }
+
+        /* Erase from our list first */
+        s->topics.erase(topicPtr);
 
         /* Remove us from topic */
         topicPtr->erase(s);
@@ -204,8 +365,7 @@ public:
 
         /* If there is no subscriber to this topic, remove it */
         if (!topicPtr->size()) {
-            /* Unique_ptr deletes the topic */
-            topics.erase(topic);
+            eraseTopic(topicPtr);
         }
 
         /* If we don't hold any topics we are to be freed altogether */
@@ -214,7 +374,9 @@ public:
 
     /* Factory function for creating a Subscriber */
     Subscriber *createSubscriber() {
-        return new Subscriber();
+        Subscriber *s = new Subscriber();
+        s->cursor = lastSequence;
+        return s;
     }
 
     /* This is used to end a Subscriber, before freeing it */
@@ -229,16 +391,22 @@ public:
         for (Topic *topicPtr : s->topics) {
             /* If we are the last subscriber, simply remove the whole topic */
             if (topicPtr->size() == 1) {
-                topics.erase(topicPtr->name);
+                eraseTopic(topicPtr);
             } else {
                 /* Otherwise just remove us */
                 topicPtr->erase(s);
             }
         }
 
-        /* We also need to unlink us */
-        if (s->needsDrainage()) {
-            unlinkDrainableSubscriber(s);
+        /* Pending messages must not keep pointing at us, a new subscriber could reuse the address */
+        if (s->lastPublished > drainedSequence) {
+            for (Topic *t = dirtyTopics; t; t = t->nextDirty) {
+                for (PendingMessage &m : logs[t].messages) {
+                    if (m.sender == s) {
+                        m.sender = nullptr;
+                    }
+                }
+            }
         }
 
         delete s;
@@ -246,36 +414,34 @@ public:
 
     /* Mainly used by WebSocket::send to drain one socket before sending */
     void drain(Subscriber *s) {
-        /* The list is undefined and cannot be touched unless needsDrainage(). */
-        if (s->needsDrainage()) {
-            /* This function differs from drainImpl by properly unlinking
-            * the subscriber from drainableSubscribers. drainImpl does not. */
-            unlinkDrainableSubscriber(s);
-
-            /* This one always resets needsDrainage before it calls any cb's.
+        if (needsDrainage(s)) {
+            /* This one always advances the cursor before it calls any cb's.
              * Otherwise we would stackoverflow when sending after publish but before drain. */
             drainImpl(s);
-
-            /* If we drained last subscriber, also clear outgoingMessages */
-            if (!drainableSubscribers) {
-                outgoingMessages.clear();
-            }
+        } else {
+            s->cursor = lastSequence;
         }
     }
 
-    /* Called everytime we call send, to drain published messages so to sync outgoing messages */
+    /* Called every loop iteration to commit pub/sub batches. Only touches topics that had
+     * messages published, and every affected subscriber exactly once. */
     void drain() {
-        if (drainableSubscribers) {
-            /* Drain one socket a time */
-            for (Subscriber *s = drainableSubscribers; s; s = s->next) {
-                /* Instead of unlinking every single subscriber, we just leave the list undefined
-                 * and reset drainableSubscribers ptr below. */
-                drainImpl(s);
+        if (dirtyTopics) {
+            for (Topic *t = dirtyTopics; t; t = t->nextDirty) {
+                for (Subscriber *s : *t) {
+                    /* Subscribers of several dirty topics were handled with the first one */
+                    if (s->cursor != lastSequence) {
+                        drainImpl(s);
+                    }
+                }
+            }
+
+            /* Drain always clears all topic logs */
+            while (dirtyTopics) {
+                clearTopicLog(dirtyTopics);
             }
-            /* Drain always clears drainableSubscribers and outgoingMessages */
-            drainableSubscribers = nullptr;
-            outgoingMessages.clear();
         }
+        drainedSequence = lastSequence;
     }
 
     /* Big messages bypass all buffering and land directly in backpressure */
@@ -299,61 +465,41 @@ public:
         return true;
     }
 
-    /* Linear in number of affected subscribers */
+    /* Constant time, subscribers are only visited once per loop iteration by drain */
     bool publish(Subscriber *sender, std::string_view topic, T &&message) {
         /* Do we even have this topic? */
         auto it = topics.find(topic);
         if (it == topics.end()) {
             return false;
         }
+        Topic *topicPtr = it->second.get();
 
-        /* If we have more than 65k messages we need to drain every socket. */
-        if (outgoingMessages.size() == UINT16_MAX) {
-            /* If there is a socket that is currently corked, this will be ugly as all sockets will drain
-             * to their own backpressure */
-            drain();
+        /* If nobody but the sender wants this message, don't buffer it */
+        if (topicPtr->size() == (sender && topicPtr->count(sender) ? 1u : 0u)) {
+            return false;
         }
 
-        /* If nobody references this message, don't buffer it */
-        bool referencedMessage = false;
-
-        /* For all subscribers in topic */
-        for (Subscriber *s : *it->second) {
-
-            /* If we are sender then ignore us */
-            if (sender != s) {
-
-                /* At least one subscriber wants this message */
-                referencedMessage = true;
+        TopicLog &log = logs[topicPtr];
 
-                /* If we already have too many outgoing messages on this subscriber, drain it now */
-                if (s->numMessageIndices == 32) {
-                    /* This one does not need to check needsDrainage here but still does. */
-                    drain(s);
-                }
+        /* If this topic alone has buffered too much, drain its subscribers now.
+         * Unlike a single shared palette this leaves every other topic alone. */
+        if (log.messages.size() == MAX_PENDING_MESSAGES_PER_TOPIC) {
+            drainTopic(topicPtr);
+        }
 
-                /* Finally we can continue */
-                s->messageIndices[s->numMessageIndices++] = (uint16_t)outgoingMessages.size();
-                /* First message adds subscriber to list of drainable subscribers */
-                if (s->numMessageIndices == 1) {
-                    /* Insert us in the head of drainable subscribers */
-                    s->next = drainableSubscribers;
-                    s->prev = nullptr;
-                    if (s->next) {
-                        s->next->prev = s;
-                    }
-                    drainableSubscribers = s;
-                }
-            }
+        /* First message makes the topic dirty */
+        if (!topicPtr->hasPendingMessages) {
+            linkDirtyTopic(topicPtr);
         }
 
         /* Push this message and return with success */
-        if (referencedMessage) {
-            outgoingMessages.emplace_back(message);
+        log.messages.push_back({++lastSequence, sender, std::move(message)});
+        topicPtr->lastPublished = lastSequence;
+        if (sender) {
+            sender->lastPublished = lastSequence;
         }
 
-        /* Success if someone wants it */
-        return referencedMessage;
+        return true;
     }
 };
 
@@ -130,11 +130,7 @@ public:
         WebSocketContextData<SSL, USERDATA> *webSocketContextData = getContextData();
 
         /* Skip sending and report success if we are over the limit of maxBackpressure */
-        if (webSocketContextData->maxBackpressure && webSocketContextData->maxBackpressure < getBufferedAmount()) {
-            /* Also defer a close if we should */
-            if (webSocketContextData->closeOnBackpressureLimit) {
-                us_socket_shutdown_read((us_socket_t *) this);
-            }
+        if (isOverBackpressureLimit()) {
             return DROPPED;
         }
 
@@ -193,35 +189,97 @@ public:
             auto [sendBuffer, sendBufferAttribute] = Super::getSendBuffer(messageFrameSize);
             protocol::formatMessage<isServer>(sendBuffer, message.data(), message.length(), opCode, message.length(), compress, fin);
 
-            /* Depending on size of message we have different paths */
-            if (sendBufferAttribute == SendBufferAttribute::NEEDS_DRAIN) {
-                /* This is a drain */
-                auto[written, failed] = Super::write(nullptr, 0);
-                if (failed) {
-                    /* Return false for failure, skipping to reset the timeout below */
-                    return BACKPRESSURE;
-                }
-            } else if (sendBufferAttribute == SendBufferAttribute::NEEDS_UNCORK) {
-                /* Uncork if we came here uncorked */
-                auto [written, failed] = Super::uncork();
-                if (failed) {
-                    return BACKPRESSURE;
-                }
-            }
-
+            return commitSendBuffer(sendBufferAttribute);
         }
 
         /* Every successful send resets the timeout */
+        resetTimeoutAfterSend();
+
+        /* Return success */
+        return SUCCESS;
+    }
+
+    /* Send a published message. Subscribers on the loop's shared compressor all produce the exact
+     * same compressed frame (the shared stream resets after every message), so the first such
+     * subscriber formats it into sharedFrame and every other one only copies those bytes. */
+    SendStatus sendPublished(std::string_view message, OpCode opCode, bool compress, std::string &sharedFrame) {
+        static_assert(isServer, "Shared frames are formatted without masking");
+
+        WebSocketData *webSocketData = (WebSocketData *) Super::getAsyncSocketData();
+        bool usesSharedCompressor = compress && message.length() && opCode < 3 && webSocketData->compressionStatus == WebSocketData::ENABLED && !webSocketData->deflationStream;
+        if (!usesSharedCompressor) {
+            return send(message, opCode, compress);
+        }
+
+        if (isOverBackpressureLimit()) {
+            return DROPPED;
+        }
+
+        /* Stay in sync with anything published to us earlier */
+        if (webSocketData->subscriber) {
+            getContextData()->topicTree->drain(webSocketData->subscriber);
+        }
+
+        if (sharedFrame.empty()) {
+            LoopData *loopData = Super::getLoopData();
+            std::string_view deflated = loopData->deflationStream->deflate(loopData->zlibContext, message, true);
+            sharedFrame.resize(protocol::messageFrameSize(deflated.length()));
+            protocol::formatMessage<isServer>(sharedFrame.data(), deflated.data(), deflated.length(), opCode, deflated.length(), true, true);
+        }
+
+        auto [sendBuffer, sendBufferAttribute] = Super::getSendBuffer(sharedFrame.length());
+        memcpy(sendBuffer, sharedFrame.data(), sharedFrame.length());
+
+        return commitSendBuffer(sendBufferAttribute);
+    }
+
+private:
+    /* Returns true (and possibly defers a close) if send must drop the message */
+    bool isOverBackpressureLimit() {
+        WebSocketContextData<SSL, USERDATA> *webSocketContextData = getContextData();
+        if (webSocketContextData->maxBackpressure && webSocketContextData->maxBackpressure < getBufferedAmount()) {
+            /* Also defer a close if we should */
+            if (webSocketContextData->closeOnBackpressureLimit) {
+                us_socket_shutdown_read((us_socket_t *) this);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /* Every successful send resets the timeout */
+    void resetTimeoutAfterSend() {
+        WebSocketContextData<SSL, USERDATA> *webSocketContextData = getContextData();
         if (webSocketContextData->resetIdleTimeoutOnSend) {
             Super::timeout(webSocketContextData->idleTimeoutComponents.first);
             WebSocketData *webSocketData = (WebSocketData *) Super::getAsyncSocketData();
             webSocketData->hasTimedOut = false;
         }
+    }
 
-        /* Return success */
+    /* Writes out a frame that was formatted into the buffer returned by getSendBuffer */
+    SendStatus commitSendBuffer(SendBufferAttribute sendBufferAttribute) {
+        /* Depending on size of message we have different paths */
+        if (sendBufferAttribute == SendBufferAttribute::NEEDS_DRAIN) {
+            /* This is a drain */
+            auto[written, failed] = Super::write(nullptr, 0);
+            if (failed) {
+                /* Return false for failure, skipping to reset the timeout below */
+                return BACKPRESSURE;
+            }
+        } else if (sendBufferAttribute == SendBufferAttribute::NEEDS_UNCORK) {
+            /* Uncork if we came here uncorked */
+            auto [written, failed] = Super::uncork();
+            if (failed) {
+                return BACKPRESSURE;
+            }
+        }
+
+        resetTimeoutAfterSend();
         return SUCCESS;
     }
 
+public:
     /* Send websocket close frame, emit close event, send FIN if successful.
      * Will not append a close reason if code is 0 or 1005. */
     void end(int code = 0, std::string_view message = {}) {
@@ -392,11 +450,12 @@ public:
         if (message.length() >= LoopData::CORK_BUFFER_SIZE) {
             SendStatus worst = SUCCESS;
             bool hasReceivers = false;
-            webSocketContextData->topicTree->publishBig(sender, topic, {message, opCode, compress}, [&worst, &hasReceivers](Subscriber *s, TopicTreeBigMessage &message) {
+            std::string sharedFrame;
+            webSocketContextData->topicTree->publishBig(sender, topic, {message, opCode, compress}, [&worst, &hasReceivers, &sharedFrame](Subscriber *s, TopicTreeBigMessage &message) {
                 hasReceivers = true;
                 auto *ws = (WebSocket<SSL, true, int> *) s->user;
 
-                worst = worseStatus(worst, (SendStatus) ws->send(message.message, (OpCode)message.opCode, message.compress));
+                worst = worseStatus(worst, (SendStatus) ws->sendPublished(message.message, (OpCode)message.opCode, message.compress, sharedFrame));
             });
             return hasReceivers ? worst : DROPPED;
         } else {
@@ -36,6 +36,8 @@ struct TopicTreeMessage {
     std::string message;
     /*OpCode*/ int opCode;
     bool compress;
+    /* Compressed frame shared by all subscribers on the shared compressor, formatted on first use */
+    std::string sharedFrame = {};
 };
 struct TopicTreeBigMessage {
     std::string_view message;
@@ -520,6 +520,39 @@ pub mod generate_header {
             }
         }
 
+        #[unsafe(no_mangle)]
+        extern "C" fn Bun__isIoUringAcceptSupportedOnLinuxKernel() -> i32 {
+            // Opt-in. bun-usockets never builds the io_uring accept path for
+            // Android, whose app seccomp policy rejects io_uring_setup.
+            #[cfg(not(target_os = "linux"))]
+            {
+                0
+            }
+            #[cfg(target_os = "linux")]
+            {
+                if !env_var::feature_flag::BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT
+                    .get()
+                    .unwrap_or(false)
+                {
+                    return 0;
+                }
+
+                // IORING_ACCEPT_DONTWAIT, which keeps every accept inline.
+                let min_accept_dontwait = semver::Version {
+                    major: 6,
+                    minor: 10,
+                    patch: 0,
+                    ..Default::default()
+                };
+
+                match kernel_version().order(min_accept_dontwait, b"", b"") {
+                    core::cmp::Ordering::Greater => 1,
+                    core::cmp::Ordering::Equal => 1,
+                    core::cmp::Ordering::Less => 0,
+                }
+            }
+        }
+
         #[cfg(any(target_os = "linux", target_os = "android"))]
         fn for_linux() -> Platform {
             // Confusingly, the "release" tends to contain the kernel version much more frequently than the "version" field.
@@ -268,6 +268,10 @@ pub mod feature_flag {
     // the client implementation matures. `--experimental-http3-fetch` is the
     // CLI equivalent.
     new_feature_flag!(pub BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP3_CLIENT, "BUN_FEATURE_FLAG_EXPERIMENTAL_HTTP3_CLIENT", {});
+    // Linux 6.10+: take a ready listen socket's backlog with batched io_uring
+    // accepts instead of one accept4() each (bun-usockets loop.c). Off by
+    // default while it is measured.
+    new_feature_flag!(pub BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT, "BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_FORCE_IO_POOL, "BUN_FEATURE_FLAG_FORCE_IO_POOL", {});
     new_feature_flag!(pub BUN_FEATURE_FLAG_FORCE_WINDOWS_JUNCTIONS, "BUN_FEATURE_FLAG_FORCE_WINDOWS_JUNCTIONS", {});
     new_feature_flag!(pub BUN_INSTRUMENTS, "BUN_INSTRUMENTS", {});
@@ -144,6 +144,7 @@ using namespace JSC;
     macro(peekPromiseSettledValue) \
     macro(peekPromiseStatus) \
     macro(pokePromiseAsHandled) \
+    macro(poolSize) \
     macro(port) \
     macro(preventAbort) \
     macro(preventCancel) \
@@ -10,6 +10,7 @@ const defineProperties = Object.defineProperties;
 const toStringTag = Symbol.toStringTag;
 const isArray = Array.isArray;
 const isTypedArray = ArrayBuffer.isView;
+const isSafeInteger = Number.isSafeInteger;
 
 let internalFieldTuple;
 
@@ -105,6 +106,7 @@ interface CppSQLStatement {
   as: (...args: TODO[]) => TODO;
   values: (...args: TODO[]) => TODO;
   raw: (...args: TODO[]) => TODO;
+  columnar: (rowsPerChunk: number, bindings?: TODO) => TODO;
   finalize: (...args: TODO[]) => TODO;
   toString: (...args: TODO[]) => TODO;
   isFinalized: boolean;
@@ -125,6 +127,9 @@ interface CppSQL {
   fcntl(handle: TODO, ...args: TODO[]): TODO;
   close(handle: TODO, throwOnError: boolean): void;
   setCustomSQLite(path: string): void;
+  openPool(filename: string, readers: number, readonly: boolean, pool: DatabasePool): number;
+  poolQuery(handle: number, mode: number, internalFlags: number, query: string, bindings?: TODO): Promise<TODO>;
+  closePool(handle: number): void;
 }
 
 let SQL: CppSQL;
@@ -313,6 +318,44 @@ class Statement {
     return createChangesObject();
   }
 
+  columnar(...args) {
+    if (args.length === 0) return this.#raw.columnar(0);
+    var arg0 = args[0];
+    // ["foo"] => ["foo"]
+    // ("foo") => ["foo"]
+    // (Uint8Array(1024)) => [Uint8Array]
+    // (123) => [123]
+    return this.#raw.columnar(
+      0,
+      !isArray(arg0) && (!arg0 || typeof arg0 !== "object" || isTypedArray(arg0)) ? args : arg0,
+    );
+  }
+
+  *columnarChunks(rowsPerChunk: number, ...args) {
+    if (!isSafeInteger(rowsPerChunk) || rowsPerChunk < 1) {
+      throw new RangeError(`Expected 'rowsPerChunk' to be a positive integer, got '${rowsPerChunk}'`);
+    }
+
+    let chunk;
+    if (args.length === 0) {
+      chunk = this.#raw.columnar(rowsPerChunk);
+    } else {
+      var arg0 = args[0];
+      chunk = this.#raw.columnar(
+        rowsPerChunk,
+        !isArray(arg0) && (!arg0 || typeof arg0 !== "object" || isTypedArray(arg0)) ? args : arg0,
+      );
+    }
+
+    // A short chunk means the statement ran to completion. Calling columnar()
+    // again at that point would reset it and start over.
+    while (true) {
+      if (chunk.length > 0) yield chunk;
+      if (chunk.length < rowsPerChunk) return;
+      chunk = this.#raw.columnar(rowsPerChunk);
+    }
+  }
+
   get columnNames() {
     return this.#raw.columns;
   }
@@ -426,9 +469,12 @@ class Database implements SqliteTypes.Database {
 
     this.#handle = SQL.open(anonymous ? ":memory:" : filename, flags, this);
     this.filename = filename;
+    this.#readonly = (flags & constants.SQLITE_OPEN_READONLY) !== 0;
   }
 
   #internalFlags = 0;
+  #readonly = false;
+  #pools: Set<DatabasePool> | undefined;
   #handle;
   #queryCache: Map<string, Statement> = new Map();
   filename;
@@ -499,6 +545,10 @@ class Database implements SqliteTypes.Database {
   close(throwOnError = false) {
     // native close finalizes every kOwnedByDatabaseFlag statement (query cache + transaction controller)
     this.#queryCache.$clear();
+    if (this.#pools) {
+      for (const pool of this.#pools) pool.close();
+      this.#pools = undefined;
+    }
     controllers?.delete(this);
     return SQL.close(this.#handle, throwOnError);
   }
@@ -533,6 +583,31 @@ class Database implements SqliteTypes.Database {
     );
   }
 
+  pool(options?: SqliteTypes.DatabasePoolOptions) {
+    let readers = 4;
+    if (options !== undefined) {
+      if (!options || typeof options !== "object") {
+        throw new TypeError(`Expected 'options' to be an object, got '${typeof options}'`);
+      }
+      if (options.readers !== undefined) {
+        readers = options.readers;
+        if (!isSafeInteger(readers) || readers < 1) {
+          throw new RangeError(`Expected 'readers' to be a positive integer, got '${readers}'`);
+        }
+      }
+    }
+
+    const filename = this.filename;
+    if (!filename || filename === ":memory:") {
+      throw new Error("Cannot create a pool for an in-memory database.");
+    }
+
+    const pool = new DatabasePool(this.#internalFlags);
+    pool[kPoolHandle] = SQL.openPool(filename, readers, this.#readonly, pool);
+    (this.#pools ??= new Set()).add(pool);
+    return pool;
+  }
+
   static MAX_QUERY_CACHE_SIZE = 20;
 
   get [cachedCount]() {
@@ -655,6 +730,77 @@ const wrapTransaction = (fn, db, { begin, commit, rollback, savepoint, release,
     }
   };
 
+const kPoolHandle = Symbol("poolHandle");
+
+const enum PoolQueryMode {
+  All = 0,
+  Values = 1,
+  Get = 2,
+  Run = 3,
+}
+
+// Queries run on the pool's own connections on worker threads; see
+// SQLitePool in JSSQLStatement.cpp.
+class DatabasePool {
+  constructor(internalFlags: number) {
+    this.#internalFlags = internalFlags;
+  }
+
+  #internalFlags: number;
+  #closed = false;
+  [kPoolHandle]: number = -1;
+
+  #query(mode: PoolQueryMode, query: string, params: any[]) {
+    if (typeof query !== "string") {
+      throw new TypeError(`Expected 'query' to be a string, got '${typeof query}'`);
+    }
+    // The native side forgets a closed pool once its last query settles.
+    if (this.#closed) return Promise.$reject(new Error("Database pool is closed"));
+
+    let bindings;
+    if (params.length > 0) {
+      var arg0 = params[0];
+      // ["foo"] => ["foo"]
+      // ("foo") => ["foo"]
+      // (Uint8Array(1024)) => [Uint8Array]
+      // (123) => [123]
+      bindings = !isArray(arg0) && (!arg0 || typeof arg0 !== "object" || isTypedArray(arg0)) ? params : arg0;
+    }
+
+    return SQL.poolQuery(this[kPoolHandle], mode, this.#internalFlags, query, bindings);
+  }
+
+  all(query: string, ...params) {
+    return this.#query(PoolQueryMode.All, query, params);
+  }
+
+  get(query: string, ...params) {
+    return this.#query(PoolQueryMode.Get, query, params);
+  }
+
+  values(query: string, ...params) {
+    return this.#query(PoolQueryMode.Values, query, params);
+  }
+
+  run(query: string, ...params) {
+    return this.#query(PoolQueryMode.Run, query, params);
+  }
+
+  get closed() {
+    return this.#closed;
+  }
+
+  close() {
+    if (this.#closed) return;
+    this.#closed = true;
+    SQL.closePool(this[kPoolHandle]);
+  }
+
+  [Symbol.dispose]() {
+    this.close();
+  }
+}
+
 // This class is never actually thrown
 // so we implement instanceof so that it could theoretically be caught
 class SQLiteError extends Error {
@@ -672,6 +818,7 @@ export default {
   __esModule: true,
   Database,
   Statement,
+  DatabasePool,
   constants,
   default: Database,
   SQLiteError,
@@ -670,6 +670,12 @@ export const lowercaseHeaderNameSIMD: (name: string) => string = $newCppFunction
   1,
 );
 
+export const headersHaveCachedWireBlock: (headers: Headers) => boolean = $newCppFunction(
+  "InternalForTesting.cpp",
+  "jsFunction_headersHaveCachedWireBlock",
+  1,
+);
+
 export const emitMemoryPressure: (level: "warning" | "critical") => void = $newCppFunction(
   "InternalForTesting.cpp",
   "jsFunction_emitMemoryPressure",
@@ -708,6 +714,20 @@ export const getEventLoopStats: () => {
   iteration: number;
 } = $newRustFunction("event_loop.rs", "getActiveTasks", 0);
 
+/** Counters for this thread's uWS cork pool (packages/bun-uws/src/LoopData.h). */
+export const getCorkStats: () => {
+  /** Sockets force-uncorked because every cork slot held data. */
+  evictions: number;
+  /** Uncorks that had data, and the bytes they handed to the socket. */
+  flushes: number;
+  flushedBytes: number;
+  /** Flushes that outgrew the 16 KiB cork buffer into a 64 KiB slab. */
+  slabFlushes: number;
+  /** Current pool size and the most slots ever in use at once. */
+  slots: number;
+  peakSlots: number;
+} = $newRustFunction("event_loop.rs", "getCorkStats", 0);
+
 export const hostedGitInfo = {
   parseUrl: $newRustFunction("hosted_git_info.rs", "TestingAPIs.jsParseUrl", 1),
   fromUrl: $newRustFunction("hosted_git_info.rs", "TestingAPIs.jsFromUrl", 1),
@@ -775,6 +795,14 @@ export const fileSinkInternals = {
   liveCount: $newRustFunction("runtime/webcore/FileSink.rs", "TestingAPIs.fileSinkLiveCount", 0) as () => number,
 };
 
+export const webStreamsInternals = {
+  // Whether pipeTo() between these streams takes the native fast path (both ends native).
+  isNativePipe: $newCppFunction("InternalForTesting.cpp", "jsFunction_isNativePipe", 2) as (
+    source: ReadableStream,
+    destination: WritableStream,
+  ) => boolean,
+};
+
 export const byteStreamInternals = {
   // Swap a ByteStream-backed stream's producer for one whose drain signal
   // re-enters on_cancel, making consumed-during-signal_drained re-entrancy
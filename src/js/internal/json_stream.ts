@@ -0,0 +1,136 @@
+// Bun.JSONL.parseStream: yields JSON values from a byte stream as soon as each
+// one is complete, without buffering the whole body.
+//
+// "jsonl" input is cut at the last newline of each chunk and the complete
+// lines go to the native Bun.JSONL.parseChunk. "array" input goes to the native scanner
+// in JSONArrayStream.cpp, which indexes it with the SIMD stage-1 JSON kernel
+// and yields the elements of one top-level array.
+//
+// Pending bytes live in a single buffer that is compacted in place and only
+// grows when the unfinished value plus the next chunk doesn't fit, so memory
+// stays bounded by the largest value rather than by the document.
+
+const { validateObject } = require("internal/validators");
+
+const parseChunk = $newCppFunction("BunObject.cpp", "jsFunctionJSONLParseChunk", 3);
+const scanArray = $newCppFunction("JSONArrayStream.cpp", "jsFunctionJSONArrayStreamScan", 3);
+
+// Must match jsonArrayStreamStateSize in JSONArrayStream.h.
+const ARRAY_STATE_BYTES = 64;
+const INITIAL_CAPACITY = 64 * 1024;
+const NEWLINE = 0x0a;
+
+function toBytes(chunk: unknown): Uint8Array {
+  if (typeof chunk === "string") return Buffer.from(chunk, "utf8");
+  if ($isTypedArrayView(chunk)) return new Uint8Array(chunk.buffer, chunk.byteOffset, chunk.byteLength);
+  if (chunk instanceof ArrayBuffer || chunk instanceof SharedArrayBuffer) return new Uint8Array(chunk);
+  if (chunk instanceof DataView) return new Uint8Array(chunk.buffer, chunk.byteOffset, chunk.byteLength);
+  throw $ERR_INVALID_ARG_TYPE("chunk", ["string", "ArrayBuffer", "TypedArray", "DataView"], chunk);
+}
+
+class PendingBytes {
+  bytes = new Uint8Array(INITIAL_CAPACITY);
+  start = 0;
+  end = 0;
+
+  get length() {
+    return this.end - this.start;
+  }
+
+  append(chunk: Uint8Array) {
+    const length = this.end - this.start;
+    if (chunk.length > this.bytes.length - this.end) {
+      if (length + chunk.length > this.bytes.length) {
+        const bytes = new Uint8Array(Math.max(this.bytes.length * 2, length + chunk.length));
+        bytes.set(this.bytes.subarray(this.start, this.end));
+        this.bytes = bytes;
+      } else {
+        this.bytes.copyWithin(0, this.start, this.end);
+      }
+      this.start = 0;
+      this.end = length;
+    }
+    this.bytes.set(chunk, this.end);
+    this.end += chunk.length;
+  }
+
+  consume(count: number) {
+    this.start += count;
+    if (this.start === this.end) this.start = this.end = 0;
+  }
+
+  view() {
+    return this.bytes.subarray(this.start, this.end);
+  }
+
+  skipBOM() {
+    const { bytes, start } = this;
+    if (this.length >= 3 && bytes[start] === 0xef && bytes[start + 1] === 0xbb && bytes[start + 2] === 0xbf) {
+      this.consume(3);
+    }
+  }
+}
+
+async function* parseLines(source: AsyncIterable<unknown>) {
+  const pending = new PendingBytes();
+  for await (const chunk of source) {
+    const bytes = toBytes(chunk);
+    const newline = bytes.lastIndexOf(NEWLINE);
+    pending.append(bytes);
+    if (newline === -1) continue;
+
+    const boundary = pending.end - bytes.length + newline + 1;
+    const { values, read, error } = parseChunk(pending.bytes, pending.start, boundary);
+    // The records before a bad line are still yielded, then the error.
+    for (let i = 0; i < values.length; i++) yield values[i];
+    if (error) throw error;
+    pending.consume(read - pending.start);
+  }
+
+  if (pending.length === 0) return;
+  const { values, done, error } = parseChunk(pending.bytes, pending.start, pending.end);
+  for (let i = 0; i < values.length; i++) yield values[i];
+  if (error) throw error;
+  if (!done) throw new SyntaxError("Unexpected end of JSONL input");
+}
+
+async function* parseArray(source: AsyncIterable<unknown>) {
+  const state = new Uint8Array(ARRAY_STATE_BYTES);
+  const pending = new PendingBytes();
+  let started = false;
+  for await (const chunk of source) {
+    pending.append(toBytes(chunk));
+    if (!started) {
+      // Wait for enough bytes to tell whether the input starts with a BOM.
+      if (pending.length < 3) continue;
+      pending.skipBOM();
+      started = true;
+    }
+    const { values, read } = scanArray(state, pending.view(), false);
+    pending.consume(read);
+    for (let i = 0; i < values.length; i++) yield values[i];
+  }
+
+  if (!started) pending.skipBOM();
+  const { values } = scanArray(state, pending.view(), true);
+  for (let i = 0; i < values.length; i++) yield values[i];
+}
+
+function parseStream(source: unknown, options?: { format?: "jsonl" | "array" }) {
+  if (typeof (source as any)?.[Symbol.asyncIterator] !== "function") {
+    throw $ERR_INVALID_ARG_TYPE("source", ["ReadableStream", "AsyncIterable"], source);
+  }
+  let format = "jsonl";
+  if (options !== undefined) {
+    validateObject(options, "options");
+    format = options.format ?? "jsonl";
+    if (format !== "jsonl" && format !== "array") {
+      throw $ERR_INVALID_ARG_VALUE("options.format", format, "must be 'jsonl' or 'array'");
+    }
+  }
+  return format === "array"
+    ? parseArray(source as AsyncIterable<unknown>)
+    : parseLines(source as AsyncIterable<unknown>);
+}
+
+export default parseStream;
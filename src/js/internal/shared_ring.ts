@@ -0,0 +1,278 @@
+// Bun.SharedRing: a single-producer / single-consumer byte ring over a
+// SharedArrayBuffer, for streaming messages between threads without going
+// through postMessage and the structured clone serializer.
+//
+// Layout of the SharedArrayBuffer, in Int32 slots:
+//
+//   [0]   head            bytes published by the producer (wraps at 2^32)
+//   [1]   read signal     bumped by the producer when the consumer is parked
+//   [2]   writer waiting  set by the producer while parked on a full ring
+//   [4]   capacity        size of the data region, a power of two
+//   [5]   magic
+//   [6]   closed
+//   [16]  tail            bytes released by the consumer (own cache line)
+//   [17]  write signal    bumped by the consumer when the producer is parked
+//   [18]  reader waiting  set by the consumer while parked on an empty ring
+//
+// The data region starts at HEADER_BYTES. Each record is an Int32 length word
+// (byteLength << 1 | isString) followed by the payload padded to 4 bytes.
+// Records never wrap: when one doesn't fit before the end of the region the
+// producer writes PAD and starts again at offset 0, so every binary message
+// can be handed out as a view. That's also why a record may use at most half
+// the capacity.
+//
+// Parking uses Atomics.waitAsync on the signal words rather than on head/tail
+// so close() can wake a peer without touching the positions. The "waiting"
+// flags keep the common case down to a store and a load on each side.
+
+const HEAD = 0;
+const READ_SIGNAL = 1;
+const WRITER_WAITING = 2;
+const CAPACITY = 4;
+const MAGIC = 5;
+const CLOSED = 6;
+const TAIL = 16;
+const WRITE_SIGNAL = 17;
+const READER_WAITING = 18;
+
+const HEADER_BYTES = 128;
+const RING_MAGIC = 0x4e495242; // "BRIN"
+const PAD = -1;
+const MIN_CAPACITY = 64;
+const MAX_CAPACITY = 1 << 30;
+
+const kind_binary = 0;
+const kind_string = 1;
+
+function roundUpToPowerOfTwo(value: number) {
+  let capacity = MIN_CAPACITY;
+  while (capacity < value) capacity *= 2;
+  return capacity;
+}
+
+class SharedRing {
+  #buffer: SharedArrayBuffer;
+  #header: Int32Array;
+  #words: Int32Array;
+  #bytes: Buffer;
+  #capacity: number;
+  // Tail to publish on the next read. Binary reads are views into the ring,
+  // so their bytes are only released once the caller asks for the next one.
+  #pendingTail = -1;
+
+  constructor(capacityOrBuffer: number | SharedArrayBuffer = 64 * 1024) {
+    let buffer: SharedArrayBuffer;
+    if (typeof capacityOrBuffer === "number") {
+      if (!Number.isInteger(capacityOrBuffer) || capacityOrBuffer < 1 || capacityOrBuffer > MAX_CAPACITY) {
+        throw $ERR_OUT_OF_RANGE("capacity", `an integer from 1 to ${MAX_CAPACITY}`, capacityOrBuffer);
+      }
+      const capacity = roundUpToPowerOfTwo(capacityOrBuffer);
+      buffer = new SharedArrayBuffer(HEADER_BYTES + capacity);
+      const header = new Int32Array(buffer, 0, HEADER_BYTES >> 2);
+      header[CAPACITY] = capacity;
+      Atomics.store(header, MAGIC, RING_MAGIC);
+    } else if (capacityOrBuffer instanceof SharedArrayBuffer) {
+      buffer = capacityOrBuffer;
+      const header = buffer.byteLength > HEADER_BYTES ? new Int32Array(buffer, 0, HEADER_BYTES >> 2) : null;
+      if (
+        !header ||
+        Atomics.load(header, MAGIC) !== RING_MAGIC ||
+        header[CAPACITY] + HEADER_BYTES !== buffer.byteLength
+      ) {
+        throw $ERR_INVALID_ARG_VALUE("buffer", capacityOrBuffer, "is not the buffer of a SharedRing");
+      }
+    } else {
+      throw $ERR_INVALID_ARG_TYPE("capacityOrBuffer", ["number", "SharedArrayBuffer"], capacityOrBuffer);
+    }
+
+    this.#buffer = buffer;
+    this.#header = new Int32Array(buffer, 0, HEADER_BYTES >> 2);
+    this.#capacity = this.#header[CAPACITY];
+    this.#words = new Int32Array(buffer, HEADER_BYTES, this.#capacity >> 2);
+    this.#bytes = Buffer.from(buffer, HEADER_BYTES, this.#capacity);
+  }
+
+  get buffer() {
+    return this.#buffer;
+  }
+
+  get capacity() {
+    return this.#capacity;
+  }
+
+  get closed() {
+    return Atomics.load(this.#header, CLOSED) !== 0;
+  }
+
+  // Appends one message. Returns false when the ring doesn't have room for it
+  // yet; throws if the message could never fit or the ring is closed.
+  write(message: string | ArrayBufferView | ArrayBuffer): boolean {
+    const header = this.#header;
+    if (Atomics.load(header, CLOSED)) throw $ERR_INVALID_STATE("The SharedRing is closed");
+
+    let kind: number, byteLength: number, source: Uint8Array | undefined;
+    if (typeof message === "string") {
+      kind = kind_string;
+      byteLength = Buffer.byteLength(message, "utf8");
+    } else if (ArrayBuffer.isView(message)) {
+      kind = kind_binary;
+      source = new Uint8Array(message.buffer, message.byteOffset, message.byteLength);
+      byteLength = source.byteLength;
+    } else if (message instanceof ArrayBuffer || message instanceof SharedArrayBuffer) {
+      kind = kind_binary;
+      source = new Uint8Array(message);
+      byteLength = source.byteLength;
+    } else {
+      throw $ERR_INVALID_ARG_TYPE("message", ["string", "ArrayBuffer", "TypedArray", "DataView"], message);
+    }
+
+    const capacity = this.#capacity;
+    const size = 4 + ((byteLength + 3) & ~3);
+    if (size > capacity >>> 1) {
+      throw $ERR_OUT_OF_RANGE("message.byteLength", `<= ${(capacity >>> 1) - 4}`, byteLength);
+    }
+
+    const head = Atomics.load(header, HEAD) >>> 0;
+    const used = (head - (Atomics.load(header, TAIL) >>> 0)) >>> 0;
+    let offset = head & (capacity - 1);
+    let pad = capacity - offset;
+    if (pad >= size) pad = 0;
+    if (used + pad + size > capacity) return false;
+
+    if (pad) {
+      this.#words[offset >> 2] = PAD;
+      offset = 0;
+    }
+    if (source) this.#bytes.set(source, offset + 4);
+    else this.#bytes.write(message as string, offset + 4, byteLength, "utf8");
+    this.#words[offset >> 2] = (byteLength << 1) | kind;
+
+    Atomics.store(header, HEAD, (head + pad + size) | 0);
+    if (Atomics.load(header, READER_WAITING)) {
+      Atomics.add(header, READ_SIGNAL, 1);
+      Atomics.notify(header, READ_SIGNAL);
+    }
+    return true;
+  }
+
+  // Like write(), but waits for the consumer to make room instead of
+  // returning false.
+  async writeAsync(message: string | ArrayBufferView | ArrayBuffer): Promise<void> {
+    const header = this.#header;
+    while (!this.write(message)) {
+      Atomics.store(header, WRITER_WAITING, 1);
+      const signal = Atomics.load(header, WRITE_SIGNAL);
+      if (!this.write(message)) {
+        const result = Atomics.waitAsync(header, WRITE_SIGNAL, signal);
+        if (result.async) await result.value;
+      } else {
+        Atomics.store(header, WRITER_WAITING, 0);
+        return;
+      }
+      Atomics.store(header, WRITER_WAITING, 0);
+    }
+  }
+
+  // Takes the next message, or returns undefined when the ring is empty.
+  // Strings are decoded; binary messages are Uint8Array views into the ring
+  // that stay valid until the next read. Copy them with slice() to keep them.
+  read(): string | Uint8Array | undefined {
+    const header = this.#header;
+    let tail = this.#pendingTail;
+    if (tail !== -1) {
+      this.#pendingTail = -1;
+      this.#release(tail);
+    } else {
+      tail = Atomics.load(header, TAIL);
+    }
+    tail >>>= 0;
+
+    const head = Atomics.load(header, HEAD) >>> 0;
+    if (head === tail) return undefined;
+
+    const capacity = this.#capacity;
+    let offset = tail & (capacity - 1);
+    let word = this.#words[offset >> 2];
+    if (word === PAD) {
+      tail += capacity - offset;
+      offset = 0;
+      word = this.#words[0];
+    }
+
+    const byteLength = word >>> 1;
+    const next = (tail + 4 + ((byteLength + 3) & ~3)) | 0;
+    const start = offset + 4;
+    if (word & kind_string) {
+      const value = this.#bytes.toString("utf8", start, start + byteLength);
+      this.#release(next);
+      return value;
+    }
+    this.#pendingTail = next;
+    return new Uint8Array(this.#buffer, HEADER_BYTES + start, byteLength);
+  }
+
+  // Like read(), but waits for a message. Resolves to undefined once the ring
+  // is closed and drained.
+  async readAsync(): Promise<string | Uint8Array | undefined> {
+    const header = this.#header;
+    while (true) {
+      const closed = Atomics.load(header, CLOSED);
+      const value = this.read();
+      if (value !== undefined || closed) return value;
+
+      Atomics.store(header, READER_WAITING, 1);
+      const signal = Atomics.load(header, READ_SIGNAL);
+      if (Atomics.load(header, HEAD) === Atomics.load(header, TAIL) && !Atomics.load(header, CLOSED)) {
+        const result = Atomics.waitAsync(header, READ_SIGNAL, signal);
+        if (result.async) await result.value;
+      }
+      Atomics.store(header, READER_WAITING, 0);
+    }
+  }
+
+  async *[Symbol.asyncIterator]() {
+    let value: string | Uint8Array | undefined;
+    while ((value = await this.readAsync()) !== undefined) yield value;
+  }
+
+  // Marks the ring closed for both sides. Pending readAsync() calls resolve
+  // once the remaining messages are drained; writes throw.
+  close() {
+    const header = this.#header;
+    if (Atomics.exchange(header, CLOSED, 1)) return;
+    Atomics.add(header, READ_SIGNAL, 1);
+    Atomics.notify(header, READ_SIGNAL);
+    Atomics.add(header, WRITE_SIGNAL, 1);
+    Atomics.notify(header, WRITE_SIGNAL);
+  }
+
+  // Closes the ring when `target` goes away: a Worker exits, a MessagePort
+  // closes, or an AbortSignal aborts. Without this a peer parked in
+  // readAsync() or writeAsync() would wait forever on a thread that's gone.
+  closeWith(target: any): this {
+    const close = () => this.close();
+    if (target instanceof AbortSignal) {
+      if (target.aborted) close();
+      else target.addEventListener("abort", close, { once: true });
+    } else if (typeof target?.once === "function") {
+      // node:worker_threads Worker, or an EventEmitter-style MessagePort.
+      target.once(target instanceof MessagePort ? "close" : "exit", close);
+    } else if (typeof target?.addEventListener === "function") {
+      target.addEventListener("close", close, { once: true });
+    } else {
+      throw $ERR_INVALID_ARG_TYPE("target", ["Worker", "MessagePort", "AbortSignal"], target);
+    }
+    return this;
+  }
+
+  #release(tail: number) {
+    const header = this.#header;
+    Atomics.store(header, TAIL, tail);
+    if (Atomics.load(header, WRITER_WAITING)) {
+      Atomics.add(header, WRITE_SIGNAL, 1);
+      Atomics.notify(header, WRITE_SIGNAL);
+    }
+  }
+}
+
+export default SharedRing;
@@ -2,6 +2,8 @@
 //! `JSValue`. Used by the macro system. The AST types stay in `js_parser/`;
 //! only the JS-materialization lives here.
 
+use core::ffi::c_void;
+
 use bun_ast::{E, Expr, ExprData, G, ToJSError};
 use bun_collections::VecExt;
 use bun_core::{StackCheck, String as BunString, strings};
@@ -168,6 +170,16 @@ unsafe extern "C" {
         items: *const E::JsonValue,
         encoding: u8,
     ) -> JSValue;
+    fn Bun__JSONRows__toLazyJS(
+        global: *const JSGlobalObject,
+        root: *const E::JsonValue,
+        props: *const E::PropertyJSON,
+        items: *const E::JsonValue,
+        encoding: u8,
+        owner: *mut c_void,
+        release: unsafe extern "C" fn(*mut c_void),
+        cost: usize,
+    ) -> JSValue;
 }
 
 /// For `JSONRowsToJS.cpp`: a UTF-8 tape string that strict UTF-8 decoding
@@ -206,18 +218,70 @@ fn json_rows_to_js(
     .map_err(js_err)
 }
 
-fn object_json_to_js(this: &E::ObjectJSON, global: &JSGlobalObject) -> Result<JSValue, ToJSError> {
-    let root = E::JsonValue::Object(bun_ast::StoreRef::from_raw(
+fn object_json_root(this: &E::ObjectJSON) -> E::JsonValue {
+    E::JsonValue::Object(bun_ast::StoreRef::from_raw(
         core::ptr::from_ref(this).cast_mut(),
-    ));
-    json_rows_to_js(root, this.tape(), global)
+    ))
 }
 
-fn array_json_to_js(this: &E::ArrayJSON, global: &JSGlobalObject) -> Result<JSValue, ToJSError> {
-    let root = E::JsonValue::Array(bun_ast::StoreRef::from_raw(
+fn array_json_root(this: &E::ArrayJSON) -> E::JsonValue {
+    E::JsonValue::Array(bun_ast::StoreRef::from_raw(
         core::ptr::from_ref(this).cast_mut(),
-    ));
-    json_rows_to_js(root, this.tape(), global)
+    ))
+}
+
+fn object_json_to_js(this: &E::ObjectJSON, global: &JSGlobalObject) -> Result<JSValue, ToJSError> {
+    json_rows_to_js(object_json_root(this), this.tape(), global)
+}
+
+fn array_json_to_js(this: &E::ArrayJSON, global: &JSGlobalObject) -> Result<JSValue, ToJSError> {
+    json_rows_to_js(array_json_root(this), this.tape(), global)
+}
+
+/// Like [`expr_to_js`] for a parsed JSON document, but its objects build
+/// their properties the first time they are read (`JSONRowsToJS.cpp`).
+/// `owner` must keep `this`, its tape and the source text alive; `release`
+/// frees it once no lazy object refers to the rows, which is right away when
+/// `this` isn't an object or array of rows. `cost` is the memory `owner`
+/// holds, charged to the GC while the result is alive.
+///
+/// # Safety
+/// `this` must stay valid until `release(owner)` is called, and `release`
+/// may be called on the JS thread at any later point, from the GC.
+pub unsafe fn expr_to_lazy_js(
+    this: &Expr,
+    global: &JSGlobalObject,
+    owner: *mut c_void,
+    release: unsafe extern "C" fn(*mut c_void),
+    cost: usize,
+) -> Result<JSValue, ToJSError> {
+    let (root, tape) = match &this.data {
+        ExprData::EObjectJSON(o) => (object_json_root(o), o.tape()),
+        ExprData::EArrayJSON(a) => (array_json_root(a), a.tape()),
+        _ => {
+            let result = expr_to_js(this, global);
+            // SAFETY: nothing refers to the rows after an eager conversion.
+            unsafe { release(owner) };
+            return result;
+        }
+    };
+    let (props, items) = tape.raw_rows();
+    let encoding = tape.encoding as u8;
+    // SAFETY: as for `json_rows_to_js`; C++ takes over `owner` and calls
+    // `release` exactly once, even when the conversion throws.
+    bun_jsc::from_js_host_call(global, || unsafe {
+        Bun__JSONRows__toLazyJS(
+            global,
+            &raw const root,
+            props,
+            items,
+            encoding,
+            owner,
+            release,
+            cost,
+        )
+    })
+    .map_err(js_err)
 }
 
 /// A TOML date/time literal as the Temporal object of its kind. `text` must
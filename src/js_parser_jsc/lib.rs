@@ -12,6 +12,6 @@ pub mod expr_jsc;
 // callers can write `bun_js_parser_jsc::Expr` / `expr.to_js(global)` without
 // also depending on `bun_js_parser` directly.
 pub use expr_jsc::{
-    ExprJsc, data_to_js, expr_to_js, string_to_js, to_js_error, toml_datetime_to_js,
+    ExprJsc, data_to_js, expr_to_js, expr_to_lazy_js, string_to_js, to_js_error, toml_datetime_to_js,
     value_string_to_js,
 };
@@ -89,6 +89,13 @@ unsafe extern "C" {
         value: &BunString,
         global: &JSGlobalObject,
     );
+
+    safe fn WebCore__FetchHeaders__putDefault(
+        this: &FetchHeaders,
+        name_: HTTPHeaderName,
+        value: &BunString,
+        global: &JSGlobalObject,
+    );
 }
 
 #[repr(C)]
@@ -126,11 +133,11 @@ impl FetchHeaders {
         value: &BunString,
         global: &JSGlobalObject,
     ) -> JsResult<()> {
-        if self.fast_has(name_) {
-            return Ok(());
-        }
-
-        self.put(name_, value, global)
+        // Not `fast_has` + `put`: the C++ side keeps a shared header cache
+        // across this insertion, which a plain set() drops.
+        host_fn::from_js_host_call_generic(global, || {
+            WebCore__FetchHeaders__putDefault(self, name_, value, global)
+        })
     }
 
     pub fn create(
@@ -0,0 +1,85 @@
+#include "root.h"
+#include "BunBufferPool.h"
+
+#include "WebCoreJSClientData.h"
+#include "ZigGlobalObject.h"
+#include <JavaScriptCore/JSArrayBufferView.h>
+#include <JavaScriptCore/JSTypedArrays.h>
+
+namespace Bun {
+
+using namespace JSC;
+
+JSUint8Array* BufferPool::allocate(JSGlobalObject* lexicalGlobalObject, size_t length)
+{
+    if (length <= JSArrayBufferView::fastSizeLimit)
+        return nullptr;
+
+    // Read on every pooled allocation, like Node's allocate(), so assigning
+    // Buffer.poolSize takes effect immediately.
+    size_t poolSize = currentPoolSize(lexicalGlobalObject);
+    if (!poolSize)
+        return nullptr;
+
+    // Node's `size < (Buffer.poolSize >>> 1)`.
+    if (length < (poolSize >> 1)) {
+        if (poolSize != m_poolSize) {
+            m_small = {};
+            m_poolSize = poolSize;
+        }
+        return carve(lexicalGlobalObject, m_small, m_poolSize, length);
+    }
+    if (length > mediumLimit)
+        return nullptr;
+    return carve(lexicalGlobalObject, m_medium, mediumSlabSize, length);
+}
+
+size_t BufferPool::pooledLengthLimit(JSGlobalObject* lexicalGlobalObject)
+{
+    size_t poolSize = currentPoolSize(lexicalGlobalObject);
+    if (!poolSize)
+        return 0;
+    return std::max(poolSize >> 1, mediumLimit + 1);
+}
+
+size_t BufferPool::currentPoolSize(JSGlobalObject* lexicalGlobalObject)
+{
+    auto* globalObject = defaultGlobalObject(lexicalGlobalObject);
+    auto& vm = globalObject->vm();
+    JSValue poolSizeValue = globalObject->JSBufferConstructor()->getDirect(vm, WebCore::builtinNames(vm).poolSizePublicName());
+    if (!poolSizeValue.isNumber())
+        return 0;
+    double value = poolSizeValue.asNumber();
+    if (!(value > 0 && value <= static_cast<double>(std::numeric_limits<uint32_t>::max())))
+        return 0;
+    return static_cast<size_t>(value);
+}
+
+JSUint8Array* BufferPool::carve(JSGlobalObject* lexicalGlobalObject, Slab& slab, size_t slabSize, size_t length)
+{
+    auto& vm = lexicalGlobalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    if (!slab.buffer || length > slabSize - slab.offset) {
+        // The full slab stays alive for as long as views onto it do.
+        auto buffer = ArrayBuffer::tryCreateUninitialized(slabSize, 1);
+        if (!buffer) [[unlikely]] {
+            throwOutOfMemoryError(lexicalGlobalObject, scope);
+            return nullptr;
+        }
+        // Detaching the slab would detach every other buffer carved from it,
+        // so make transfers copy instead.
+        buffer->pin();
+        slab = { WTF::move(buffer), 0 };
+    }
+
+    auto* globalObject = defaultGlobalObject(lexicalGlobalObject);
+    auto* view = JSUint8Array::create(lexicalGlobalObject, globalObject->JSBufferSubclassStructure(), slab.buffer.copyRef(), slab.offset, length);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    // Keep views 8-byte aligned, like Node's alignPool().
+    slab.offset = std::min(slabSize, WTF::roundUpToMultipleOf<8>(slab.offset + length));
+    return view;
+}
+
+} // namespace Bun
@@ -0,0 +1,60 @@
+#pragma once
+
+// Slab pool behind Buffer.allocUnsafe() and Buffer.from(string), after Node's
+// allocPool (lib/buffer.js): small buffers are views carved out of a shared
+// ArrayBuffer instead of each getting their own allocation.
+//
+// Differences from Node:
+//   - Buffers of up to JSArrayBufferView::fastSizeLimit bytes are not pooled.
+//     JSC already bump-allocates those in the GC heap with no ArrayBuffer at
+//     all, which is cheaper than a view onto a slab.
+//   - A second size class serves buffers from Buffer.poolSize / 2 up to
+//     mediumLimit from larger slabs, where Node would allocate each one alone.
+//     Buffer.poolSize = 0 turns both classes off.
+//   - Slabs are pinned rather than marked untransferable. buf.buffer.transfer()
+//     copies the whole slab and leaves it attached, and readable byte streams
+//     copy a pooled chunk's bytes where they would otherwise transfer them.
+//
+// Slabs are reclaimed by the GC: the pool drops its reference when a slab is
+// full, and the slab is freed once the last view onto it is collected. The
+// heap is charged for each slab once, not for each view.
+
+#include "root.h"
+#include <JavaScriptCore/ArrayBuffer.h>
+
+namespace Bun {
+
+class BufferPool {
+    WTF_DEPRECATED_MAKE_FAST_ALLOCATED(BufferPool);
+
+public:
+    static constexpr size_t mediumLimit = 16 * 1024;
+    static constexpr size_t mediumSlabSize = 64 * 1024;
+
+    // Returns an uninitialized Buffer of `length` bytes from a slab, or nullptr
+    // without throwing if `length` isn't pooled; the caller then allocates it
+    // the usual way. Throws only if a new slab can't be allocated.
+    JSC::JSUint8Array* allocate(JSC::JSGlobalObject*, size_t length);
+
+    // Buffers shorter than this may come from a slab; 0 while pooling is off.
+    static size_t pooledLengthLimit(JSC::JSGlobalObject*);
+
+private:
+    struct Slab {
+        RefPtr<JSC::ArrayBuffer> buffer;
+        size_t offset { 0 };
+    };
+
+    // Buffer.poolSize, or 0 when it isn't a usable size, which turns pooling
+    // off. Like Node, only buffers shorter than half of it use the small class.
+    static size_t currentPoolSize(JSC::JSGlobalObject*);
+
+    JSC::JSUint8Array* carve(JSC::JSGlobalObject*, Slab&, size_t slabSize, size_t length);
+
+    Slab m_small;
+    Slab m_medium;
+    // Buffer.poolSize as of the last small slab, like Node's `poolSize`.
+    size_t m_poolSize { 8 * 1024 };
+};
+
+} // namespace Bun
@@ -22,6 +22,7 @@
 #include <JavaScriptCore/JSONObject.h>
 #include "wtf/SIMDUTF.h"
 #include <JavaScriptCore/ObjectConstructor.h>
+#include <JavaScriptCore/CustomGetterSetter.h>
 #include <JavaScriptCore/JSObjectInlines.h>
 #include "headers.h"
 #include "BunObject.h"
@@ -332,6 +333,12 @@ static JSValue constructBunSQLObject(VM& vm, JSObject* bunObject)
     RELEASE_AND_RETURN(scope, sqlValue.getObject()->get(globalObject, clientData->builtinNames().SQLPublicName()));
 }
 
+static JSValue constructSharedRingObject(VM& vm, JSObject* bunObject)
+{
+    auto* globalObject = defaultGlobalObject(bunObject->globalObject());
+    return globalObject->internalModuleRegistry()->requireId(globalObject, vm, InternalModuleRegistry::InternalSharedRing);
+}
+
 extern "C" JSC::EncodedJSValue JSPasswordObject__create(JSGlobalObject*);
 
 static JSValue constructPasswordObject(VM& vm, JSObject* bunObject)
@@ -624,6 +631,22 @@ JSC_DEFINE_HOST_FUNCTION(jsFunctionJSONLParseChunk, (JSGlobalObject * globalObje
     return JSValue::encode(resultObj);
 }
 
+// Bun.JSONL.parseStream lives in internal/json_stream, which is only loaded
+// the first time it is read; the value then replaces this getter.
+JSC_DEFINE_CUSTOM_GETTER(jsonlParseStreamLazyGetter, (JSGlobalObject * lexicalGlobalObject, EncodedJSValue thisValue, PropertyName property))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSObject* jsonlObject = JSValue::decode(thisValue).getObject();
+    if (!jsonlObject) [[unlikely]]
+        return JSValue::encode(jsUndefined());
+    auto* globalObject = defaultGlobalObject(lexicalGlobalObject);
+    JSValue parseStream = globalObject->internalModuleRegistry()->requireId(globalObject, vm, InternalModuleRegistry::InternalJsonStream);
+    RETURN_IF_EXCEPTION(scope, {});
+    jsonlObject->putDirect(vm, property, parseStream, JSC::PropertyAttribute::DontDelete | 0);
+    return JSValue::encode(parseStream);
+}
+
 static JSValue constructJSONLObject(VM& vm, JSObject* bunObject)
 {
     JSGlobalObject* globalObject = bunObject->globalObject();
@@ -632,6 +655,9 @@ static JSValue constructJSONLObject(VM& vm, JSObject* bunObject)
         JSC::PropertyAttribute::DontDelete | 0);
     jsonlObject->putDirectNativeFunction(vm, globalObject, JSC::Identifier::fromString(vm, "parseChunk"_s), 1, jsFunctionJSONLParseChunk, ImplementationVisibility::Public, NoIntrinsic,
         JSC::PropertyAttribute::DontDelete | 0);
+    jsonlObject->putDirectCustomAccessor(vm, JSC::Identifier::fromString(vm, "parseStream"_s),
+        JSC::CustomGetterSetter::create(vm, jsonlParseStreamLazyGetter, nullptr),
+        JSC::PropertyAttribute::DontDelete | JSC::PropertyAttribute::CustomValue | 0);
     jsonlObject->putDirect(vm, vm.propertyNames->toStringTagSymbol, jsNontrivialString(vm, "JSONL"_s),
         JSC::PropertyAttribute::DontEnum | JSC::PropertyAttribute::ReadOnly);
     return jsonlObject;
@@ -1004,6 +1030,7 @@ JSC_DEFINE_HOST_FUNCTION(functionFileURLToPath, (JSC::JSGlobalObject * globalObj
     SQL                                            constructBunSQLObject                                               DontDelete|PropertyCallback
     serve                                          BunObject_callback_serve                                            DontDelete|Function 1
     sha                                            BunObject_callback_sha                                              DontDelete|Function 1
+    SharedRing                                     constructSharedRingObject                                           DontDelete|PropertyCallback
     shrink                                         BunObject_callback_shrink                                           DontDelete|Function 1
     sliceAnsi                                      jsFunctionBunSliceAnsi                                              DontDelete|Function 5
     sleep                                          functionBunSleep                                                    DontDelete|Function 1
@@ -6,6 +6,10 @@
 #include "JavaScriptCore/JSArrayBufferView.h"
 #include "headers-handwritten.h"
 #include "webcore/HTTPHeaderMap.h"
+#include "webcore/JSFetchHeaders.h"
+#include "webcore/streams/JSReadableStream.h"
+#include "webcore/streams/JSWritableStream.h"
+#include "webcore/streams/WebStreamsInternals.h"
 #include <wtf/text/StringImpl.h>
 #include <wtf/text/WTFString.h>
 
@@ -111,4 +115,29 @@ JSC_DEFINE_HOST_FUNCTION(jsFunction_isMemoryPressureWatcherInstalled, (JSC::JSGl
     return JSValue::encode(jsBoolean(Bun__MemoryPressure__isInstalled(defaultGlobalObject(globalObject))));
 }
 
+
+// Whether a Headers object written to several responses is being served from
+// its cached serialization, shared with the copies Responses took of it.
+JSC_DEFINE_HOST_FUNCTION(jsFunction_headersHaveCachedWireBlock, (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
+{
+    auto* headers = dynamicDowncast<WebCore::JSFetchHeaders>(callFrame->argument(0).getObject());
+    return JSValue::encode(jsBoolean(headers && headers->wrapped().hasCachedWireBlock()));
+}
+
+// Whether pipeTo() from the first stream into the second would take the native
+// fast path, so a test can tell which path a pipe takes.
+JSC_DEFINE_HOST_FUNCTION(jsFunction_isNativePipe, (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto* source = dynamicDowncast<WebCore::JSReadableStream>(callFrame->argument(0).getObject());
+    auto* destination = dynamicDowncast<WebCore::JSWritableStream>(callFrame->argument(1).getObject());
+    if (!source || !destination)
+        return JSValue::encode(jsBoolean(false));
+    // pipeTo() materializes a lazy native source when it locks it.
+    source->materializeIfNeeded(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    return JSValue::encode(jsBoolean(Bun::WebStreams::isNativePipe(source, destination)));
+}
+
 }
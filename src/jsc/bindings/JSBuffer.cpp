@@ -14,6 +14,7 @@
 #include "JavaScriptCore/JSCJSValue.h"
 
 #include "JSBuffer.h"
+#include "BunBufferPool.h"
 
 #include "JavaScriptCore/ArgList.h"
 #include "JavaScriptCore/ExceptionScope.h"
@@ -262,6 +263,25 @@ static JSUint8Array* allocBufferUnsafe(JSC::JSGlobalObject* lexicalGlobalObject,
     return result;
 }
 
+// Buffer.allocUnsafe() and Buffer.from(string) carve mid-sized buffers out of
+// a shared slab, like Node; see BunBufferPool.h. Everything else, and any size
+// the pool doesn't serve, gets its own allocation.
+static JSUint8Array* allocPooledBufferUnsafe(JSC::JSGlobalObject* lexicalGlobalObject, size_t byteLength)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto throwScope = DECLARE_THROW_SCOPE(vm);
+
+    auto& pool = defaultGlobalObject(lexicalGlobalObject)->m_bufferPool;
+    if (!pool)
+        pool = makeUnique<Bun::BufferPool>();
+    auto* result = pool->allocate(lexicalGlobalObject, byteLength);
+    RETURN_IF_EXCEPTION(throwScope, nullptr);
+    if (result)
+        return result;
+
+    RELEASE_AND_RETURN(throwScope, allocBufferUnsafe(lexicalGlobalObject, byteLength));
+}
+
 // Normalize val to be an integer in the range of [1, -1] since
 // implementations of memcmp() can vary by platform.
 static int normalizeCompareVal(int val, size_t a_length, size_t b_length)
@@ -542,7 +562,7 @@ static JSC::EncodedJSValue jsBufferConstructorFunction_allocUnsafeBody(JSC::JSGl
     Bun::V::validateNumber(throwScope, lexicalGlobalObject, lengthValue, "size"_s, jsNumber(0), jsNumber(Bun::Buffer::kMaxLength));
     RETURN_IF_EXCEPTION(throwScope, {});
     size_t length = lengthValue.toLength(lexicalGlobalObject);
-    auto result = allocBufferUnsafe(lexicalGlobalObject, length);
+    auto result = allocPooledBufferUnsafe(lexicalGlobalObject, length);
     RETURN_IF_EXCEPTION(throwScope, {});
     if (Bun__Node__ZeroFillBuffers) memset(result->typedVector(), 0, length);
     RELEASE_AND_RETURN(throwScope, JSValue::encode(result));
@@ -554,11 +574,65 @@ static JSC::EncodedJSValue constructBufferEmpty(JSGlobalObject* lexicalGlobalObj
     return JSBuffer__bufferFromLength(lexicalGlobalObject, 0);
 }
 
+// The encodings whose output length is cheap to know up front are encoded
+// straight into a pooled buffer. Returns nullptr, without throwing, when the
+// string takes the regular path.
+static JSC::JSUint8Array* constructPooledFromEncoding(JSGlobalObject* lexicalGlobalObject, WTF::StringView view, WebCore::BufferEncodingType encoding)
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    // Every encoding handled here produces between 1 and 3 bytes per code
+    // unit, so most strings can be ruled out before measuring them.
+    if (view.length() >= Bun::BufferPool::pooledLengthLimit(lexicalGlobalObject) || view.length() * 3 <= JSC::JSArrayBufferView::fastSizeLimit)
+        return nullptr;
+
+    const bool isUTF8 = encoding == WebCore::BufferEncodingType::utf8;
+    size_t byteLength;
+    if (view.is8Bit()) {
+        if (isUTF8)
+            byteLength = Bun__encoding__byteLengthLatin1AsUTF8(view.span8().data(), view.length());
+        else if (encoding == WebCore::BufferEncodingType::latin1 || encoding == WebCore::BufferEncodingType::ascii)
+            byteLength = view.length();
+        else
+            return nullptr;
+    } else {
+        if (isUTF8)
+            byteLength = Bun__encoding__byteLengthUTF16AsUTF8(view.span16().data(), view.length());
+        else if (encoding == WebCore::BufferEncodingType::ucs2 || encoding == WebCore::BufferEncodingType::utf16le)
+            byteLength = view.length() * 2;
+        else
+            return nullptr;
+    }
+
+    auto& pool = defaultGlobalObject(lexicalGlobalObject)->m_bufferPool;
+    if (!pool)
+        pool = makeUnique<Bun::BufferPool>();
+    auto* buffer = pool->allocate(lexicalGlobalObject, byteLength);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!buffer)
+        return nullptr;
+
+    auto* data = buffer->typedVector();
+    if (!isUTF8)
+        memcpy(data, view.is8Bit() ? static_cast<const void*>(view.span8().data()) : static_cast<const void*>(view.span16().data()), byteLength);
+    else if (view.is8Bit())
+        Bun__encoding__writeLatin1(view.span8().data(), view.length(), data, byteLength, static_cast<uint8_t>(encoding));
+    else
+        Bun__encoding__writeUTF16(view.span16().data(), view.length(), data, byteLength, static_cast<uint8_t>(encoding));
+    return buffer;
+}
+
 JSC::EncodedJSValue constructFromEncoding(JSGlobalObject* lexicalGlobalObject, WTF::StringView view, WebCore::BufferEncodingType encoding)
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
 
+    auto* pooled = constructPooledFromEncoding(lexicalGlobalObject, view, encoding);
+    RETURN_IF_EXCEPTION(scope, {});
+    if (pooled)
+        return JSValue::encode(pooled);
+
     JSC::EncodedJSValue result;
 
     if (view.is8Bit()) {
@@ -3220,7 +3294,7 @@ void JSBufferConstructor::finishCreation(VM& vm, JSGlobalObject* globalObject, J
     Base::finishCreation(vm, 3, "Buffer"_s, PropertyAdditionMode::WithoutStructureTransition);
     putDirectWithoutTransition(vm, vm.propertyNames->prototype, prototype, PropertyAttribute::DontEnum | PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly);
     prototype->putDirect(vm, vm.propertyNames->speciesSymbol, this, PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly);
-    putDirectWithoutTransition(vm, Identifier::fromString(vm, "poolSize"_s), jsNumber(8192));
+    putDirectWithoutTransition(vm, WebCore::builtinNames(vm).poolSizePublicName(), jsNumber(8192));
 }
 
 JSC::Structure* createBufferStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
@@ -0,0 +1,249 @@
+// Incremental scanner behind Bun.JSONL.parseStream(source, { format: "array" }).
+// It splits one top-level JSON array into its elements as bytes arrive, so a
+// large array body can be consumed element by element instead of being
+// buffered whole.
+//
+// Bytes are indexed with the resumable stage-1 kernel in highway_json.cpp,
+// which reports every structural character outside of strings. Finding element
+// boundaries is then a matter of counting brackets: an element ends at a ','
+// at depth 1 or at the ']' that closes the array. Each complete element is
+// parsed on its own with JSONParseWithException; the scanner never builds a
+// tape for the whole document.
+//
+// The kernel carries its string/escape state from one call to the next as long
+// as every call but the last covers a multiple of 64 bytes, so whole blocks are
+// indexed until the caller passes `final`. Up to 63 trailing bytes therefore
+// wait for the next chunk.
+//
+// The caller owns the input buffer. Each call returns `read`, and the caller
+// must drop exactly that many bytes from the front of the input before the
+// next call; what remains is the unfinished element plus any bytes that
+// haven't been indexed yet. That keeps the retained input down to about one
+// element regardless of the size of the document.
+
+#include "root.h"
+#include "JSONArrayStream.h"
+
+#include "ZigGlobalObject.h"
+#include "helpers.h"
+#include "wtf/SIMDUTF.h"
+#include <JavaScriptCore/JSONObject.h>
+#include <JavaScriptCore/JSTypedArrays.h>
+#include <array>
+#include <limits>
+
+#define BUN_JSON_IDX_ODDITY (1u << 3)
+
+extern "C" size_t highway_json_index_chunk(const uint8_t* input, size_t len, size_t base_offset,
+    uint32_t* out_indices, uint64_t* out_dirty, uint64_t* inout_state, uint32_t* out_flags);
+
+namespace Bun {
+
+using namespace JSC;
+
+namespace {
+
+enum class ArrayScanPhase : uint8_t {
+    BeforeArray,
+    InArray,
+    AfterArray,
+};
+
+// Lives in the caller's state buffer between calls. Offsets are relative to
+// the start of the pending input.
+struct ArrayScanState {
+    uint64_t kernel[3];
+    // Bytes of the pending input already indexed.
+    uint32_t scanned;
+    // Start of the element being read, just past the '[' or ','.
+    uint32_t elementStart;
+    uint32_t depth;
+    ArrayScanPhase phase;
+    // Whether an element has been terminated by ',' yet, which makes an
+    // empty element before ']' a trailing comma rather than an empty array.
+    bool hasElements;
+};
+static_assert(sizeof(ArrayScanState) <= jsonArrayStreamStateSize);
+static_assert(std::is_trivially_copyable_v<ArrayScanState>);
+
+// Bytes indexed per kernel call. A multiple of 64, and small enough that the
+// position buffer and dirty bitmap fit on the stack.
+static constexpr size_t scanWindow = 4096;
+
+static bool isJSONWhitespace(uint8_t c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Parses input[start, end) as one array element. Returns an empty JSValue
+// with no exception pending if the element is only whitespace.
+static JSValue parseElement(JSGlobalObject* globalObject, const uint8_t* input, size_t start, size_t end)
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    while (start < end && isJSONWhitespace(input[start]))
+        start++;
+    if (start == end)
+        return {};
+
+    const uint8_t* data = input + start;
+    size_t length = end - start;
+    if (length <= String::MaxLength && simdutf::validate_ascii(reinterpret_cast<const char*>(data), length)) {
+        auto chars = std::span { reinterpret_cast<const char8_t*>(data), length };
+        RELEASE_AND_RETURN(scope, JSONParseWithException(globalObject, StringView(chars)));
+    }
+
+    if (simdutf::utf16_length_from_utf8(reinterpret_cast<const char*>(data), length) > String::MaxLength) {
+        throwOutOfMemoryError(globalObject, scope);
+        return {};
+    }
+    auto str = Zig::convertUTF8ToString(std::span { reinterpret_cast<const unsigned char*>(data), length });
+    if (str.isNull()) {
+        throwOutOfMemoryError(globalObject, scope);
+        return {};
+    }
+    RELEASE_AND_RETURN(scope, JSONParseWithException(globalObject, str));
+}
+
+} // namespace
+
+JSC_DEFINE_HOST_FUNCTION(jsFunctionJSONArrayStreamScan, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* stateArray = dynamicDowncast<JSUint8Array>(callFrame->argument(0));
+    auto* inputArray = dynamicDowncast<JSUint8Array>(callFrame->argument(1));
+    if (!stateArray || !inputArray || stateArray->isDetached() || inputArray->isDetached()
+        || stateArray->byteLength() < jsonArrayStreamStateSize) [[unlikely]] {
+        throwTypeError(globalObject, scope, "Invalid JSON array stream state"_s);
+        return {};
+    }
+    bool isFinal = callFrame->argument(2).toBoolean(globalObject);
+
+    const uint8_t* input = static_cast<const uint8_t*>(inputArray->vector());
+    size_t length = inputArray->byteLength();
+    if (length > std::numeric_limits<uint32_t>::max()) [[unlikely]] {
+        throwRangeError(globalObject, scope, "JSON array element is too large"_s);
+        return {};
+    }
+
+    ArrayScanState state;
+    memcpy(&state, stateArray->vector(), sizeof(state));
+    if (state.scanned > length || state.elementStart > state.scanned) [[unlikely]] {
+        throwTypeError(globalObject, scope, "Invalid JSON array stream state"_s);
+        return {};
+    }
+
+    size_t limit = isFinal ? length : state.scanned + ((length - state.scanned) & ~static_cast<size_t>(63));
+
+    MarkedArgumentBuffer values;
+    std::array<uint32_t, scanWindow + 66> positions;
+    uint64_t dirty[1];
+
+    // Ends the element at `end` and starts the next one after it.
+    const auto finishElement = [&](size_t end, bool allowEmpty) -> bool {
+        JSValue value = parseElement(globalObject, input, state.elementStart, end);
+        RETURN_IF_EXCEPTION(scope, false);
+        if (!value) {
+            if (!allowEmpty) {
+                throwSyntaxError(globalObject, scope, "Unexpected empty element in JSON array"_s);
+                return false;
+            }
+        } else {
+            values.append(value);
+            if (values.hasOverflowed()) [[unlikely]] {
+                throwOutOfMemoryError(globalObject, scope);
+                return false;
+            }
+        }
+        state.elementStart = end + 1;
+        return true;
+    };
+
+    while (state.scanned < limit) {
+        size_t window = std::min(scanWindow, limit - state.scanned);
+        uint32_t flags = 0;
+        size_t count = highway_json_index_chunk(input + state.scanned, window, 0, positions.data(), dirty, state.kernel, &flags);
+        if (flags & BUN_JSON_IDX_ODDITY) {
+            throwSyntaxError(globalObject, scope, "Unexpected character in JSON array stream"_s);
+            return {};
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            size_t position = state.scanned + positions[i];
+            uint8_t c = input[position];
+            switch (state.phase) {
+            case ArrayScanPhase::BeforeArray:
+                if (c != '[') {
+                    throwSyntaxError(globalObject, scope, "Expected the JSON stream to be an array"_s);
+                    return {};
+                }
+                state.phase = ArrayScanPhase::InArray;
+                state.depth = 1;
+                state.elementStart = position + 1;
+                break;
+            case ArrayScanPhase::InArray:
+                switch (c) {
+                case '[':
+                case '{':
+                    state.depth++;
+                    break;
+                case ']':
+                case '}':
+                    if (--state.depth)
+                        break;
+                    if (c != ']') {
+                        throwSyntaxError(globalObject, scope, "Unexpected '}' in JSON array"_s);
+                        return {};
+                    }
+                    if (!finishElement(position, !state.hasElements))
+                        return {};
+                    state.phase = ArrayScanPhase::AfterArray;
+                    break;
+                case ',':
+                    if (state.depth != 1)
+                        break;
+                    if (!finishElement(position, false))
+                        return {};
+                    state.hasElements = true;
+                    break;
+                default:
+                    // Quotes and scalar starts; the element parser checks them.
+                    break;
+                }
+                break;
+            case ArrayScanPhase::AfterArray:
+                throwSyntaxError(globalObject, scope, "Unexpected data after the end of the JSON array"_s);
+                return {};
+            }
+        }
+        state.scanned += window;
+    }
+
+    bool done = state.phase == ArrayScanPhase::AfterArray;
+    if (isFinal && !done) {
+        throwSyntaxError(globalObject, scope, "Unexpected end of JSON array stream"_s);
+        return {};
+    }
+
+    // Everything before the current element has been turned into values.
+    size_t read = state.phase == ArrayScanPhase::InArray ? state.elementStart : state.scanned;
+    state.elementStart = 0;
+    state.scanned -= read;
+    memcpy(stateArray->vector(), &state, sizeof(state));
+
+    JSArray* array = constructArray(globalObject, static_cast<ArrayAllocationProfile*>(nullptr), values);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto* zigGlobalObject = uncheckedDowncast<Zig::GlobalObject>(globalObject);
+    JSObject* result = constructEmptyObject(vm, zigGlobalObject->jsonlParseResultStructure());
+    result->putDirectOffset(vm, 0, array);
+    result->putDirectOffset(vm, 1, jsNumber(read));
+    result->putDirectOffset(vm, 2, jsBoolean(done));
+    result->putDirectOffset(vm, 3, jsNull());
+    return JSValue::encode(result);
+}
+
+} // namespace Bun
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+
+// Size of the opaque state buffer the JS side allocates for
+// jsFunctionJSONArrayStreamScan (src/js/internal/json_stream.ts).
+static constexpr size_t jsonArrayStreamStateSize = 64;
+
+// scan(state: Uint8Array, input: Uint8Array, final: boolean) => ParseChunkResult
+JSC_DECLARE_HOST_FUNCTION(jsFunctionJSONArrayStreamScan);
+
+}
@@ -1,15 +1,40 @@
 // Builds JS values from the immutable JSON AST rows (`E::JsonTape`, see src/ast/e.rs) that the
 // JSON and XML parsers produce: one call for the whole document, keys and short values through
 // the VM's JSONAtomStringCache the way JSON.parse does it.
+//
+// Objects with the key sequence of one built shortly before (the records of an array, and
+// the sub-objects inside them) reuse its Structure: the object is created with every
+// property already in place and the values are stored by offset, the way SQL rows use
+// JSC__createStructure. Only the keys' bytes are compared; no identifier or transition is
+// looked up.
+//
+// Bun__JSONRows__toLazyJS is the opt-in lazy form (Bun.JSONC.parse(text, { lazy: true })).
+// Objects come back as JSLazyJSONObject shells over their rows. A shell builds its own
+// properties, in document order, the first time one of its keys is read or its key set is
+// observed, and from then on behaves like an ordinary object. Nested objects are shells in
+// turn, so a handler that reads a few fields only pays for the objects on the way to them.
+// Arrays are built whole, with shells for their object elements, so Array.isArray and
+// indexed access stay native. The tape, the AST nodes the rows point at and the source text
+// stay alive, through LazyJSONDocument, until the last shell is collected. Their memory is
+// charged to the GC for that whole time: every shell still holding the document offers to
+// report it when visited, and the first one in each marking cycle does.
 
 #include "root.h"
+#include "JSONRowsToJS.h"
 
+#include "BunClientData.h"
+#include "DOMClientIsoSubspaces.h"
+#include "DOMIsoSubspaces.h"
+#include "ZigGlobalObject.h"
 #include <JavaScriptCore/IdentifierInlines.h>
 #include <JavaScriptCore/ArgList.h>
 #include <JavaScriptCore/JSArray.h>
 #include <JavaScriptCore/JSCInlines.h>
 #include <JavaScriptCore/JSONAtomStringCacheInlines.h>
 #include <JavaScriptCore/ObjectConstructor.h>
+#include <JavaScriptCore/PropertyNameArray.h>
+#include <JavaScriptCore/SubspaceInlines.h>
+#include <wtf/ThreadSafeRefCounted.h>
 #include <wtf/text/ASCIIFastPath.h>
 
 namespace Bun {
@@ -79,14 +104,128 @@ enum class RowEncoding : uint8_t {
 
 extern "C" EncodedJSValue Bun__JSONRows__wtf8ToJS(JSGlobalObject*, const Latin1Character*, size_t);
 
+// The rows of one lazily converted document and the Rust object that owns them (the tape,
+// the arena holding the ObjectJSON/ArrayJSON nodes, and the source the strings may point
+// into). Released when the last shell referencing it is destroyed. `cost` is the memory the
+// owner holds.
+class LazyJSONDocument : public ThreadSafeRefCounted<LazyJSONDocument> {
+public:
+    using Release = void (*)(void*);
+
+    static Ref<LazyJSONDocument> create(const RowProperty* props, const RowValue* items, RowEncoding encoding, void* owner, Release release, size_t cost)
+    {
+        return adoptRef(*new LazyJSONDocument(props, items, encoding, owner, release, cost));
+    }
+
+    ~LazyJSONDocument() { m_release(m_owner); }
+
+    // Whether the caller is the first to report the cost in the marking cycle `version`.
+    // Asked by every shell being visited, possibly from several marking threads at once.
+    bool claimExtraMemoryReport(HeapVersion version)
+    {
+        return m_reportedVersion.exchange(version, std::memory_order_relaxed) != version;
+    }
+
+    const RowProperty* const props;
+    const RowValue* const items;
+    const RowEncoding encoding;
+    const size_t cost;
+
+private:
+    LazyJSONDocument(const RowProperty* props, const RowValue* items, RowEncoding encoding, void* owner, Release release, size_t cost)
+        : props(props)
+        , items(items)
+        , encoding(encoding)
+        , cost(cost)
+        , m_owner(owner)
+        , m_release(release)
+    {
+    }
+
+    void* m_owner;
+    Release m_release;
+    std::atomic<HeapVersion> m_reportedVersion { 0 };
+};
+
+// An object of a lazy document whose properties haven't been built yet. Every hook that
+// can observe or change the property set builds them first (materialize()) and then defers
+// to the ordinary object behavior; only a lookup of a key the object doesn't have skips
+// that. Property caching stays off for the class, since an access cached against the empty
+// shell structure would be wrong for the next shell with different keys.
+class JSLazyJSONObject final : public JSDestructibleObject {
+public:
+    using Base = JSDestructibleObject;
+    static constexpr DestructionMode needsDestruction = NeedsDestruction;
+    static constexpr unsigned StructureFlags = Base::StructureFlags | OverridesGetOwnPropertySlot | InterceptsGetOwnPropertySlotByIndexEvenWhenLengthIsNotZero
+        | OverridesGetOwnPropertyNames | OverridesPut | ProhibitsPropertyCaching;
+
+    DECLARE_INFO;
+    DECLARE_VISIT_CHILDREN;
+
+    static Structure* createStructure(VM& vm, JSGlobalObject* globalObject, JSValue prototype)
+    {
+        return Bun::createClassStructure(vm, globalObject, prototype, TypeInfo(ObjectType, StructureFlags), info());
+    }
+
+    static JSLazyJSONObject* create(VM& vm, Structure* structure, LazyJSONDocument& document, const RowSpan& span)
+    {
+        auto* object = new (NotNull, allocateCell<JSLazyJSONObject>(vm)) JSLazyJSONObject(vm, structure, document, span);
+        object->finishCreation(vm);
+        return object;
+    }
+
+    template<typename, SubspaceAccess mode> static GCClient::IsoSubspace* subspaceFor(VM& vm)
+    {
+        if constexpr (mode == SubspaceAccess::Concurrently)
+            return nullptr;
+        return WebCore::subspaceForImpl<JSLazyJSONObject, WebCore::UseCustomHeapCellType::No>(vm, BUN_SUBSPACE_SLOTS(m_clientSubspaceForLazyJSONObject, m_subspaceForLazyJSONObject));
+    }
+
+    static void destroy(JSCell* cell) { static_cast<JSLazyJSONObject*>(cell)->~JSLazyJSONObject(); }
+
+    static bool getOwnPropertySlot(JSObject*, JSGlobalObject*, PropertyName, PropertySlot&);
+    static bool getOwnPropertySlotByIndex(JSObject*, JSGlobalObject*, unsigned, PropertySlot&);
+    static bool put(JSCell*, JSGlobalObject*, PropertyName, JSValue, PutPropertySlot&);
+    static bool putByIndex(JSCell*, JSGlobalObject*, unsigned, JSValue, bool shouldThrow);
+    static bool defineOwnProperty(JSObject*, JSGlobalObject*, PropertyName, const PropertyDescriptor&, bool shouldThrow);
+    static bool deleteProperty(JSCell*, JSGlobalObject*, PropertyName, DeletePropertySlot&);
+    static bool deletePropertyByIndex(JSCell*, JSGlobalObject*, unsigned);
+    static void getOwnPropertyNames(JSObject*, JSGlobalObject*, PropertyNameArrayBuilder&, DontEnumPropertiesMode);
+    static bool preventExtensions(JSObject*, JSGlobalObject*);
+
+private:
+    JSLazyJSONObject(VM& vm, Structure* structure, LazyJSONDocument& document, const RowSpan& span)
+        : Base(vm, structure)
+        , m_document(&document)
+        , m_rows(document.props + span.first)
+        , m_count(span.count)
+    {
+    }
+
+    // Whether `name` can be one of the keys. Errs towards yes: it only decides whether a
+    // lookup may skip materialize().
+    bool mayHaveKey(PropertyName) const;
+    // Builds the properties unless that already happened. False with an exception pending
+    // on failure.
+    bool materialize(JSGlobalObject*);
+
+    // Null once the properties are built. Cleared under the cell lock, since the GC reads it
+    // concurrently.
+    RefPtr<LazyJSONDocument> m_document;
+    const RowProperty* m_rows;
+    uint32_t m_count;
+};
+
 template<RowEncoding encoding>
 class RowsToJS {
 public:
-    RowsToJS(JSGlobalObject* globalObject, const RowProperty* props, const RowValue* items)
+    // With a `lazy` document, objects become JSLazyJSONObject shells over it.
+    RowsToJS(JSGlobalObject* globalObject, const RowProperty* props, const RowValue* items, LazyJSONDocument* lazy = nullptr)
         : m_globalObject(globalObject)
         , m_vm(globalObject->vm())
         , m_props(props)
         , m_items(items)
+        , m_lazy(lazy)
     {
     }
 
@@ -102,6 +241,8 @@ public:
         case RowValue::String:
             return string(v.string);
         case RowValue::Object:
+            if (m_lazy && static_cast<const RowSpan*>(v.object.ptr)->count)
+                return lazyObject(*static_cast<const RowSpan*>(v.object.ptr));
             return object(*static_cast<const RowSpan*>(v.object.ptr));
         case RowValue::Array:
             return array(*static_cast<const RowSpan*>(v.array.ptr));
@@ -117,23 +258,30 @@ public:
             return {};
         }
         const RowProperty* rows = m_props + o.first;
-        JSObject* object = constructEmptyObject(m_globalObject, m_globalObject->objectPrototype(),
-            std::min<unsigned>(o.count, JSFinalObject::maxInlineCapacity));
+        if (!o.count || o.count > JSFinalObject::maxInlineCapacity)
+            RELEASE_AND_RETURN(scope, objectByTransitions(rows, o.count, nullptr));
+
+        Shape& shape = m_shapes[shapeSlot(rows, o.count)];
+        if (shape.count == o.count && sameKeys(shape.keys, rows, o.count))
+            RELEASE_AND_RETURN(scope, objectWithStructure(shape.structure, rows, o.count));
+
+        bool hasIndexKey = false;
+        JSObject* object = objectByTransitions(rows, o.count, &hasIndexKey);
         RETURN_IF_EXCEPTION(scope, {});
-        for (uint32_t i = 0; i < o.count; ++i) {
-            Identifier ident = identifier(rows[i].key);
-            RETURN_IF_EXCEPTION(scope, {});
-            JSValue v = value(rows[i].value);
-            RETURN_IF_EXCEPTION(scope, {});
-            if (std::optional<uint32_t> index = parseIndex(ident)) [[unlikely]] {
-                object->putDirectIndex(m_globalObject, index.value(), v);
-                RETURN_IF_EXCEPTION(scope, {});
-            } else
-                object->putDirect(m_vm, ident, v);
-        }
+        // Reusable when the keys landed in inline offsets 0..count-1 in order: no index keys,
+        // no duplicates (a repeated key overwrites, leaving fewer properties than keys).
+        Structure* structure = object->structure();
+        if (!hasIndexKey && !structure->isDictionary() && structure->maxOffset() == static_cast<PropertyOffset>(o.count - 1) && structure->inlineCapacity() >= o.count)
+            shape = { rows, o.count, structure };
         return object;
     }
 
+    JSValue lazyObject(const RowSpan& o)
+    {
+        auto* structure = defaultGlobalObject(m_globalObject)->lazyJSONObjectStructure();
+        return JSLazyJSONObject::create(m_vm, structure, *m_lazy, o);
+    }
+
     JSValue array(const RowSpan& a)
     {
         auto scope = DECLARE_THROW_SCOPE(m_vm);
@@ -156,7 +304,86 @@ public:
         RELEASE_AND_RETURN(scope, constructArray(m_globalObject, static_cast<ArrayAllocationProfile*>(nullptr), elements));
     }
 
+    // Adds `rows` to `object` in order, the way JSON.parse defines them. False with an
+    // exception pending on failure.
+    bool putProperties(JSObject* object, const RowProperty* rows, uint32_t count, bool* hasIndexKey)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        for (uint32_t i = 0; i < count; ++i) {
+            Identifier ident = identifier(rows[i].key);
+            RETURN_IF_EXCEPTION(scope, false);
+            JSValue v = value(rows[i].value);
+            RETURN_IF_EXCEPTION(scope, false);
+            if (std::optional<uint32_t> index = parseIndex(ident)) [[unlikely]] {
+                if (hasIndexKey)
+                    *hasIndexKey = true;
+                object->putDirectIndex(m_globalObject, index.value(), v);
+                RETURN_IF_EXCEPTION(scope, false);
+            } else
+                object->putDirect(m_vm, ident, v);
+        }
+        return true;
+    }
+
 private:
+    // A recently built object's key sequence (rows on the tape, which outlives the call) and
+    // the Structure it ended up with. The cache lives in this stack object, so the structures
+    // are found by the conservative scan, besides being held by the objects built with them.
+    struct Shape {
+        const RowProperty* keys { nullptr };
+        uint32_t count { 0 };
+        Structure* structure { nullptr };
+    };
+    static constexpr unsigned shapeCacheSize = 16;
+
+    static unsigned shapeSlot(const RowProperty* rows, uint32_t count)
+    {
+        const RowStr& first = rows[0].key;
+        const RowStr& last = rows[count - 1].key;
+        unsigned hash = count * 31 + first.len * 7 + last.len;
+        if (first.len)
+            hash += first.ptr[0] * 3;
+        if (last.len)
+            hash += last.ptr[last.len - 1];
+        return hash % shapeCacheSize;
+    }
+
+    static bool sameKeys(const RowProperty* a, const RowProperty* b, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i) {
+            const RowStr& x = a[i].key;
+            const RowStr& y = b[i].key;
+            if (x.len != y.len || (x.ptr != y.ptr && memcmp(x.ptr, y.ptr, x.len)))
+                return false;
+        }
+        return true;
+    }
+
+    JSValue objectWithStructure(Structure* structure, const RowProperty* rows, uint32_t count)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        // Inline storage starts out empty, which is what the GC sees until each value lands.
+        JSObject* object = constructEmptyObject(m_vm, structure);
+        for (uint32_t i = 0; i < count; ++i) {
+            JSValue v = value(rows[i].value);
+            RETURN_IF_EXCEPTION(scope, {});
+            object->putDirectOffset(m_vm, i, v);
+        }
+        return object;
+    }
+
+    JSObject* objectByTransitions(const RowProperty* rows, uint32_t count, bool* hasIndexKey)
+    {
+        auto scope = DECLARE_THROW_SCOPE(m_vm);
+        JSObject* object = constructEmptyObject(m_globalObject, m_globalObject->objectPrototype(),
+            std::min<unsigned>(count, JSFinalObject::maxInlineCapacity));
+        RETURN_IF_EXCEPTION(scope, {});
+        bool ok = putProperties(object, rows, count, hasIndexKey);
+        RETURN_IF_EXCEPTION(scope, {});
+        ASSERT_UNUSED(ok, ok);
+        return object;
+    }
+
     // The three encodings: Latin-1 and UTF-16 strings are the characters as they stand; UTF-8 is
     // Latin-1 when it is ASCII (nearly always, for keys) and decoded otherwise.
 
@@ -211,8 +438,165 @@ private:
     VM& m_vm;
     const RowProperty* m_props;
     const RowValue* m_items;
+    LazyJSONDocument* m_lazy;
+    std::array<Shape, shapeCacheSize> m_shapes {};
 };
 
+const ClassInfo JSLazyJSONObject::s_info = { "Object"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSLazyJSONObject) };
+
+template<typename Visitor>
+void JSLazyJSONObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
+{
+    auto* thisObject = uncheckedDowncast<JSLazyJSONObject>(cell);
+    ASSERT_GC_OBJECT_INHERITS(thisObject, info());
+    Base::visitChildren(thisObject, visitor);
+    Locker locker { thisObject->cellLock() };
+    if (auto* document = thisObject->m_document.get()) {
+        if (document->claimExtraMemoryReport(visitor.heap()->objectSpace().markingVersion()))
+            visitor.reportExtraMemoryVisited(document->cost);
+    }
+}
+
+DEFINE_VISIT_CHILDREN(JSLazyJSONObject);
+
+bool JSLazyJSONObject::mayHaveKey(PropertyName name) const
+{
+    if (name.isSymbol())
+        return false;
+    StringView wanted(name.uid());
+    for (uint32_t i = 0; i < m_count; ++i) {
+        const RowStr& key = m_rows[i].key;
+        switch (m_document->encoding) {
+        case RowEncoding::Utf16:
+            if (wanted == StringView(std::span { reinterpret_cast<const char16_t*>(key.ptr), key.len / 2 }))
+                return true;
+            break;
+        case RowEncoding::Latin1:
+            if (wanted == StringView(key.span()))
+                return true;
+            break;
+        case RowEncoding::Utf8:
+            // Non-ASCII keys would need decoding to compare; assume a match.
+            if (!charactersAreAllASCII(key.span()) || wanted == StringView(key.span()))
+                return true;
+            break;
+        }
+    }
+    return false;
+}
+
+bool JSLazyJSONObject::materialize(JSGlobalObject* globalObject)
+{
+    // Only this thread writes m_document, so reading it needs no lock.
+    LazyJSONDocument* document = m_document.get();
+    if (!document)
+        return true;
+    // Shells for nested objects take their own references to the document.
+    bool built = false;
+    switch (document->encoding) {
+    case RowEncoding::Latin1:
+        built = RowsToJS<RowEncoding::Latin1>(globalObject, document->props, document->items, document).putProperties(this, m_rows, m_count, nullptr);
+        break;
+    case RowEncoding::Utf16:
+        built = RowsToJS<RowEncoding::Utf16>(globalObject, document->props, document->items, document).putProperties(this, m_rows, m_count, nullptr);
+        break;
+    case RowEncoding::Utf8:
+        built = RowsToJS<RowEncoding::Utf8>(globalObject, document->props, document->items, document).putProperties(this, m_rows, m_count, nullptr);
+        break;
+    }
+    // On failure the document stays, so the next touch builds the properties again (putDirect
+    // overwrites the ones this attempt got to) instead of exposing a subset of them.
+    if (!built)
+        return false;
+    Locker locker { cellLock() };
+    m_document = nullptr;
+    return true;
+}
+
+bool JSLazyJSONObject::getOwnPropertySlot(JSObject* object, JSGlobalObject* globalObject, PropertyName propertyName, PropertySlot& slot)
+{
+    auto* thisObject = uncheckedDowncast<JSLazyJSONObject>(object);
+    if (thisObject->m_document && thisObject->mayHaveKey(propertyName)) {
+        // A VM inquiry can't run user-visible work or throw; report the object as opaque.
+        if (slot.isVMInquiry()) {
+            slot.setIsTaintedByOpaqueObject();
+            return false;
+        }
+        auto scope = DECLARE_THROW_SCOPE(getVM(globalObject));
+        bool ok = thisObject->materialize(globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        ASSERT_UNUSED(ok, ok);
+    }
+    return Base::getOwnPropertySlot(object, globalObject, propertyName, slot);
+}
+
+// The remaining hooks build the properties and then behave like any object.
+#define LAZY_JSON_MATERIALIZE_OR_RETURN(cell, result)                             \
+    do {                                                                          \
+        auto scope = DECLARE_THROW_SCOPE(getVM(globalObject));                    \
+        uncheckedDowncast<JSLazyJSONObject>(cell)->materialize(globalObject);     \
+        RETURN_IF_EXCEPTION(scope, result);                                       \
+    } while (false)
+
+bool JSLazyJSONObject::getOwnPropertySlotByIndex(JSObject* object, JSGlobalObject* globalObject, unsigned index, PropertySlot& slot)
+{
+    if (slot.isVMInquiry() && uncheckedDowncast<JSLazyJSONObject>(object)->m_document) {
+        slot.setIsTaintedByOpaqueObject();
+        return false;
+    }
+    LAZY_JSON_MATERIALIZE_OR_RETURN(object, false);
+    return Base::getOwnPropertySlotByIndex(object, globalObject, index, slot);
+}
+
+bool JSLazyJSONObject::put(JSCell* cell, JSGlobalObject* globalObject, PropertyName propertyName, JSValue value, PutPropertySlot& slot)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(cell, false);
+    return Base::put(cell, globalObject, propertyName, value, slot);
+}
+
+bool JSLazyJSONObject::putByIndex(JSCell* cell, JSGlobalObject* globalObject, unsigned index, JSValue value, bool shouldThrow)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(cell, false);
+    return Base::putByIndex(cell, globalObject, index, value, shouldThrow);
+}
+
+bool JSLazyJSONObject::defineOwnProperty(JSObject* object, JSGlobalObject* globalObject, PropertyName propertyName, const PropertyDescriptor& descriptor, bool shouldThrow)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(object, false);
+    return Base::defineOwnProperty(object, globalObject, propertyName, descriptor, shouldThrow);
+}
+
+bool JSLazyJSONObject::deleteProperty(JSCell* cell, JSGlobalObject* globalObject, PropertyName propertyName, DeletePropertySlot& slot)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(cell, false);
+    return Base::deleteProperty(cell, globalObject, propertyName, slot);
+}
+
+bool JSLazyJSONObject::deletePropertyByIndex(JSCell* cell, JSGlobalObject* globalObject, unsigned index)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(cell, false);
+    return Base::deletePropertyByIndex(cell, globalObject, index);
+}
+
+void JSLazyJSONObject::getOwnPropertyNames(JSObject* object, JSGlobalObject* globalObject, PropertyNameArrayBuilder& names, DontEnumPropertiesMode mode)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(object, void());
+    Base::getOwnPropertyNames(object, globalObject, names, mode);
+}
+
+bool JSLazyJSONObject::preventExtensions(JSObject* object, JSGlobalObject* globalObject)
+{
+    LAZY_JSON_MATERIALIZE_OR_RETURN(object, false);
+    return Base::preventExtensions(object, globalObject);
+}
+
+#undef LAZY_JSON_MATERIALIZE_OR_RETURN
+
+Structure* createLazyJSONObjectStructure(VM& vm, JSGlobalObject* globalObject)
+{
+    return JSLazyJSONObject::createStructure(vm, globalObject, globalObject->objectPrototype());
+}
+
 extern "C" EncodedJSValue Bun__JSONRows__toJS(JSGlobalObject* globalObject, const RowValue* root, const RowProperty* props, const RowValue* items, uint8_t encoding)
 {
     switch (static_cast<RowEncoding>(encoding)) {
@@ -226,4 +610,31 @@ extern "C" EncodedJSValue Bun__JSONRows__toJS(JSGlobalObject* globalObject, cons
     return JSValue::encode(RowsToJS<RowEncoding::Utf8>(globalObject, props, items).value(*root));
 }
 
+// Like Bun__JSONRows__toJS, but objects are built on first use. `owner` keeps the rows valid
+// and is handed to `release` once nothing refers to them any more (right away when no object
+// ended up lazy, e.g. `[]` or `{}`). `cost` is the memory held by `owner`, charged to the GC
+// for as long as any lazy object still refers to it.
+extern "C" EncodedJSValue Bun__JSONRows__toLazyJS(JSGlobalObject* globalObject, const RowValue* root, const RowProperty* props, const RowValue* items, uint8_t encoding, void* owner, LazyJSONDocument::Release release, size_t cost)
+{
+    auto& vm = globalObject->vm();
+    auto document = LazyJSONDocument::create(props, items, static_cast<RowEncoding>(encoding), owner, release, cost);
+    JSValue result;
+    switch (document->encoding) {
+    case RowEncoding::Latin1:
+        result = RowsToJS<RowEncoding::Latin1>(globalObject, props, items, document.ptr()).value(*root);
+        break;
+    case RowEncoding::Utf16:
+        result = RowsToJS<RowEncoding::Utf16>(globalObject, props, items, document.ptr()).value(*root);
+        break;
+    case RowEncoding::Utf8:
+        result = RowsToJS<RowEncoding::Utf8>(globalObject, props, items, document.ptr()).value(*root);
+        break;
+    }
+    // The shells hold the other references. The root is a lazy object or an array holding
+    // some, so it stands in for the document here; later cycles are charged by the shells.
+    if (!document->hasOneRef() && result.isCell())
+        vm.heap.reportExtraMemoryAllocated(result.asCell(), cost);
+    return JSValue::encode(result);
+}
+
 } // namespace Bun
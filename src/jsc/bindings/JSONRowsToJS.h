@@ -0,0 +1,11 @@
+#pragma once
+
+#include "root.h"
+
+namespace Bun {
+
+// Structure for the objects Bun__JSONRows__toLazyJS returns before their
+// properties are built (Bun.JSONC.parse(text, { lazy: true })).
+JSC::Structure* createLazyJSONObjectStructure(JSC::VM&, JSC::JSGlobalObject*);
+
+}
@@ -78,11 +78,12 @@ static bool svValueHasToken(std::string_view value, std::string_view lowerToken)
 }
 
 // One pass over the request: append url, method and jsNumber(dispatch
-// bitfield) to `args`, and capture the raw header bytes into `flatHeaders`
-// as [u32 nameLen][u32 valueLen][name][value]... so req.rawHeaders /
+// bitfield) to `args`, and return the size of the raw header section that
+// captureRawRequestHeaders writes once the NodeHTTPResponse exists. The
+// section is [u32 nameLen][u32 valueLen][name][value]... so req.rawHeaders /
 // req.headers can be materialized lazily (Bun__NodeHTTP__buildRawHeadersArray)
 // only when user code reads them.
-static void assignHeadersFromUWebSocketsForCall(uWS::HttpRequest* request, JSValue methodString, MarkedArgumentBuffer& args, WTF::Vector<uint8_t, 1024>& flatHeaders, JSC::JSGlobalObject* globalObject, JSC::VM& vm)
+static size_t assignHeadersFromUWebSocketsForCall(uWS::HttpRequest* request, JSValue methodString, MarkedArgumentBuffer& args, JSC::JSGlobalObject* globalObject, JSC::VM& vm)
 {
     {
         std::string_view fullURLStdStr = request->getFullUrl();
@@ -103,25 +104,12 @@ static void assignHeadersFromUWebSocketsForCall(uWS::HttpRequest* request, JSVal
     // the parser's own Host/Expect handling, while req.rawHeaders/req.headers
     // still apply the server.maxHeadersCount truncation on materialization.
     uint32_t bits = 0;
+    size_t rawHeadersSize = 0;
     for (auto it = request->begin(); it != request->end(); ++it) {
         auto pair = *it;
         const std::string_view name = pair.first;
         const std::string_view value = pair.second;
-
-        // u32 length prefixes: header sizes are usually tiny, but maxHeaderSize
-        // is user-configurable with no upper bound, so a u16 would silently
-        // truncate a >64 KiB value and desync the buffer.
-        const uint32_t nameLen = static_cast<uint32_t>(name.length());
-        const uint32_t valueLen = static_cast<uint32_t>(value.length());
-        uint8_t lens[8] = {
-            static_cast<uint8_t>(nameLen & 0xff), static_cast<uint8_t>((nameLen >> 8) & 0xff),
-            static_cast<uint8_t>((nameLen >> 16) & 0xff), static_cast<uint8_t>(nameLen >> 24),
-            static_cast<uint8_t>(valueLen & 0xff), static_cast<uint8_t>((valueLen >> 8) & 0xff),
-            static_cast<uint8_t>((valueLen >> 16) & 0xff), static_cast<uint8_t>(valueLen >> 24)
-        };
-        flatHeaders.append(std::span<const uint8_t> { lens, 8 });
-        flatHeaders.append(std::span<const uint8_t> { reinterpret_cast<const uint8_t*>(name.data()), name.length() });
-        flatHeaders.append(std::span<const uint8_t> { reinterpret_cast<const uint8_t*>(value.data()), value.length() });
+        rawHeadersSize += 8 + name.length() + value.length();
 
         // Duplicate headers OR their token bits (the lazy header build joins
         // duplicates with ", ", and a token match on the joined value is a
@@ -164,6 +152,42 @@ static void assignHeadersFromUWebSocketsForCall(uWS::HttpRequest* request, JSVal
     // The headers-object slot now carries the dispatch bitfield; rawHeaders
     // materialize lazily from the captured bytes, so no array is passed.
     args.append(jsNumber(bits));
+    return rawHeadersSize;
+}
+
+// Writes the header section sized by assignHeadersFromUWebSocketsForCall
+// straight into the NodeHTTPResponse's buffer, a recycled slab, so a request
+// whose handler never reads its headers costs one copy and no allocation.
+static void captureRawRequestHeaders(uWS::HttpRequest* request, uint8_t* out, size_t size)
+{
+    uint8_t* const end = out + size;
+    for (auto it = request->begin(); it != request->end(); ++it) {
+        auto pair = *it;
+        const std::string_view name = pair.first;
+        const std::string_view value = pair.second;
+
+        // u32 length prefixes: header sizes are usually tiny, but maxHeaderSize
+        // is user-configurable with no upper bound, so a u16 would silently
+        // truncate a >64 KiB value and desync the buffer.
+        const uint32_t nameLen = static_cast<uint32_t>(name.length());
+        const uint32_t valueLen = static_cast<uint32_t>(value.length());
+        RELEASE_ASSERT(static_cast<size_t>(end - out) >= 8 + static_cast<size_t>(nameLen) + valueLen);
+        uint8_t lens[8] = {
+            static_cast<uint8_t>(nameLen & 0xff), static_cast<uint8_t>((nameLen >> 8) & 0xff),
+            static_cast<uint8_t>((nameLen >> 16) & 0xff), static_cast<uint8_t>(nameLen >> 24),
+            static_cast<uint8_t>(valueLen & 0xff), static_cast<uint8_t>((valueLen >> 8) & 0xff),
+            static_cast<uint8_t>((valueLen >> 16) & 0xff), static_cast<uint8_t>(valueLen >> 24)
+        };
+        memcpy(out, lens, 8);
+        out += 8;
+        if (nameLen)
+            memcpy(out, name.data(), nameLen);
+        out += nameLen;
+        if (valueLen)
+            memcpy(out, value.data(), valueLen);
+        out += valueLen;
+    }
+    ASSERT(out == end);
 }
 
 // Builds the rawHeaders flat array [name, value, ...] from the bytes captured
@@ -234,9 +258,10 @@ extern "C" EncodedJSValue Bun__NodeHTTP__buildRawHeadersArray(JSC::JSGlobalObjec
     RELEASE_AND_RETURN(scope, JSValue::encode(array));
 }
 
-// Defined in Rust (NodeHTTPResponse.rs): moves the captured raw header bytes
-// onto the native response so takeRawHeaders can materialize them on demand.
-extern "C" void NodeHTTPResponse__adoptRawRequestHeaders(void* nodeHttpResponse, const uint8_t* data, size_t length);
+// Defined in Rust (NodeHTTPResponse.rs): the native response's buffer for the
+// captured raw header bytes, `length` bytes long, so takeRawHeaders can
+// materialize them on demand.
+extern "C" uint8_t* NodeHTTPResponse__reserveRawRequestHeaders(void* nodeHttpResponse, size_t length);
 
 template<bool isSSL>
 static void assignOnNodeJSCompat(uWS::TemplatedApp<isSSL>* app)
@@ -304,16 +329,14 @@ static EncodedJSValue NodeHTTPServer__onRequest(
     MarkedArgumentBuffer args;
     args.append(thisValue);
 
-    // Typical request header sections are a few hundred bytes; the inline
-    // capacity keeps the capture heap-allocation-free for the common case.
-    WTF::Vector<uint8_t, 1024> flatHeaders;
-    assignHeadersFromUWebSocketsForCall(request, methodString, args, flatHeaders, globalObject, vm);
+    size_t rawHeadersSize = assignHeadersFromUWebSocketsForCall(request, methodString, args, globalObject, vm);
     RETURN_IF_EXCEPTION(scope, {});
 
     bool hasBody = false;
     WebCore::JSNodeHTTPResponse* nodeHTTPResponseObject = uncheckedDowncast<WebCore::JSNodeHTTPResponse>(JSValue::decode(NodeHTTPResponse__createForJS(any_server, globalObject, &hasBody, request, isSSL, response, upgrade_ctx, nodeHttpResponsePtr)));
-    if (!flatHeaders.isEmpty()) {
-        NodeHTTPResponse__adoptRawRequestHeaders(*nodeHttpResponsePtr, flatHeaders.span().data(), flatHeaders.size());
+    if (rawHeadersSize) {
+        uint8_t* rawHeaders = NodeHTTPResponse__reserveRawRequestHeaders(*nodeHttpResponsePtr, rawHeadersSize);
+        captureRawRequestHeaders(request, rawHeaders, rawHeadersSize);
     }
 
     args.append(nodeHTTPResponseObject);
@@ -416,11 +439,110 @@ static bool connectionValueHasClose(const WTF::String& value)
     return false;
 }
 
+static void appendHeaderText(Vector<uint8_t>& bytes, const WTF::StringView& text)
+{
+    if (text.is8Bit()) {
+        const auto span = text.span8();
+        bytes.append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(span.data()), span.size()));
+        return;
+    }
+    WTF::CString utf8 = text.utf8();
+    bytes.append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(utf8.data()), utf8.length()));
+}
+
+static void appendHeaderLine(Vector<uint8_t>& bytes, const WTF::StringView& name, const WTF::StringView& value)
+{
+    appendHeaderText(bytes, name);
+    bytes.append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(": "), 2));
+    appendHeaderText(bytes, value);
+    bytes.append(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>("\r\n"), 2));
+}
+
+// The bytes and response-state effects of the loop in
+// writeFetchHeadersToUWSResponse, for headers that are written unchanged to
+// many responses (a shared `Headers` of CORS / cache-control values).
+static std::unique_ptr<WebCore::FetchHeaders::WireBlock> serializeFetchHeaders(const WebCore::HTTPHeaderMap& internalHeaders)
+{
+    auto block = makeUnique<WebCore::FetchHeaders::WireBlock>();
+    auto& bytes = block->bytes;
+    for (auto& value : internalHeaders.getSetCookieHeaders())
+        appendHeaderLine(bytes, "set-cookie"_s, value);
+    for (const auto& header : internalHeaders.commonHeaders()) {
+        switch (header.key) {
+        case WebCore::HTTPHeaderName::ContentLength:
+            if (block->contentLengthOffset == notFound)
+                block->contentLengthOffset = bytes.size();
+            break;
+        case WebCore::HTTPHeaderName::Date:
+            block->hasDate = true;
+            if (block->contentLengthOffset == notFound)
+                block->hasDateBeforeContentLength = true;
+            break;
+        case WebCore::HTTPHeaderName::TransferEncoding:
+            block->hasTransferEncoding = true;
+            break;
+        case WebCore::HTTPHeaderName::Connection:
+            block->hasConnectionClose |= connectionValueHasClose(header.value);
+            break;
+        default:
+            break;
+        }
+        appendHeaderLine(bytes, WebCore::httpHeaderNameString(header.key), header.value);
+    }
+    for (auto& header : internalHeaders.uncommonHeaders())
+        appendHeaderLine(bytes, header.key, header.value);
+    bytes.shrinkToFit();
+    return block;
+}
+
+template<bool isSSL>
+static void writeHeaderBlock(uWS::HttpResponse<isSSL>* res, std::span<const uint8_t> bytes)
+{
+    if (!bytes.empty())
+        res->writeHeaderBlock(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+}
+
+// Same output as the per-header loop: Content-Length still writes uWS's Date
+// header right before it, unless a Date header came first.
+template<bool isSSL>
+static void writeWireBlockToUWSResponse(const WebCore::FetchHeaders::WireBlock& block, uWS::HttpResponse<isSSL>* res)
+{
+    auto* data = res->getHttpResponseData();
+    if (block.hasTransferEncoding)
+        data->state |= uWS::HttpResponseData<isSSL>::HTTP_WROTE_TRANSFER_ENCODING_HEADER;
+    if (block.hasConnectionClose)
+        data->state |= uWS::HttpResponseData<isSSL>::HTTP_CONNECTION_CLOSE;
+
+    std::span<const uint8_t> bytes = block.bytes.span();
+    if (block.contentLengthOffset != notFound) {
+        if (block.hasDateBeforeContentLength)
+            data->state |= uWS::HttpResponseData<isSSL>::HTTP_WROTE_DATE_HEADER;
+        writeHeaderBlock<isSSL>(res, bytes.first(block.contentLengthOffset));
+        if (!(data->state & uWS::HttpResponseData<isSSL>::HTTP_WROTE_CONTENT_LENGTH_HEADER)) {
+            data->state |= uWS::HttpResponseData<isSSL>::HTTP_WROTE_CONTENT_LENGTH_HEADER;
+            res->writeMark();
+        }
+        bytes = bytes.subspan(block.contentLengthOffset);
+    }
+    writeHeaderBlock<isSSL>(res, bytes);
+
+    if (block.hasDate)
+        data->state |= uWS::HttpResponseData<isSSL>::HTTP_WROTE_DATE_HEADER;
+}
+
 template<bool isSSL>
 static void writeFetchHeadersToUWSResponse(WebCore::FetchHeaders& headers, uWS::HttpResponse<isSSL>* res)
 {
     auto& internalHeaders = headers.internalHeaders();
 
+    // Headers written to a second response without changing in between (or
+    // copies of one Headers object, one per Response) are kept serialized and
+    // copied into the response as is.
+    if (auto* block = headers.wireBlockForWrite([&] { return serializeFetchHeaders(internalHeaders); })) {
+        writeWireBlockToUWSResponse<isSSL>(*block, res);
+        return;
+    }
+
     for (auto& value : internalHeaders.getSetCookieHeaders()) {
 
         if (value.is8Bit()) {
@@ -39,6 +39,7 @@ class JSNextTickQueue;
 class Process;
 class SecureContextCache;
 class GCProfilerObserver;
+class BufferPool;
 } // namespace Bun
 
 namespace v8 {
@@ -624,6 +625,7 @@ public:
     V(public, LazyClassStructure, m_JSHTTPParserClassStructure)                                              \
                                                                                                              \
     V(private, LazyPropertyOfGlobalObject<Structure>, m_jsonlParseResultStructure)                           \
+    V(private, LazyPropertyOfGlobalObject<Structure>, m_lazyJSONObjectStructure)                             \
     V(private, LazyPropertyOfGlobalObject<Structure>, m_pathParsedObjectStructure)                           \
     V(private, LazyPropertyOfGlobalObject<Structure>, m_pendingVirtualModuleResultStructure)                 \
     V(private, LazyPropertyOfGlobalObject<Structure>, m_JSSocketHandlersStructure)                           \
@@ -765,6 +767,7 @@ public:
     void clearModuleRegistry();
 
     JSC::Structure* jsonlParseResultStructure() { return m_jsonlParseResultStructure.get(this); }
+    JSC::Structure* lazyJSONObjectStructure() { return m_lazyJSONObjectStructure.get(this); }
     JSC::Structure* pathParsedObjectStructure() { return m_pathParsedObjectStructure.get(this); }
     JSC::Structure* pendingVirtualModuleResultStructure() { return m_pendingVirtualModuleResultStructure.get(this); }
     JSC::Structure* JSSocketHandlersStructure() { return m_JSSocketHandlersStructure.get(this); }
@@ -834,6 +837,10 @@ public:
     // does not leave the observer registered.
     std::unique_ptr<Bun::GCProfilerObserver> m_gcProfilerObserver;
 
+    // Slabs behind Buffer.allocUnsafe() and Buffer.from(string); see
+    // BunBufferPool.h. Created on first use.
+    std::unique_ptr<Bun::BufferPool> m_bufferPool;
+
     WTF::Vector<WTF::Ref<NapiEnv>> m_napiEnvs;
     Ref<NapiEnv> makeNapiEnv(const napi_module&);
     napi_env makeNapiEnvForFFI();
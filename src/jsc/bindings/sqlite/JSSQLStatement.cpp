@@ -52,6 +52,13 @@
 #include "wtf/text/StringToIntegerConversion.h"
 #include <JavaScriptCore/InternalFieldTuple.h>
 #include "BunString.h"
+#include "BunClientData.h"
+#include "ScriptExecutionContext.h"
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <variant>
 static constexpr int32_t kSafeIntegersFlag = 1 << 1;
 static constexpr int32_t kStrictFlag = 1 << 2;
 static constexpr int32_t kOwnedByDatabaseFlag = 1 << 3;
@@ -201,6 +208,7 @@ static inline JSC::JSValue jsBigIntFromSQLite(JSC::JSGlobalObject* globalObject,
 namespace WebCore {
 class JSSQLStatement;
 static ASCIILiteral finalizedMessage(const JSSQLStatement* statement);
+static void closeSQLitePoolsForTermination(JSC::VM&);
 }
 
 DECLARE_ALLOCATOR_WITH_HEAP_IDENTIFIER(VersionSqlite3);
@@ -301,10 +309,11 @@ extern "C" void Bun__sqliteCheckpointForTermination(sqlite3* db)
 // joined: closes the connections that VM opened and never touches another VM's entries.
 extern "C" void Bun__closeAllSQLiteDatabasesForTermination(JSC::JSGlobalObject* globalObject)
 {
+    JSC::VM* exitingVM = &globalObject->vm();
+    WebCore::closeSQLitePoolsForTermination(*exitingVM);
     if (!_instance) {
         return;
     }
-    JSC::VM* exitingVM = &globalObject->vm();
     WTF::Locker locker { databasesLock };
     auto& dbs = _instance->databases;
 
@@ -331,6 +340,9 @@ using namespace JSC;
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementPrepareStatementFunction);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteFunction);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementOpenStatementFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementOpenPoolFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementPoolQueryFunction);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementClosePoolFunction);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementIsInTransactionFunction);
 
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementLoadExtensionFunction);
@@ -341,6 +353,7 @@ JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionIterate);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRows);
 JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionRawRows);
+JSC_DECLARE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionColumnar);
 
 JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnNames);
 JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnCount);
@@ -362,17 +375,18 @@ JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetColumnDeclaredTypes);
 JSC_DECLARE_CUSTOM_GETTER(jsSqlStatementGetSafeIntegers);
 JSC_DECLARE_CUSTOM_SETTER(jsSqlStatementSetSafeIntegers);
 
-static JSValue createSQLiteError(JSC::JSGlobalObject* globalObject, sqlite3* db)
+// Error messages can echo identifiers/values from the query, which SQLite does
+// not validate as UTF-8, so decode leniently to avoid dropping the message.
+static WTF::String sqliteErrorMessage(sqlite3* db)
 {
-    auto& vm = JSC::getVM(globalObject);
-    int code = sqlite3_extended_errcode(db);
-    int byteOffset = sqlite3_error_offset(db);
-
     const char* msg = sqlite3_errmsg(db);
-    // Error messages can echo identifiers/values from the query, which SQLite does
-    // not validate as UTF-8, so decode leniently to avoid dropping the message.
-    WTF::String str = WTF::String::fromUTF8ReplacingInvalidSequences({ reinterpret_cast<const unsigned char*>(msg), strlen(msg) });
-    JSC::JSObject* object = JSC::createError(globalObject, str);
+    return WTF::String::fromUTF8ReplacingInvalidSequences({ reinterpret_cast<const unsigned char*>(msg), strlen(msg) });
+}
+
+static JSValue createSQLiteError(JSC::JSGlobalObject* globalObject, int code, int byteOffset, const WTF::String& message)
+{
+    auto& vm = JSC::getVM(globalObject);
+    JSC::JSObject* object = JSC::createError(globalObject, message);
     auto& builtinNames = WebCore::builtinNames(vm);
     object->putDirect(vm, vm.propertyNames->name, jsString(vm, String("SQLiteError"_s)), JSC::PropertyAttribute::DontEnum | 0);
 
@@ -397,6 +411,11 @@ static JSValue createSQLiteError(JSC::JSGlobalObject* globalObject, sqlite3* db)
     return object;
 }
 
+static JSValue createSQLiteError(JSC::JSGlobalObject* globalObject, sqlite3* db)
+{
+    return createSQLiteError(globalObject, sqlite3_extended_errcode(db), sqlite3_error_offset(db), sqliteErrorMessage(db));
+}
+
 class SQLiteBindingsMap {
 public:
     SQLiteBindingsMap() = default;
@@ -678,6 +697,7 @@ static const HashTableValue JSSQLStatementPrototypeTableValues[] = {
     { "as"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementSetPrototypeFunction, 1 } },
     { "values"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRows, 1 } },
     { "raw"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionRawRows, 1 } },
+    { "columnar"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementExecuteStatementFunctionColumnar, 2 } },
     { "finalize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementFunctionFinalize, 0 } },
     { "toString"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementToStringFunction, 0 } },
     { "columns"_s, static_cast<unsigned>(JSC::PropertyAttribute::ReadOnly | JSC::PropertyAttribute::CustomAccessor), NoIntrinsic, { HashTableValue::GetterSetterType, jsSqlStatementGetColumnNames, 0 } },
@@ -1990,6 +2010,9 @@ static const HashTableValue JSSQLStatementConstructorTableValues[] = {
     { "serialize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementSerialize, 1 } },
     { "deserialize"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementDeserialize, 2 } },
     { "fcntl"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementFcntlFunction, 2 } },
+    { "openPool"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementOpenPoolFunction, 4 } },
+    { "poolQuery"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementPoolQueryFunction, 5 } },
+    { "closePool"_s, static_cast<unsigned>(JSC::PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, jsSQLStatementClosePoolFunction, 1 } },
 };
 
 const ClassInfo JSSQLStatementConstructor::s_info = { "SQLStatement"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(JSSQLStatementConstructor) };
@@ -2231,6 +2254,422 @@ JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionIterate, (JSC::JS
     }
 }
 
+// Columnar results: instead of one object or array per row, columnar() writes each
+// column into a contiguous buffer and hands back one typed array per column, so a
+// chunk of N rows costs a handful of cells rather than N.
+//
+// Text is dictionary-encoded per chunk. Each distinct UTF-8 value is stored once
+// and the column holds Uint32 indices into it, so repeated values (the common
+// case for reporting queries) are only decoded into a JSString once.
+class SQLiteColumnarDictionary {
+public:
+    uint32_t add(std::span<const uint8_t> bytes)
+    {
+        if ((m_hashes.size() + 1) * 2 > m_table.size())
+            grow();
+
+        uint32_t hash = hashBytes(bytes);
+        size_t mask = m_table.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            uint32_t entry = m_table[slot];
+            if (!entry) {
+                uint32_t index = m_hashes.size();
+                m_table[slot] = index + 1;
+                m_hashes.append(hash);
+                m_bytes.append(bytes);
+                m_offsets.append(m_bytes.size());
+                return index;
+            }
+
+            uint32_t index = entry - 1;
+            if (m_hashes[index] == hash && equalSpans(at(index), bytes))
+                return index;
+        }
+    }
+
+    size_t size() const { return m_hashes.size(); }
+
+    std::span<const uint8_t> at(size_t index) const
+    {
+        return m_bytes.span().subspan(m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+    }
+
+private:
+    static uint32_t hashBytes(std::span<const uint8_t> bytes)
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        for (uint8_t byte : bytes) {
+            hash ^= byte;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    void grow()
+    {
+        size_t capacity = std::max<size_t>(m_table.size() * 2, 16);
+        m_table.fill(0, capacity);
+        size_t mask = capacity - 1;
+        for (uint32_t index = 0; index < m_hashes.size(); index++) {
+            size_t slot = m_hashes[index] & mask;
+            while (m_table[slot])
+                slot = (slot + 1) & mask;
+            m_table[slot] = index + 1;
+        }
+    }
+
+    Vector<uint32_t> m_table;
+    Vector<uint32_t> m_hashes;
+    Vector<uint32_t, 1> m_offsets { 0 };
+    Vector<uint8_t> m_bytes;
+};
+
+// Each column picks its storage from the first non-NULL value it sees and falls
+// back to a plain array of JS values if a later row does not fit.
+struct SQLiteColumnarColumn {
+    enum class Kind : uint8_t {
+        Null,
+        Number,
+        BigInt,
+        Text,
+        Mixed,
+    };
+
+    Kind kind = Kind::Null;
+    bool hasFloats = false;
+    bool hasNulls = false;
+    Vector<uint8_t> nulls;
+    Vector<double> numbers;
+    Vector<int64_t> bigints;
+    Vector<uint32_t> indices;
+    SQLiteColumnarDictionary dictionary;
+    JSC::JSArray* mixed = nullptr;
+};
+
+static JSValue columnarDictionaryString(JSC::VM& vm, std::span<const uint8_t> bytes)
+{
+    if (bytes.empty())
+        return jsEmptyString(vm);
+    return jsString(vm, WTF::String::fromUTF8ReplacingInvalidSequences(bytes));
+}
+
+static void convertColumnarColumnToMixed(JSC::VM& vm, JSC::JSGlobalObject* lexicalGlobalObject, SQLiteColumnarColumn& column, MarkedArgumentBuffer& roots)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    // The row being appended has already recorded its null flag.
+    size_t length = column.nulls.size() - 1;
+
+    MarkedArgumentBuffer strings;
+    if (column.kind == SQLiteColumnarColumn::Kind::Text) {
+        strings.ensureCapacity(column.dictionary.size());
+        for (size_t i = 0; i < column.dictionary.size(); i++)
+            strings.append(columnarDictionaryString(vm, column.dictionary.at(i)));
+    }
+
+    JSC::JSArray* array = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), 0);
+    RETURN_IF_EXCEPTION(scope, );
+    roots.append(array);
+
+    for (size_t row = 0; row < length; row++) {
+        JSValue value = jsNull();
+        if (!column.nulls[row]) {
+            switch (column.kind) {
+            case SQLiteColumnarColumn::Kind::Number:
+                value = jsNumber(column.numbers[row]);
+                break;
+            case SQLiteColumnarColumn::Kind::BigInt:
+                value = JSC::JSBigInt::createFrom(lexicalGlobalObject, column.bigints[row]);
+                RETURN_IF_EXCEPTION(scope, );
+                break;
+            case SQLiteColumnarColumn::Kind::Text:
+                value = strings.at(column.indices[row]);
+                break;
+            default:
+                break;
+            }
+        }
+        array->putDirectIndex(lexicalGlobalObject, row, value);
+        RETURN_IF_EXCEPTION(scope, );
+    }
+
+    column.kind = SQLiteColumnarColumn::Kind::Mixed;
+    column.mixed = array;
+    column.numbers.clear();
+    column.bigints.clear();
+    column.indices.clear();
+}
+
+template<bool useBigInt64>
+static void appendColumnarValue(JSC::VM& vm, JSC::JSGlobalObject* lexicalGlobalObject, sqlite3_stmt* stmt, int i, SQLiteColumnarColumn& column, MarkedArgumentBuffer& roots)
+{
+    using Kind = SQLiteColumnarColumn::Kind;
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    int type = sqlite3_column_type(stmt, i);
+    size_t row = column.nulls.size();
+    column.nulls.append(type == SQLITE_NULL);
+
+    if (type == SQLITE_NULL) {
+        column.hasNulls = true;
+        switch (column.kind) {
+        case Kind::Null:
+            break;
+        case Kind::Number:
+            column.numbers.append(0);
+            break;
+        case Kind::BigInt:
+            column.bigints.append(0);
+            break;
+        case Kind::Text:
+            column.indices.append(0);
+            break;
+        case Kind::Mixed:
+            column.mixed->putDirectIndex(lexicalGlobalObject, row, jsNull());
+            RETURN_IF_EXCEPTION(scope, );
+            break;
+        }
+        return;
+    }
+
+    if (column.kind == Kind::Null) {
+        switch (type) {
+        case SQLITE_INTEGER:
+            column.kind = useBigInt64 ? Kind::BigInt : Kind::Number;
+            break;
+        case SQLITE_FLOAT:
+            column.kind = Kind::Number;
+            break;
+        case SQLITE3_TEXT:
+            column.kind = Kind::Text;
+            break;
+        default:
+            column.kind = Kind::Mixed;
+            break;
+        }
+
+        // Everything before this row was NULL.
+        switch (column.kind) {
+        case Kind::Number:
+            column.numbers.fill(0, row);
+            break;
+        case Kind::BigInt:
+            column.bigints.fill(0, row);
+            break;
+        case Kind::Text:
+            column.indices.fill(0, row);
+            break;
+        default:
+            convertColumnarColumnToMixed(vm, lexicalGlobalObject, column, roots);
+            RETURN_IF_EXCEPTION(scope, );
+            break;
+        }
+    }
+
+    switch (column.kind) {
+    case Kind::Number:
+        if (type == SQLITE_FLOAT) {
+            column.hasFloats = true;
+            column.numbers.append(sqlite3_column_double(stmt, i));
+            return;
+        }
+        if (!useBigInt64 && type == SQLITE_INTEGER) {
+            column.numbers.append(static_cast<double>(sqlite3_column_int64(stmt, i)));
+            return;
+        }
+        break;
+    case Kind::BigInt:
+        if (type == SQLITE_INTEGER) {
+            column.bigints.append(sqlite3_column_int64(stmt, i));
+            return;
+        }
+        break;
+    case Kind::Text:
+        if (type == SQLITE3_TEXT) {
+            size_t len = sqlite3_column_bytes(stmt, i);
+            const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
+            column.indices.append(column.dictionary.add({ text, text ? len : 0 }));
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (column.kind != Kind::Mixed) {
+        convertColumnarColumnToMixed(vm, lexicalGlobalObject, column, roots);
+        RETURN_IF_EXCEPTION(scope, );
+    }
+
+    JSValue value = toJS<useBigInt64>(vm, lexicalGlobalObject, stmt, i);
+    RETURN_IF_EXCEPTION(scope, );
+    column.mixed->putDirectIndex(lexicalGlobalObject, row, value);
+    RETURN_IF_EXCEPTION(scope, );
+}
+
+template<typename TypedArray, typename T>
+static TypedArray* createColumnarTypedArray(JSC::JSGlobalObject* lexicalGlobalObject, JSC::Structure* structure, const Vector<T>& values)
+{
+    auto scope = DECLARE_THROW_SCOPE(lexicalGlobalObject->vm());
+    TypedArray* array = TypedArray::createUninitialized(lexicalGlobalObject, structure, values.size());
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!values.isEmpty())
+        memcpy(array->typedVector(), values.span().data(), values.sizeInBytes());
+    return array;
+}
+
+static JSC::JSObject* constructColumnarChunk(JSC::VM& vm, JSC::JSGlobalObject* lexicalGlobalObject, sqlite3_stmt* stmt, Vector<SQLiteColumnarColumn>& columns, size_t length)
+{
+    using Kind = SQLiteColumnarColumn::Kind;
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSC::JSArray* columnsArray = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), columns.size());
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    for (size_t i = 0; i < columns.size(); i++) {
+        auto& column = columns[i];
+        JSC::JSObject* object = JSC::constructEmptyObject(lexicalGlobalObject);
+
+        const char* name = sqlite3_column_name(stmt, i);
+        object->putDirect(vm, vm.propertyNames->name, name ? jsString(vm, WTF::String::fromUTF8ReplacingInvalidSequences({ reinterpret_cast<const unsigned char*>(name), strlen(name) })) : jsEmptyString(vm), 0);
+
+        ASCIILiteral type = "null"_s;
+        JSValue values;
+        switch (column.kind) {
+        case Kind::Null: {
+            JSC::JSArray* array = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), length);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            for (size_t row = 0; row < length; row++) {
+                array->putDirectIndex(lexicalGlobalObject, row, jsNull());
+                RETURN_IF_EXCEPTION(scope, nullptr);
+            }
+            values = array;
+            break;
+        }
+        case Kind::Number:
+            type = column.hasFloats ? "float"_s : "integer"_s;
+            values = createColumnarTypedArray<JSC::JSFloat64Array>(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructureWithTypedArrayType<TypedArrayType::TypeFloat64>(), column.numbers);
+            break;
+        case Kind::BigInt:
+            type = "integer"_s;
+            values = createColumnarTypedArray<JSC::JSBigInt64Array>(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructureWithTypedArrayType<TypedArrayType::TypeBigInt64>(), column.bigints);
+            break;
+        case Kind::Text: {
+            type = "text"_s;
+            values = createColumnarTypedArray<JSC::JSUint32Array>(lexicalGlobalObject, lexicalGlobalObject->typedArrayStructureWithTypedArrayType<TypedArrayType::TypeUint32>(), column.indices);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            JSC::JSArray* dictionary = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), column.dictionary.size());
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            for (size_t index = 0; index < column.dictionary.size(); index++) {
+                dictionary->putDirectIndex(lexicalGlobalObject, index, columnarDictionaryString(vm, column.dictionary.at(index)));
+                RETURN_IF_EXCEPTION(scope, nullptr);
+            }
+            object->putDirect(vm, Identifier::fromString(vm, "dictionary"_s), dictionary, 0);
+            break;
+        }
+        case Kind::Mixed:
+            type = "mixed"_s;
+            values = column.mixed;
+            break;
+        }
+        RETURN_IF_EXCEPTION(scope, nullptr);
+
+        object->putDirect(vm, Identifier::fromString(vm, "type"_s), jsString(vm, String(type)), 0);
+        object->putDirect(vm, Identifier::fromString(vm, "values"_s), values, 0);
+        if (column.hasNulls && column.kind != Kind::Null && column.kind != Kind::Mixed) {
+            // 1 marks a NULL row; the slot in `values` holds 0.
+            JSC::JSUint8Array* nulls = createColumnarTypedArray<JSC::JSUint8Array>(lexicalGlobalObject, lexicalGlobalObject->m_typedArrayUint8.get(lexicalGlobalObject), column.nulls);
+            RETURN_IF_EXCEPTION(scope, nullptr);
+            object->putDirect(vm, Identifier::fromString(vm, "nulls"_s), nulls, 0);
+        }
+
+        columnsArray->putDirectIndex(lexicalGlobalObject, i, object);
+        RETURN_IF_EXCEPTION(scope, nullptr);
+    }
+
+    JSC::JSObject* chunk = JSC::constructEmptyObject(lexicalGlobalObject);
+    chunk->putDirect(vm, vm.propertyNames->length, jsNumber(length), 0);
+    chunk->putDirect(vm, Identifier::fromString(vm, "columns"_s), columnsArray, 0);
+    return chunk;
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionColumnar, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto castedThis = dynamicDowncast<JSSQLStatement>(callFrame->thisValue());
+
+    CHECK_THIS
+
+    auto* stmt = castedThis->stmt;
+    CHECK_PREPARED
+
+    // 0 means "every remaining row".
+    size_t maxRows = 0;
+    JSValue maxRowsValue = callFrame->argument(0);
+    if (!maxRowsValue.isUndefined()) {
+        double number = maxRowsValue.isNumber() ? maxRowsValue.asNumber() : -1;
+        if (!(number >= 0 && number <= static_cast<double>(std::numeric_limits<uint32_t>::max()) && std::trunc(number) == number)) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createRangeError(lexicalGlobalObject, "Expected rowsPerChunk to be a non-negative integer"_s));
+            return {};
+        }
+        maxRows = static_cast<size_t>(number);
+    }
+
+    // Like iterate(), a chunked read that is part-way through its results carries
+    // on from where the previous chunk stopped. Reading everything starts over,
+    // like all().
+    int busy = sqlite3_stmt_busy(stmt);
+    if (!busy || maxRows == 0) {
+        int statusCode = sqlite3_reset(stmt);
+        if (statusCode != SQLITE_OK) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, sqlite3_db_handle(stmt)));
+            return {};
+        }
+    }
+
+    if (callFrame->argumentCount() > 1 && !callFrame->argument(1).isUndefined()) {
+        auto arg1 = callFrame->argument(1);
+        DO_REBIND(arg1);
+    }
+
+    int status = sqlite3_step(stmt);
+    if (!sqlite3_stmt_readonly(stmt)) {
+        castedThis->version_db->version++;
+    }
+
+    int columnCount = sqlite3_column_count(stmt);
+    Vector<SQLiteColumnarColumn> columns(columnCount);
+    MarkedArgumentBuffer roots;
+    size_t length = 0;
+    bool useBigInt64 = castedThis->useBigInt64;
+
+    while (status == SQLITE_ROW) {
+        for (int i = 0; i < columnCount; i++) {
+            if (useBigInt64)
+                appendColumnarValue<true>(vm, lexicalGlobalObject, stmt, i, columns[i], roots);
+            else
+                appendColumnarValue<false>(vm, lexicalGlobalObject, stmt, i, columns[i], roots);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        if (castedThis->stmt != stmt) [[unlikely]] {
+            throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, finalizedMessage(castedThis)));
+            return {};
+        }
+        if (++length == maxRows)
+            break;
+        status = sqlite3_step(stmt);
+    }
+
+    if (status != SQLITE_DONE && status != SQLITE_OK && status != SQLITE_ROW) [[unlikely]] {
+        throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, sqlite3_db_handle(stmt)));
+        sqlite3_reset(stmt);
+        return {};
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(constructColumnarChunk(vm, lexicalGlobalObject, stmt, columns, length)));
+}
+
 JSC_DEFINE_HOST_FUNCTION(jsSQLStatementExecuteStatementFunctionAll, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
 {
     auto& vm = JSC::getVM(lexicalGlobalObject);
@@ -2972,6 +3411,955 @@ void JSSQLStatement::visitOutputConstraints(JSCell* cell, Visitor& visitor)
 template void JSSQLStatement::visitOutputConstraints(JSCell*, AbstractSlotVisitor&);
 template void JSSQLStatement::visitOutputConstraints(JSCell*, SlotVisitor&);
 
+// Database#pool(): run queries off the JS thread.
+//
+// A pool owns its own connections to the database file: up to `readers`
+// read-only ones and a single writer. Queries are stepped on threads of the
+// pool's own, one per connection at most, and their rows come back to the JS
+// thread in batches, so a slow report no longer blocks the event loop. Those
+// threads are not Bun's WorkPool: a connection waiting out a lock held by
+// another one sleeps in sqlite3's busy handler, which would stall unrelated
+// work queued behind it. Read-only statements go to any idle reader;
+// anything else runs on the writer, which is only ever used by one thread at a
+// time, so writes stay serialized in submission order. The pool switches the
+// database to WAL so that readers don't block the writer or each other.
+//
+// close() stops new queries; queries already submitted still run, and each
+// connection is closed once its thread runs out of work. The JS-thread entry
+// for the pool is freed once it is closed and its last query has settled.
+//
+// Nothing JS-visible crosses threads. Bindings are copied into SQLitePoolValues
+// before dispatch, rows are copied out of sqlite3 into them on the worker, and
+// the JS values are only created once a batch is back on the JS thread.
+
+using SQLitePoolValue = std::variant<std::nullptr_t, int64_t, double, WTF::String, Vector<uint8_t>>;
+
+enum class SQLitePoolMode : uint8_t {
+    All = 0,
+    Values = 1,
+    Get = 2,
+    Run = 3,
+};
+
+// Rows are posted back to the JS thread this many at a time.
+static constexpr size_t kSQLitePoolBatchRows = 512;
+// Pool connections contend with each other and with the Database's own
+// connection for the write lock. Only ever waited out on the pool's threads.
+static constexpr int kSQLitePoolBusyTimeoutMs = 5000;
+
+struct SQLitePoolQuery {
+    WTF_DEPRECATED_MAKE_STRUCT_FAST_ALLOCATED(SQLitePoolQuery);
+
+    uint64_t id = 0;
+    SQLitePoolMode mode = SQLitePoolMode::All;
+    bool strict = false;
+    bool hasNamedBindings = false;
+    BunLoopKind loopKind = BunLoopKind::Regular;
+    CString sql;
+    Vector<SQLitePoolValue> values;
+    Vector<CString> names;
+};
+
+struct SQLitePoolBatch {
+    Vector<WTF::String> columnNames;
+    Vector<SQLitePoolValue> values;
+    size_t rowCount = 0;
+    bool done = false;
+    int64_t changes = 0;
+    int64_t lastInsertRowid = 0;
+    // Set when the query failed; errorCode is 0 for errors that did not come from sqlite3.
+    WTF::String error;
+    int errorCode = 0;
+    int errorOffset = -1;
+};
+
+class SQLitePool : public ThreadSafeRefCounted<SQLitePool> {
+public:
+    static Ref<SQLitePool> create(int32_t handle, CString&& path, unsigned maxReaders, sqlite3* writer, ScriptExecutionContextIdentifier context)
+    {
+        return adoptRef(*new SQLitePool(handle, WTF::move(path), maxReaders, writer, context));
+    }
+
+    // JS thread.
+    void submit(std::unique_ptr<SQLitePoolQuery>&&);
+
+    // Any thread.
+    void close()
+    {
+        Vector<sqlite3*> connections;
+        {
+            Locker locker { m_lock };
+            if (m_closed)
+                return;
+            m_closed = true;
+            connections = std::exchange(m_idleReaders, {});
+            if (m_writer && !m_writerBusy)
+                connections.append(std::exchange(m_writer, nullptr));
+            // Idle threads exit; busy ones once the queue is drained.
+            m_tasksChanged.notifyAll();
+        }
+        for (auto* db : connections)
+            sqlite3_close_v2(db);
+    }
+
+private:
+    SQLitePool(int32_t handle, CString&& path, unsigned maxReaders, sqlite3* writer, ScriptExecutionContextIdentifier context)
+        : m_handle(handle)
+        , m_path(WTF::move(path))
+        , m_maxReaders(maxReaders)
+        , m_context(context)
+        , m_hasWriter(writer)
+        , m_writer(writer)
+    {
+    }
+
+    enum class ExecuteResult : uint8_t {
+        Done,
+        NeedsWriter,
+    };
+
+    void dispatch(Function<void()>&&);
+    void runThread();
+    void runReader(sqlite3* reader, std::unique_ptr<SQLitePoolQuery>&&);
+    void runWriter(std::unique_ptr<SQLitePoolQuery>&&);
+    ExecuteResult execute(sqlite3*, SQLitePoolQuery&, bool isWriter);
+    void deliver(const SQLitePoolQuery&, SQLitePoolBatch&&);
+    void fail(const SQLitePoolQuery&, WTF::String&& message);
+    bool claimWriter(std::unique_ptr<SQLitePoolQuery>&) WTF_REQUIRES_LOCK(m_lock);
+
+    const int32_t m_handle;
+    const CString m_path;
+    const unsigned m_maxReaders;
+    const ScriptExecutionContextIdentifier m_context;
+    // False for a pool over a read-only database.
+    const bool m_hasWriter;
+
+    Lock m_lock;
+    bool m_closed WTF_GUARDED_BY_LOCK(m_lock) = false;
+    unsigned m_readerCount WTF_GUARDED_BY_LOCK(m_lock) = 0;
+    Vector<sqlite3*> m_idleReaders WTF_GUARDED_BY_LOCK(m_lock);
+    Deque<std::unique_ptr<SQLitePoolQuery>> m_readQueue WTF_GUARDED_BY_LOCK(m_lock);
+    // Null once closed.
+    sqlite3* m_writer WTF_GUARDED_BY_LOCK(m_lock) = nullptr;
+    bool m_writerBusy WTF_GUARDED_BY_LOCK(m_lock) = false;
+    Deque<std::unique_ptr<SQLitePoolQuery>> m_writeQueue WTF_GUARDED_BY_LOCK(m_lock);
+
+    // Work for the pool's threads. Each task holds a connection for as long as
+    // it runs, so there are never more of them than connections.
+    Deque<Function<void()>> m_tasks WTF_GUARDED_BY_LOCK(m_lock);
+    Condition m_tasksChanged;
+    unsigned m_threadCount WTF_GUARDED_BY_LOCK(m_lock) = 0;
+    unsigned m_idleThreadCount WTF_GUARDED_BY_LOCK(m_lock) = 0;
+};
+
+// JS-thread state for a pool: the promises its queries will settle. An entry
+// outlives close() until its last query settles, so that late batches still
+// find it; after that its handle is invalid.
+struct SQLitePoolPendingQuery {
+    JSC::Strong<JSC::JSPromise> promise;
+    JSC::Strong<JSC::JSArray> rows;
+    JSC::Strong<JSC::Structure> structure;
+    WTF::BitVector validColumns;
+    SQLitePoolMode mode = SQLitePoolMode::All;
+    bool safeIntegers = false;
+};
+
+struct SQLitePoolEntry {
+    WTF_DEPRECATED_MAKE_STRUCT_FAST_ALLOCATED(SQLitePoolEntry);
+
+    RefPtr<SQLitePool> pool;
+    JSC::VM* vm = nullptr;
+    uint64_t nextQueryId = 0;
+    bool closed = false;
+    HashMap<uint64_t, SQLitePoolPendingQuery> pending;
+};
+
+static WTF::Lock sqlitePoolsLock;
+// Handles start at 1, so they are never HashMap's empty or deleted key.
+static int32_t lastSQLitePoolHandle WTF_GUARDED_BY_LOCK(sqlitePoolsLock) = 0;
+
+static HashMap<int32_t, SQLitePoolEntry*>& sqlitePools() WTF_REQUIRES_LOCK(sqlitePoolsLock)
+{
+    static NeverDestroyed<HashMap<int32_t, SQLitePoolEntry*>> pools;
+    return pools;
+}
+
+static SQLitePoolEntry* sqlitePoolForHandle(int32_t handle)
+{
+    Locker locker { sqlitePoolsLock };
+    if (handle <= 0)
+        return nullptr;
+    return sqlitePools().get(handle);
+}
+
+// JS thread. Frees a closed pool's entry once none of its queries are pending.
+static void releaseSQLitePoolEntryIfDone(int32_t handle, SQLitePoolEntry* entry)
+{
+    if (!entry->closed || !entry->pending.isEmpty())
+        return;
+    {
+        Locker locker { sqlitePoolsLock };
+        sqlitePools().remove(handle);
+    }
+    delete entry;
+}
+
+// JS thread. Pool#close(), or the pool being collected.
+static void closeSQLitePoolEntry(int32_t handle, SQLitePoolEntry* entry)
+{
+    entry->closed = true;
+    entry->pool->close();
+    releaseSQLitePoolEntryIfDone(handle, entry);
+}
+
+// JS thread. Pending queries keep the event loop alive until they settle.
+static void settleSQLitePoolQuery(JSC::VM& vm, int32_t handle, SQLitePoolEntry* entry, HashMap<uint64_t, SQLitePoolPendingQuery>::iterator it)
+{
+    entry->pending.remove(it);
+    Bun__eventLoop__refKeepAlive(WebCore::clientData(vm)->bunVM, -1);
+    releaseSQLitePoolEntryIfDone(handle, entry);
+}
+
+void SQLitePool::dispatch(Function<void()>&& task)
+{
+    Locker locker { m_lock };
+    m_tasks.append(WTF::move(task));
+    if (m_tasks.size() > m_idleThreadCount) {
+        ASSERT(m_threadCount < m_maxReaders + 1);
+        m_threadCount++;
+        Thread::create("bun:sqlite pool"_s, [pool = Ref { *this }] {
+            pool->runThread();
+        })->detach();
+    }
+    m_tasksChanged.notifyOne();
+}
+
+// The pool's own thread. Exits once the pool is closed and out of work.
+void SQLitePool::runThread()
+{
+    while (true) {
+        Function<void()> task;
+        {
+            Locker locker { m_lock };
+            while (m_tasks.isEmpty()) {
+                if (m_closed) {
+                    m_threadCount--;
+                    return;
+                }
+                m_idleThreadCount++;
+                m_tasksChanged.wait(m_lock);
+                m_idleThreadCount--;
+            }
+            task = m_tasks.takeFirst();
+        }
+        task();
+    }
+}
+
+void SQLitePool::submit(std::unique_ptr<SQLitePoolQuery>&& query)
+{
+    sqlite3* reader = nullptr;
+    bool openReader = false;
+    bool runOnWriter = query->mode == SQLitePoolMode::Run;
+    {
+        Locker locker { m_lock };
+        if (m_closed) {
+            fail(*query, "Database pool is closed"_s);
+            return;
+        }
+
+        if (runOnWriter) {
+            if (!claimWriter(query))
+                return;
+        } else if (!m_idleReaders.isEmpty()) {
+            reader = m_idleReaders.takeLast();
+        } else if (m_readerCount < m_maxReaders) {
+            m_readerCount++;
+            openReader = true;
+        } else {
+            // Every reader is busy; whichever finishes first runs this next.
+            m_readQueue.append(WTF::move(query));
+            return;
+        }
+    }
+
+    dispatch([pool = Ref { *this }, query = WTF::move(query), reader, openReader, runOnWriter]() mutable {
+        if (runOnWriter) {
+            pool->runWriter(WTF::move(query));
+            return;
+        }
+
+        if (openReader) {
+            int status = sqlite3_open_v2(pool->m_path.data(), &reader, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr);
+            if (status != SQLITE_OK) {
+                WTF::String message = reader ? sqliteErrorMessage(reader) : WTF::String::fromUTF8(sqlite3_errstr(status));
+                if (reader)
+                    sqlite3_close_v2(reader);
+                // Reads queued behind this one were waiting for a reader that
+                // will never exist; if no other reader can pick them up, they
+                // fail the same way.
+                Deque<std::unique_ptr<SQLitePoolQuery>> abandoned;
+                {
+                    Locker locker { pool->m_lock };
+                    if (!--pool->m_readerCount)
+                        abandoned = std::exchange(pool->m_readQueue, {});
+                }
+                // Each batch needs its own copy: it is released on the JS thread.
+                for (auto& queued : abandoned)
+                    pool->fail(*queued, message.isolatedCopy());
+                pool->fail(*query, WTF::move(message));
+                return;
+            }
+            sqlite3_extended_result_codes(reader, 1);
+            sqlite3_busy_timeout(reader, kSQLitePoolBusyTimeoutMs);
+            sqlite3_db_config(reader, SQLITE_DBCONFIG_DEFENSIVE, 1, NULL);
+        }
+
+        pool->runReader(reader, WTF::move(query));
+    });
+}
+
+// Returns true if the caller now holds the writer and should run `query` on
+// it. Otherwise `query` was either queued behind the thread that holds it or
+// failed.
+bool SQLitePool::claimWriter(std::unique_ptr<SQLitePoolQuery>& query)
+{
+    if (!m_hasWriter) {
+        fail(*query, "Cannot write to a pool opened on a readonly database"_s);
+        return false;
+    }
+    if (m_writerBusy) {
+        m_writeQueue.append(WTF::move(query));
+        return false;
+    }
+    if (!m_writer) {
+        fail(*query, "Database pool is closed"_s);
+        return false;
+    }
+    m_writerBusy = true;
+    return true;
+}
+
+// Worker thread. Keeps the reader until there is nothing left to read.
+void SQLitePool::runReader(sqlite3* reader, std::unique_ptr<SQLitePoolQuery>&& first)
+{
+    auto query = WTF::move(first);
+    while (true) {
+        if (execute(reader, *query, false) == ExecuteResult::NeedsWriter) {
+            bool claimed;
+            {
+                Locker locker { m_lock };
+                claimed = claimWriter(query);
+            }
+            if (claimed)
+                runWriter(WTF::move(query));
+        }
+
+        Locker locker { m_lock };
+        if (m_readQueue.isEmpty()) {
+            if (m_closed) {
+                m_readerCount--;
+                sqlite3_close_v2(reader);
+            } else {
+                m_idleReaders.append(reader);
+            }
+            return;
+        }
+        query = m_readQueue.takeFirst();
+    }
+}
+
+// Worker thread, holding the writer (m_writerBusy). Drains the write queue so
+// that writes run one after another in the order they were submitted.
+void SQLitePool::runWriter(std::unique_ptr<SQLitePoolQuery>&& first)
+{
+    sqlite3* writer;
+    {
+        Locker locker { m_lock };
+        writer = m_writer;
+    }
+
+    auto query = WTF::move(first);
+    while (true) {
+        execute(writer, *query, true);
+
+        Locker locker { m_lock };
+        if (m_writeQueue.isEmpty()) {
+            m_writerBusy = false;
+            if (m_closed)
+                sqlite3_close_v2(std::exchange(m_writer, nullptr));
+            return;
+        }
+        query = m_writeQueue.takeFirst();
+    }
+}
+
+static bool bindSQLitePoolValue(sqlite3_stmt* stmt, int i, const SQLitePoolValue& value)
+{
+    int status = WTF::switchOn(value,
+        [&](std::nullptr_t) { return sqlite3_bind_null(stmt, i); },
+        [&](int64_t number) { return sqlite3_bind_int64(stmt, i, number); },
+        [&](double number) { return sqlite3_bind_double(stmt, i, number); },
+        [&](const WTF::String& string) {
+            auto utf8 = string.utf8();
+            return sqlite3_bind_text(stmt, i, utf8.data(), utf8.length(), SQLITE_TRANSIENT);
+        },
+        [&](const Vector<uint8_t>& blob) { return sqlite3_bind_blob(stmt, i, blob.span().data(), blob.size(), SQLITE_TRANSIENT); });
+    return status == SQLITE_OK;
+}
+
+// Same lookup as a Statement: named parameters match the key with their
+// prefix ("$id"), or without it ("id") in strict mode. Missing ones stay NULL
+// unless strict.
+static bool bindSQLitePoolQuery(sqlite3* db, sqlite3_stmt* stmt, const SQLitePoolQuery& query, SQLitePoolBatch& batch)
+{
+    int count = sqlite3_bind_parameter_count(stmt);
+    auto fail = [&](WTF::String&& message) {
+        batch.error = WTF::move(message);
+        return false;
+    };
+
+    if (!query.hasNamedBindings) {
+        for (int i = 0; i < count && static_cast<size_t>(i) < query.values.size(); i++) {
+            if (!bindSQLitePoolValue(stmt, i + 1, query.values[i]))
+                return fail(sqliteErrorMessage(db));
+        }
+        return true;
+    }
+
+    for (int i = 1; i <= count; i++) {
+        const char* name = sqlite3_bind_parameter_name(stmt, i);
+        if (!name)
+            continue;
+
+        std::optional<size_t> index;
+        for (size_t j = 0; j < query.names.size(); j++) {
+            const auto& key = query.names[j];
+            if (!strcmp(key.data(), name) || (query.strict && name[0] && !strcmp(key.data(), name + 1))) {
+                index = j;
+                break;
+            }
+        }
+
+        if (!index) {
+            if (query.strict)
+                return fail(makeString("Missing parameter \""_s, WTF::String::fromUTF8ReplacingInvalidSequences({ reinterpret_cast<const unsigned char*>(name + 1), strlen(name + 1) }), "\""_s));
+            continue;
+        }
+
+        if (!bindSQLitePoolValue(stmt, i, query.values[*index]))
+            return fail(sqliteErrorMessage(db));
+    }
+    return true;
+}
+
+static SQLitePoolValue sqlitePoolValueFromColumn(sqlite3_stmt* stmt, int i)
+{
+    switch (sqlite3_column_type(stmt, i)) {
+    case SQLITE_INTEGER:
+        return static_cast<int64_t>(sqlite3_column_int64(stmt, i));
+    case SQLITE_FLOAT:
+        return sqlite3_column_double(stmt, i);
+    case SQLITE3_TEXT: {
+        size_t len = sqlite3_column_bytes(stmt, i);
+        const unsigned char* text = len > 0 ? sqlite3_column_text(stmt, i) : nullptr;
+        if (!text)
+            return emptyString();
+        return WTF::String::fromUTF8ReplacingInvalidSequences({ text, len });
+    }
+    case SQLITE_BLOB: {
+        size_t len = sqlite3_column_bytes(stmt, i);
+        const uint8_t* blob = len > 0 ? static_cast<const uint8_t*>(sqlite3_column_blob(stmt, i)) : nullptr;
+        if (!blob)
+            return Vector<uint8_t>();
+        return Vector<uint8_t>(std::span { blob, len });
+    }
+    default:
+        return nullptr;
+    }
+}
+
+// Worker thread.
+SQLitePool::ExecuteResult SQLitePool::execute(sqlite3* db, SQLitePoolQuery& query, bool isWriter)
+{
+    SQLitePoolBatch batch;
+    auto failWithSQLiteError = [&] {
+        batch.error = sqliteErrorMessage(db);
+        batch.errorCode = sqlite3_extended_errcode(db);
+        batch.errorOffset = sqlite3_error_offset(db);
+    };
+
+    const char* sql = query.sql.data();
+    const char* end = sql + query.sql.length();
+    bool first = true;
+
+    // run() executes every statement in the string, like Database#run; the
+    // other modes only the first, like Database#query.
+    while (sql < end && batch.error.isNull()) {
+        sqlite3_stmt* stmt = nullptr;
+        const char* tail = nullptr;
+        if (sqlite3_prepare_v3(db, sql, end - sql, 0, &stmt, &tail) != SQLITE_OK) {
+            failWithSQLiteError();
+            break;
+        }
+        sql = tail;
+        if (!stmt)
+            continue;
+
+        if (!first && query.mode != SQLitePoolMode::Run) {
+            sqlite3_finalize(stmt);
+            break;
+        }
+
+        // Checked before anything is stepped, so nothing has been delivered yet.
+        if (!isWriter && !sqlite3_stmt_readonly(stmt)) {
+            sqlite3_finalize(stmt);
+            return ExecuteResult::NeedsWriter;
+        }
+
+        if (first && !bindSQLitePoolQuery(db, stmt, query, batch)) {
+            sqlite3_finalize(stmt);
+            break;
+        }
+
+        int columnCount = sqlite3_column_count(stmt);
+        bool collectRows = query.mode != SQLitePoolMode::Run && first;
+        if (collectRows) {
+            batch.columnNames.reserveInitialCapacity(columnCount);
+            for (int i = 0; i < columnCount; i++) {
+                const char* name = sqlite3_column_name(stmt, i);
+                batch.columnNames.append(name ? WTF::String::fromUTF8ReplacingInvalidSequences({ reinterpret_cast<const unsigned char*>(name), strlen(name) }) : emptyString());
+            }
+        }
+
+        int status;
+        while ((status = sqlite3_step(stmt)) == SQLITE_ROW) {
+            if (!collectRows)
+                continue;
+
+            for (int i = 0; i < columnCount; i++)
+                batch.values.append(sqlitePoolValueFromColumn(stmt, i));
+            batch.rowCount++;
+
+            if (query.mode == SQLitePoolMode::Get)
+                break;
+
+            if (batch.rowCount == kSQLitePoolBatchRows) {
+                SQLitePoolBatch next;
+                std::swap(next, batch);
+                deliver(query, WTF::move(next));
+            }
+        }
+
+        if (status != SQLITE_ROW && status != SQLITE_DONE)
+            failWithSQLiteError();
+        sqlite3_finalize(stmt);
+        first = false;
+    }
+
+    if (batch.error.isNull()) {
+        batch.changes = sqlite3_changes64(db);
+        batch.lastInsertRowid = sqlite3_last_insert_rowid(db);
+    }
+    batch.done = true;
+    deliver(query, WTF::move(batch));
+    return ExecuteResult::Done;
+}
+
+void SQLitePool::fail(const SQLitePoolQuery& query, WTF::String&& message)
+{
+    SQLitePoolBatch batch;
+    batch.done = true;
+    batch.error = WTF::move(message);
+    deliver(query, WTF::move(batch));
+}
+
+static JSValue sqlitePoolValueToJS(JSC::VM& vm, JSC::JSGlobalObject* globalObject, SQLitePoolValue& value, bool safeIntegers)
+{
+    return WTF::switchOn(value,
+        [&](std::nullptr_t) -> JSValue { return jsNull(); },
+        [&](int64_t number) -> JSValue {
+            if (safeIntegers)
+                return JSC::JSBigInt::createFrom(globalObject, number);
+            return jsNumber(number);
+        },
+        [&](double number) -> JSValue { return jsNumber(number); },
+        [&](WTF::String& string) -> JSValue { return jsString(vm, WTF::move(string)); },
+        [&](Vector<uint8_t>& blob) -> JSValue {
+            auto* array = JSC::JSUint8Array::createUninitialized(globalObject, globalObject->m_typedArrayUint8.get(globalObject), blob.size());
+            if (array && !blob.isEmpty())
+                memcpy(array->typedVector(), blob.span().data(), blob.size());
+            return array;
+        });
+}
+
+static void sqlitePoolInitializeColumns(JSC::VM& vm, JSC::JSGlobalObject* globalObject, SQLitePoolPendingQuery& pending, const Vector<WTF::String>& columnNames)
+{
+    size_t count = columnNames.size();
+    pending.validColumns.clearAll();
+
+    // Like a Statement, a duplicate column name takes the value of the last
+    // column with that name.
+    HashSet<WTF::String> seen;
+    for (size_t i = count; i-- > 0;) {
+        if (seen.add(columnNames[i]).isNewEntry)
+            pending.validColumns.set(i);
+    }
+
+    if (seen.size() > JSFinalObject::maxInlineCapacity)
+        return;
+
+    Structure* structure = globalObject->structureCache().emptyObjectStructureForPrototype(globalObject, globalObject->objectPrototype(), seen.size());
+    PropertyOffset offset;
+    for (size_t i = 0; i < count; i++) {
+        if (pending.validColumns.get(i))
+            structure = Structure::addPropertyTransition(vm, structure, Identifier::fromString(vm, columnNames[i]), 0, offset);
+    }
+    pending.structure = { vm, structure };
+}
+
+// JS thread: turn a batch into rows and settle the promise on the last one.
+static void deliverSQLitePoolBatch(JSC::JSGlobalObject* globalObject, int32_t handle, uint64_t id, SQLitePoolBatch&& batch)
+{
+    auto& vm = JSC::getVM(globalObject);
+    auto scope = DECLARE_TOP_EXCEPTION_SCOPE(vm);
+
+    auto* entry = sqlitePoolForHandle(handle);
+    if (!entry)
+        return;
+    auto it = entry->pending.find(id);
+    if (it == entry->pending.end())
+        return;
+    auto& pending = it->value;
+    auto* promise = pending.promise.get();
+
+    auto rejectWith = [&](JSValue error) {
+        settleSQLitePoolQuery(vm, handle, entry, it);
+        promise->reject(vm, globalObject, error);
+    };
+
+    if (!batch.error.isNull()) {
+        rejectWith(batch.errorCode
+                ? createSQLiteError(globalObject, batch.errorCode, batch.errorOffset, batch.error)
+                : JSValue(createError(globalObject, batch.error)));
+        return;
+    }
+
+    if (!batch.columnNames.isEmpty() && pending.mode != SQLitePoolMode::Values)
+        sqlitePoolInitializeColumns(vm, globalObject, pending, batch.columnNames);
+
+    size_t columnCount = batch.rowCount ? batch.values.size() / batch.rowCount : 0;
+    for (size_t row = 0; row < batch.rowCount; row++) {
+        auto* values = batch.values.mutableSpan().subspan(row * columnCount, columnCount).data();
+        JSObject* result;
+        if (pending.mode == SQLitePoolMode::Values) {
+            result = JSC::constructEmptyArray(globalObject, static_cast<ArrayAllocationProfile*>(nullptr), columnCount);
+            if (scope.exception()) [[unlikely]]
+                break;
+            for (size_t i = 0; i < columnCount; i++) {
+                JSValue value = sqlitePoolValueToJS(vm, globalObject, values[i], pending.safeIntegers);
+                if (scope.exception()) [[unlikely]]
+                    break;
+                result->putDirectIndex(globalObject, i, value);
+            }
+        } else if (auto* structure = pending.structure.get()) {
+            result = JSC::constructEmptyObject(vm, structure);
+            for (size_t i = 0, j = 0; i < columnCount; i++) {
+                if (!pending.validColumns.get(i))
+                    continue;
+                JSValue value = sqlitePoolValueToJS(vm, globalObject, values[i], pending.safeIntegers);
+                if (scope.exception()) [[unlikely]]
+                    break;
+                result->putDirectOffset(vm, j++, value);
+            }
+        } else {
+            result = JSC::constructEmptyObject(globalObject);
+            for (size_t i = 0; i < columnCount; i++) {
+                if (!pending.validColumns.get(i))
+                    continue;
+                JSValue value = sqlitePoolValueToJS(vm, globalObject, values[i], pending.safeIntegers);
+                if (scope.exception()) [[unlikely]]
+                    break;
+                result->putDirect(vm, Identifier::fromString(vm, batch.columnNames[i]), value, 0);
+            }
+        }
+        if (scope.exception()) [[unlikely]]
+            break;
+
+        if (pending.mode == SQLitePoolMode::Get) {
+            settleSQLitePoolQuery(vm, handle, entry, it);
+            promise->resolve(globalObject, vm, result);
+            return;
+        }
+        pending.rows->push(globalObject, result);
+        if (scope.exception()) [[unlikely]]
+            break;
+    }
+
+    if (scope.exception()) [[unlikely]] {
+        JSValue error = scope.exception()->value();
+        if (!scope.clearExceptionExceptTermination())
+            return;
+        rejectWith(error);
+        return;
+    }
+
+    if (!batch.done)
+        return;
+
+    JSValue result;
+    switch (pending.mode) {
+    case SQLitePoolMode::All:
+    case SQLitePoolMode::Values:
+        result = pending.rows.get();
+        break;
+    case SQLitePoolMode::Get:
+        result = jsNull();
+        break;
+    case SQLitePoolMode::Run: {
+        JSObject* changes = JSC::constructEmptyObject(globalObject);
+        changes->putDirect(vm, Identifier::fromString(vm, "changes"_s), jsNumber(batch.changes), 0);
+        changes->putDirect(vm, Identifier::fromString(vm, "lastInsertRowid"_s), pending.safeIntegers ? JSValue(JSC::JSBigInt::createFrom(globalObject, batch.lastInsertRowid)) : jsNumber(batch.lastInsertRowid), 0);
+        result = changes;
+        break;
+    }
+    }
+    if (scope.exception()) [[unlikely]]
+        return;
+
+    settleSQLitePoolQuery(vm, handle, entry, it);
+    promise->resolve(globalObject, vm, result);
+}
+
+void SQLitePool::deliver(const SQLitePoolQuery& query, SQLitePoolBatch&& batch)
+{
+    ScriptExecutionContext::postTaskTo(m_context, query.loopKind, [handle = m_handle, id = query.id, batch = WTF::move(batch)](ScriptExecutionContext& context) mutable {
+        deliverSQLitePoolBatch(context.globalObject(), handle, id, WTF::move(batch));
+    });
+}
+
+static void closeSQLitePoolsForTermination(JSC::VM& vm)
+{
+    Vector<std::pair<int32_t, SQLitePoolEntry*>> entries;
+    {
+        Locker locker { sqlitePoolsLock };
+        for (auto& [handle, entry] : sqlitePools()) {
+            if (entry->vm == &vm)
+                entries.append({ handle, entry });
+        }
+    }
+    for (auto [handle, entry] : entries) {
+        // The event loop is going away; its keep-alive refs go with it.
+        entry->pending.clear();
+        closeSQLitePoolEntry(handle, entry);
+    }
+}
+
+static bool toSQLitePoolValue(JSC::JSGlobalObject* globalObject, JSC::ThrowScope& scope, JSValue value, bool safeIntegers, SQLitePoolValue& out)
+{
+    if (value.isUndefinedOrNull()) {
+        out = nullptr;
+    } else if (value.isBoolean()) {
+        out = static_cast<int64_t>(value.asBoolean());
+    } else if (value.isAnyInt()) {
+        out = static_cast<int64_t>(value.asAnyInt());
+    } else if (value.isNumber()) {
+        out = value.asNumber();
+    } else if (value.isString()) {
+        auto string = value.toWTFString(globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        out = string.isolatedCopy();
+    } else if (value.isHeapBigInt()) {
+        JSBigInt* bigInt = value.asHeapBigInt();
+        if (safeIntegers) {
+            const auto min = JSBigInt::compare(bigInt, std::numeric_limits<int64_t>::min());
+            const auto max = JSBigInt::compare(bigInt, std::numeric_limits<int64_t>::max());
+            if (min == JSBigInt::ComparisonResult::LessThan || max == JSBigInt::ComparisonResult::GreaterThan) [[unlikely]] {
+                throwRangeError(globalObject, scope, makeString("BigInt value '"_s, bigInt->toString(globalObject, 10), "' is out of range"_s));
+                return false;
+            }
+        }
+        out = static_cast<int64_t>(JSBigInt::toBigInt64(value));
+    } else if (auto* view = dynamicDowncast<JSC::JSArrayBufferView>(value)) {
+        out = Vector<uint8_t>(std::span { static_cast<const uint8_t*>(view->vector()), view->byteLength() });
+    } else {
+        throwException(globalObject, scope, createTypeError(globalObject, "Binding expected string, TypedArray, boolean, number, bigint or null"_s));
+        return false;
+    }
+    return true;
+}
+
+// openPool(filename, readers, readonly, finalizationTarget) -> handle
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementOpenPoolFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue pathValue = callFrame->argument(0);
+    JSValue readersValue = callFrame->argument(1);
+    if (!pathValue.isString() || !readersValue.isNumber()) {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Expected string and number"_s));
+        return {};
+    }
+
+    String path = pathValue.toWTFString(lexicalGlobalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    unsigned readers = std::max(readersValue.toUInt32(lexicalGlobalObject), 1u);
+    RETURN_IF_EXCEPTION(scope, {});
+    bool readonly = callFrame->argument(2).toBoolean(lexicalGlobalObject);
+
+#if LAZY_LOAD_SQLITE
+    if (lazyLoadSQLite() < 0) [[unlikely]] {
+        WTF::String msg = WTF::String::fromUTF8(dlerror());
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, msg));
+        return {};
+    }
+#endif
+    Bun__initializeSQLite();
+
+    auto pathUtf8 = path.utf8();
+
+    // The writer is opened here rather than on a worker so that a bad path
+    // throws from db.pool(), and so that the switch to WAL happens before any
+    // reader exists.
+    sqlite3* writer = nullptr;
+    if (!readonly) {
+        int status = sqlite3_open_v2(pathUtf8.data(), &writer, SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX, nullptr);
+        if (status != SQLITE_OK) {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, writer));
+            sqlite3_close_v2(writer);
+            return {};
+        }
+        sqlite3_extended_result_codes(writer, 1);
+        sqlite3_busy_timeout(writer, kSQLitePoolBusyTimeoutMs);
+        sqlite3_db_config(writer, SQLITE_DBCONFIG_DEFENSIVE, 1, NULL);
+        if (sqlite3_exec(writer, "PRAGMA journal_mode = WAL", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throwException(lexicalGlobalObject, scope, createSQLiteError(lexicalGlobalObject, writer));
+            sqlite3_close_v2(writer);
+            return {};
+        }
+    }
+
+    auto* entry = new SQLitePoolEntry;
+    entry->vm = &vm;
+    int32_t handle;
+    {
+        Locker locker { sqlitePoolsLock };
+        handle = ++lastSQLitePoolHandle;
+        sqlitePools().add(handle, entry);
+    }
+    entry->pool = SQLitePool::create(handle, WTF::move(pathUtf8), readers, writer, defaultGlobalObject(lexicalGlobalObject)->scriptExecutionContext()->identifier());
+
+    JSValue finalizationTarget = callFrame->argument(3);
+    if (finalizationTarget.isObject()) {
+        vm.heap.addFinalizer(finalizationTarget.getObject(), [handle](JSC::JSCell*) -> void {
+            // Null if close() already freed it.
+            if (auto* entry = sqlitePoolForHandle(handle))
+                closeSQLitePoolEntry(handle, entry);
+        });
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsNumber(handle)));
+}
+
+// poolQuery(handle, mode, internalFlags, sql, bindings?) -> Promise
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementPoolQueryFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue handleValue = callFrame->argument(0);
+    JSValue modeValue = callFrame->argument(1);
+    JSValue flagsValue = callFrame->argument(2);
+    JSValue sqlValue = callFrame->argument(3);
+    JSValue bindingsValue = callFrame->argument(4);
+
+    auto* entry = handleValue.isNumber() ? sqlitePoolForHandle(handleValue.toInt32(lexicalGlobalObject)) : nullptr;
+    if (!entry || entry->vm != &vm) {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid database pool handle"_s));
+        return {};
+    }
+    if (!sqlValue.isString()) {
+        throwException(lexicalGlobalObject, scope, createTypeError(lexicalGlobalObject, "Expected 'query' to be a string"_s));
+        return {};
+    }
+
+    auto query = makeUnique<SQLitePoolQuery>();
+    query->mode = static_cast<SQLitePoolMode>(std::clamp(modeValue.toInt32(lexicalGlobalObject), 0, static_cast<int>(SQLitePoolMode::Run)));
+    int32_t internalFlags = flagsValue.toInt32(lexicalGlobalObject);
+    bool safeIntegers = (internalFlags & kSafeIntegersFlag) != 0;
+    query->strict = (internalFlags & kStrictFlag) != 0;
+    query->loopKind = defaultGlobalObject(lexicalGlobalObject)->scriptExecutionContext()->currentLoopKind();
+    query->sql = sqlValue.toWTFString(lexicalGlobalObject).utf8();
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto rejectWithPending = [&]() -> EncodedJSValue {
+        RELEASE_AND_RETURN(scope, JSValue::encode(JSPromise::rejectedPromiseWithCaughtException(lexicalGlobalObject, scope)));
+    };
+
+    if (auto* array = dynamicDowncast<JSC::JSArray>(bindingsValue)) {
+        unsigned length = array->length();
+        query->values.reserveInitialCapacity(length);
+        for (unsigned i = 0; i < length; i++) {
+            JSValue value = array->getIndex(lexicalGlobalObject, i);
+            RETURN_IF_EXCEPTION(scope, rejectWithPending());
+            SQLitePoolValue converted;
+            if (!toSQLitePoolValue(lexicalGlobalObject, scope, value, safeIntegers, converted))
+                return rejectWithPending();
+            query->values.append(WTF::move(converted));
+        }
+    } else if (bindingsValue.isObject()) {
+        JSObject* object = bindingsValue.getObject();
+        PropertyNameArrayBuilder keys(vm, PropertyNameMode::Strings, PrivateSymbolMode::Exclude);
+        object->getOwnPropertyNames(object, lexicalGlobalObject, keys, DontEnumPropertiesMode::Exclude);
+        RETURN_IF_EXCEPTION(scope, rejectWithPending());
+        query->hasNamedBindings = true;
+        for (auto& key : keys) {
+            JSValue value = object->get(lexicalGlobalObject, key);
+            RETURN_IF_EXCEPTION(scope, rejectWithPending());
+            SQLitePoolValue converted;
+            if (!toSQLitePoolValue(lexicalGlobalObject, scope, value, safeIntegers, converted))
+                return rejectWithPending();
+            query->names.append(key.string().utf8());
+            query->values.append(WTF::move(converted));
+        }
+    }
+
+    auto* promise = JSC::JSPromise::create(vm, lexicalGlobalObject->promiseStructure());
+    auto* rows = JSC::constructEmptyArray(lexicalGlobalObject, static_cast<ArrayAllocationProfile*>(nullptr), 0);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    query->id = ++entry->nextQueryId;
+    entry->pending.add(query->id, SQLitePoolPendingQuery {
+                                      .promise = { vm, promise },
+                                      .rows = { vm, rows },
+                                      .structure = {},
+                                      .validColumns = {},
+                                      .mode = query->mode,
+                                      .safeIntegers = safeIntegers,
+                                  });
+    Bun__eventLoop__refKeepAlive(WebCore::clientData(vm)->bunVM, 1);
+    entry->pool->submit(WTF::move(query));
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(promise));
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsSQLStatementClosePoolFunction, (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    auto& vm = JSC::getVM(lexicalGlobalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue handleValue = callFrame->argument(0);
+    auto* entry = handleValue.isNumber() ? sqlitePoolForHandle(handleValue.toInt32(lexicalGlobalObject)) : nullptr;
+    if (!entry || entry->vm != &vm) {
+        throwException(lexicalGlobalObject, scope, createError(lexicalGlobalObject, "Invalid database pool handle"_s));
+        return {};
+    }
+
+    closeSQLitePoolEntry(handleValue.toInt32(lexicalGlobalObject), entry);
+    return JSValue::encode(jsUndefined());
+}
+
 JSValue createJSSQLStatementConstructor(Zig::GlobalObject* globalObject)
 {
     VM& vm = globalObject->vm();
@@ -67,7 +67,7 @@ ExceptionOr<void> BroadcastChannel::postMessage(JSC::JSGlobalObject& globalObjec
     return {};
 }
 
-void BroadcastChannel::dispatchMessage(Ref<SerializedScriptValue>&& message)
+void BroadcastChannel::dispatchMessage(Ref<SerializedScriptValue>&& message, JSC::JSValue& sharedData)
 {
     if (isClosed())
         return;
@@ -81,8 +81,19 @@ void BroadcastChannel::dispatchMessage(Ref<SerializedScriptValue>&& message)
     auto& vm = JSC::getVM(globalObject);
     auto scope = DECLARE_TOP_EXCEPTION_SCOPE(vm);
 
-    Vector<RefPtr<MessagePort>> dummyPorts;
-    auto event = MessageEvent::create(*globalObject, WTF::move(message), {}, {}, nullptr, WTF::move(dummyPorts));
+    auto data = sharedData;
+    bool didFail = false;
+    if (!data) {
+        data = message->deserialize(*globalObject, globalObject, SerializationErrorMode::NonThrowing, &didFail);
+        if (scope.exception()) [[unlikely]] {
+            RELEASE_ASSERT(vm.hasPendingTerminationException());
+            return;
+        }
+        if (!didFail && !data.isObject())
+            sharedData = data;
+    }
+
+    auto event = MessageEvent::create(*globalObject, WTF::move(message), data, didFail);
     if (scope.exception()) [[unlikely]] {
         RELEASE_ASSERT(vm.hasPendingTerminationException());
         return;
@@ -27,12 +27,10 @@
 // BunBroadcastChannelRegistry.
 //
 // The registry is directly thread-safe; posting never bounces through the
-// main thread. Each (message, subscriber) pair becomes one task on the
-// subscriber's context — the HTML spec requires that same-event-loop
+// main thread. Messages are batched per destination context in the
+// registry, not per channel — the HTML spec requires that same-event-loop
 // subscribers observe messages in (message-major, creation-minor) order,
-// which per-channel inbox batching would break. If cross-thread bursts ever
-// need coalescing, the place to add it is a per-(context, name) inbox in the
-// registry, not per-channel.
+// which per-channel inbox batching would break.
 
 #pragma once
 
@@ -75,8 +73,10 @@ public:
     void close();
     bool isClosed() const { return m_state.load(std::memory_order_acquire) & Closed; }
 
-    // Called on this channel's context thread with one message.
-    void dispatchMessage(Ref<SerializedScriptValue>&&);
+    // Called on this channel's context thread with one message. `sharedData`
+    // is the value another channel in this context already deserialized from
+    // the same message, if it was immutable; it is filled in when empty.
+    void dispatchMessage(Ref<SerializedScriptValue>&&, JSC::JSValue& sharedData);
 
     void jsRef(JSGlobalObject*);
     void jsUnref(JSGlobalObject*);
@@ -35,49 +35,106 @@ void BunBroadcastChannelRegistry::unsubscribe(const String& name, BroadcastChann
         m_subscribers.remove(it);
 }
 
+class BunBroadcastChannelRegistry::PendingBatch {
+public:
+    explicit PendingBatch(uint64_t key)
+        : key(key)
+    {
+    }
+
+    // Also runs when the drain task is dropped unrun because the context is
+    // going away; the batch must stop accepting messages either way.
+    ~PendingBatch() { BunBroadcastChannelRegistry::singleton().closeBatch(*this); }
+
+    struct Delivery {
+        Ref<SerializedScriptValue> message;
+        // This context's subscribers to the message, in subscription order.
+        Vector<ThreadSafeWeakPtr<BroadcastChannel>, 1> channels;
+    };
+
+    const uint64_t key;
+    // Appended under the registry lock while the batch is open; read only by
+    // the drain task after closeBatch().
+    Vector<Delivery, 1> deliveries;
+};
+
+void BunBroadcastChannelRegistry::closeBatch(PendingBatch& batch)
+{
+    Locker locker { m_lock };
+    auto it = m_pendingBatches.find(batch.key);
+    if (it != m_pendingBatches.end() && it->value == &batch)
+        m_pendingBatches.remove(it);
+}
+
 void BunBroadcastChannelRegistry::post(const String& name, BroadcastChannel& source, Ref<SerializedScriptValue>&& message)
 {
-    // Snapshot subscribers under the lock, then fan out without holding it
+    // Append to each destination context's open batch under the lock, then
+    // post drain tasks for the batches this call opened without holding it
     // — postTaskTo takes the contexts-map lock and we don't want to nest.
     //
-    // We deliberately carry ThreadSafeWeakPtr (not Ref) across the fan-out
-    // and resolve it INSIDE the posted task on the target thread. Holding a
-    // strong ref here can make this thread the last owner if the target is
-    // a worker that tears down concurrently (its JS wrapper's deref + its
-    // queued task's deref both happen on the worker thread, leaving our
-    // local ref as the last), and ~BroadcastChannel → ~EventTarget →
-    // EventListenerMap::clear() would then fire on the wrong thread and
-    // trip releaseAssertOrSetThreadUID.
-    struct Target {
+    // Batches carry ThreadSafeWeakPtr (not Ref) and resolve it INSIDE the
+    // drain task on the target thread. Holding a strong ref here can make
+    // this thread the last owner if the target is a worker that tears down
+    // concurrently (its JS wrapper's deref + its queued task's deref both
+    // happen on the worker thread, leaving our local ref as the last), and
+    // ~BroadcastChannel → ~EventTarget → EventListenerMap::clear() would
+    // then fire on the wrong thread and trip releaseAssertOrSetThreadUID.
+    struct OpenedBatch {
         ScriptExecutionContextIdentifier ctxId;
         BunLoopKind ctxLoopKind;
-        ThreadSafeWeakPtr<BroadcastChannel> channel;
+        std::unique_ptr<PendingBatch> batch;
     };
-    Vector<Target, 4> targets;
+    Vector<OpenedBatch, 4> opened;
     {
         Locker locker { m_lock };
         auto it = m_subscribers.find(name);
         if (it == m_subscribers.end())
             return;
-        // size()-1: the sender is always in the list and always skipped.
-        // Fits the inline buffer exactly for up to 5 subscribers (1→4).
-        if (auto n = it->value.size(); n > 1)
-            targets.reserveInitialCapacity(n - 1);
         for (auto& sub : it->value) {
             if (sub.identity == &source)
                 continue;
-            targets.append({ sub.ctxId, sub.ctxLoopKind, sub.channel });
+            auto& batch = m_pendingBatches.add(batchKey(sub.ctxId, sub.ctxLoopKind), nullptr).iterator->value;
+            if (!batch) {
+                auto owned = makeUnique<PendingBatch>(batchKey(sub.ctxId, sub.ctxLoopKind));
+                batch = owned.get();
+                opened.append({ sub.ctxId, sub.ctxLoopKind, WTF::move(owned) });
+            }
+            // Subscribers on the same context share one delivery, and with
+            // it one deserialization where the value allows (see drain).
+            auto& deliveries = batch->deliveries;
+            if (deliveries.isEmpty() || deliveries.last().message.ptr() != message.ptr())
+                deliveries.append({ message.copyRef(), {} });
+            deliveries.last().channels.append(sub.channel);
         }
     }
 
-    // One task per (message, subscriber), queued in subscription order.
-    // Same-context subscribers share a task queue, so this preserves the
-    // spec-mandated (message-major, creation-minor) delivery order.
-    for (auto& [ctxId, ctxLoopKind, weakChannel] : targets) {
-        ScriptExecutionContext::postTaskTo(ctxId, ctxLoopKind, [weakChannel, message = message.copyRef()](ScriptExecutionContext&) mutable {
-            // Resolve on the target thread so any last deref happens here.
-            if (RefPtr channel = weakChannel.get())
-                channel->dispatchMessage(WTF::move(message));
+    // Batches are FIFO and each delivery lists channels in subscription
+    // order, so same-context subscribers still observe the spec-mandated
+    // (message-major, creation-minor) order.
+    for (auto& [ctxId, ctxLoopKind, batch] : opened) {
+        ScriptExecutionContext::postTaskTo(ctxId, ctxLoopKind, [batch = WTF::move(batch)](ScriptExecutionContext& context) {
+            BunBroadcastChannelRegistry::singleton().closeBatch(*batch);
+            if (!context.globalObject())
+                return;
+            auto* globalObject = defaultGlobalObject(context.globalObject());
+            for (auto& delivery : batch->deliveries) {
+                // Primitives and strings are immutable, so once the first
+                // channel has deserialized one, the rest reuse it. Objects
+                // are deserialized per channel: listeners may mutate them.
+                JSC::JSValue sharedData;
+                for (auto& weakChannel : delivery.channels) {
+                    // Resolve on the target thread so any last deref happens here.
+                    RefPtr channel = weakChannel.get();
+                    if (!channel)
+                        continue;
+                    channel->dispatchMessage(delivery.message.copyRef(), sharedData);
+                    // Each delivery used to be its own task; keep the microtask
+                    // checkpoint the event loop ran after each one, so
+                    // queueMicrotask(cb) inside onmessage runs before the next.
+                    if (globalObject->drainMicrotasks())
+                        return; // termination pending
+                }
+            }
         });
     }
 }
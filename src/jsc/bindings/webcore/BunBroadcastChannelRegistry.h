@@ -5,6 +5,11 @@
 // take a single lock, and fan-out posts tasks straight to each subscriber's
 // own context. There is no MainThreadBridge and no per-context registry —
 // one singleton serves the whole process.
+//
+// Fan-out is batched per destination context: a post appends to that
+// context's pending batch, and only the post that opens a batch queues a
+// task. A burst of messages to N channels on one worker therefore costs one
+// wakeup there, not one per (message, channel).
 
 #pragma once
 
@@ -44,8 +49,19 @@ private:
         BroadcastChannel* identity;
     };
 
+    // Deliveries queued for one (context, loop) whose drain task hasn't run
+    // yet. Owned by that task; m_pendingBatches only points at it while it is
+    // still accepting messages.
+    class PendingBatch;
+    static uint64_t batchKey(ScriptExecutionContextIdentifier ctxId, BunLoopKind loopKind)
+    {
+        return (static_cast<uint64_t>(ctxId) << 8) | static_cast<uint8_t>(loopKind);
+    }
+    void closeBatch(PendingBatch&);
+
     WTF::Lock m_lock;
     HashMap<String, Vector<Subscriber>> m_subscribers WTF_GUARDED_BY_LOCK(m_lock);
+    HashMap<uint64_t, PendingBatch*> m_pendingBatches WTF_GUARDED_BY_LOCK(m_lock);
 };
 
 } // namespace WebCore
@@ -30,6 +30,7 @@ public:
     IsoSubspace* m_subspaceForNodeSqliteSession { nullptr };
     IsoSubspace* m_subspaceForNodeSqliteLimits { nullptr };
     IsoSubspace* m_subspaceForNodeSqliteTagStore { nullptr };
+    IsoSubspace* m_subspaceForLazyJSONObject { nullptr };
     IsoSubspace* m_subspaceForJSSinkConstructor { nullptr };
     IsoSubspace* m_subspaceForJSSinkController { nullptr };
     IsoSubspace* m_subspaceForJSSink { nullptr };
@@ -207,17 +207,20 @@ ExceptionOr<Ref<FetchHeaders>> FetchHeaders::create(std::optional<Init>&& header
 
 ExceptionOr<void> FetchHeaders::fill(const Init& headerInit)
 {
+    headersDidChange();
     return fillHeaderMap(m_headers, headerInit, m_guard);
 }
 
 ExceptionOr<void> FetchHeaders::fill(const FetchHeaders& otherHeaders)
 {
+    headersDidChange();
     if (this->size() == 0) {
         HTTPHeaderMap headers;
         headers.commonHeaders().appendVector(otherHeaders.m_headers.commonHeaders());
         headers.uncommonHeaders().appendVector(otherHeaders.m_headers.uncommonHeaders());
         headers.getSetCookieHeaders().appendVector(otherHeaders.m_headers.getSetCookieHeaders());
         setInternalHeaders(WTF::move(headers));
+        m_wireCache = otherHeaders.shareWireCache();
         m_updateCounter++;
         return {};
     }
@@ -234,6 +237,7 @@ ExceptionOr<void> FetchHeaders::fill(const FetchHeaders& otherHeaders)
 ExceptionOr<void> FetchHeaders::append(const String& name, const String& value)
 {
     ++m_updateCounter;
+    headersDidChange();
     return appendToHeaderMap(name, value, m_headers, m_guard);
 }
 
@@ -245,6 +249,7 @@ ExceptionOr<void> FetchHeaders::remove(const StringView name)
     HTTPHeaderName headerName;
     if (findHTTPHeaderName(name, headerName)) {
         ++m_updateCounter;
+        headersDidChange();
         m_headers.remove(headerName);
         return {};
     }
@@ -253,6 +258,7 @@ ExceptionOr<void> FetchHeaders::remove(const StringView name)
         return Exception { TypeError, makeString("Invalid header name: '"_s, name, "'"_s) };
 
     ++m_updateCounter;
+    headersDidChange();
     m_headers.removeUncommonHeader(name);
 
     return {};
@@ -260,7 +266,7 @@ ExceptionOr<void> FetchHeaders::remove(const StringView name)
 
 size_t FetchHeaders::memoryCost() const
 {
-    return m_headers.memoryCost() + sizeof(*this);
+    return m_headers.memoryCost() + sizeof(*this) + (m_wireCache && m_wireCache->block ? m_wireCache->block->bytes.capacity() : 0);
 }
 
 ExceptionOr<String> FetchHeaders::get(const StringView name) const
@@ -294,6 +300,7 @@ ExceptionOr<void> FetchHeaders::set(const HTTPHeaderName name, const String& val
         return {};
 
     ++m_updateCounter;
+    headersDidChange();
     m_headers.set(name, normalizedValue);
 
     if (m_guard == FetchHeaders::Guard::RequestNoCors)
@@ -302,6 +309,30 @@ ExceptionOr<void> FetchHeaders::set(const HTTPHeaderName name, const String& val
     return {};
 }
 
+ExceptionOr<void> FetchHeaders::putDefault(HTTPHeaderName name, const String& value)
+{
+    if (m_headers.contains(name))
+        return {};
+
+    // Response.json() and Blob bodies add their Content-Type to the copy a
+    // Response takes of its Headers. Copies of one shared object that all get
+    // the same default are still identical, so rather than losing the shared
+    // cache they move to one kept for exactly that default.
+    RefPtr sharedCache = WTF::move(m_wireCache);
+    auto result = set(name, value);
+    if (result.hasException() || !sharedCache || !m_headers.contains(name))
+        return result;
+
+    auto& cache = sharedCache->withDefaultHeader;
+    if (!cache || sharedCache->defaultHeaderName != name || sharedCache->defaultHeaderValue != value) {
+        cache = adoptRef(*new WireCache);
+        sharedCache->defaultHeaderName = name;
+        sharedCache->defaultHeaderValue = value;
+    }
+    m_wireCache = cache;
+    return result;
+}
+
 ExceptionOr<void> FetchHeaders::set(const String& name, const String& value)
 {
     String normalizedValue = trimHTTPSpaceIfNeeded(value);
@@ -312,6 +343,7 @@ ExceptionOr<void> FetchHeaders::set(const String& name, const String& value)
         return {};
 
     ++m_updateCounter;
+    headersDidChange();
     m_headers.set(name, normalizedValue);
 
     if (m_guard == FetchHeaders::Guard::RequestNoCors)
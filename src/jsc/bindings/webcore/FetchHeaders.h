@@ -30,8 +30,11 @@
 
 #include "ExceptionOr.h"
 #include "HTTPHeaderMap.h"
+#include <memory>
 #include <variant>
 #include <wtf/HashTraits.h>
+#include <wtf/NotFound.h>
+#include <wtf/RefCounted.h>
 #include <wtf/Vector.h>
 
 namespace WebCore {
@@ -64,6 +67,8 @@ public:
     ExceptionOr<bool> has(const StringView) const;
     ExceptionOr<void> set(const String& name, const String& value);
     ExceptionOr<void> set(const HTTPHeaderName name, const String& value);
+    // Sets `name` only if it is absent, like the Content-Type a Response adds.
+    ExceptionOr<void> putDefault(HTTPHeaderName, const String& value);
 
     ExceptionOr<void> fill(const Init&);
     ExceptionOr<void> fill(const FetchHeaders&);
@@ -82,7 +87,13 @@ public:
 
     String fastGet(HTTPHeaderName name) const { return m_headers.get(name); }
     bool fastHas(HTTPHeaderName name) const { return m_headers.contains(name); }
-    bool fastRemove(HTTPHeaderName name) { return m_headers.remove(name); }
+    bool fastRemove(HTTPHeaderName name)
+    {
+        if (!m_headers.remove(name))
+            return false;
+        headersDidChange();
+        return true;
+    }
 
     const Vector<String, 0>& getSetCookieHeaders() const { return m_headers.getSetCookieHeaders(); }
 
@@ -110,9 +121,45 @@ public:
         return Iterator(*this, true);
     }
 
-    void setInternalHeaders(HTTPHeaderMap&& headers) { m_headers = WTF::move(headers); }
+    void setInternalHeaders(HTTPHeaderMap&& headers)
+    {
+        headersDidChange();
+        m_headers = WTF::move(headers);
+    }
     const HTTPHeaderMap& internalHeaders() const { return m_headers; }
 
+    // The headers as HTTP/1.1 response lines ("name: value\r\n"), built by
+    // NodeHTTP.cpp for headers that are written to more than one response.
+    struct WireBlock {
+        Vector<uint8_t> bytes;
+        // Where the Content-Length line starts, or notFound.
+        size_t contentLengthOffset { notFound };
+        bool hasDate { false };
+        bool hasDateBeforeContentLength { false };
+        bool hasTransferEncoding { false };
+        bool hasConnectionClose { false };
+    };
+    // Counts a write of these headers to a response and returns them as a
+    // WireBlock once they look reused, building it with `serialize` the first
+    // time. Null means they should be written header by header.
+    template<typename Serialize>
+    const WireBlock* wireBlockForWrite(const Serialize& serialize)
+    {
+        if (!m_wireCache) {
+            if (++m_wireUses < 2)
+                return nullptr;
+            m_wireCache = adoptRef(*new WireCache);
+        }
+        if (!m_wireCache->block)
+            m_wireCache->block = serialize();
+        return m_wireCache->block.get();
+    }
+    // For tests: whether these headers, or their copies, have a cached block.
+    bool hasCachedWireBlock() const
+    {
+        return m_wireCache && (m_wireCache->block || (m_wireCache->withDefaultHeader && m_wireCache->withDefaultHeader->block));
+    }
+
     void setGuard(Guard);
     Guard guard() const { return m_guard; }
 
@@ -122,8 +169,29 @@ public:
     uint64_t m_updateCounter { 0 };
 
 private:
+    // Shared with the copies made of this object until one of them changes.
+    struct WireCache : RefCounted<WireCache> {
+        std::unique_ptr<WireBlock> block;
+        // The cache of the copies that putDefault() gave the same header, so
+        // they still share a block among themselves.
+        RefPtr<WireCache> withDefaultHeader;
+        HTTPHeaderName defaultHeaderName { HTTPHeaderName::ContentType };
+        String defaultHeaderValue;
+    };
+
+    void headersDidChange()
+    {
+        m_wireCache = nullptr;
+        m_wireUses = 0;
+    }
+    RefPtr<WireCache> shareWireCache() const;
+
     Guard m_guard;
     HTTPHeaderMap m_headers;
+    // Writes of these headers, and copies made of them, since they last
+    // changed. Once there are two, a WireCache is worth allocating.
+    mutable unsigned m_wireUses { 0 };
+    mutable RefPtr<WireCache> m_wireCache;
 };
 
 inline FetchHeaders::FetchHeaders(Guard guard, HTTPHeaderMap&& headers)
@@ -136,7 +204,19 @@ inline FetchHeaders::FetchHeaders(const FetchHeaders& other)
     : RefCounted<FetchHeaders>()
     , m_guard(other.m_guard)
     , m_headers(other.m_headers)
+    , m_wireCache(other.shareWireCache())
+{
+}
+
+// A Headers object that is copied more than once (the clone each Response
+// takes) is one set of headers sent many times. From the second copy on, the
+// original and its copies share a WireCache, and whichever is written first
+// fills it for the rest.
+inline RefPtr<FetchHeaders::WireCache> FetchHeaders::shareWireCache() const
 {
+    if (!m_wireCache && ++m_wireUses >= 2)
+        m_wireCache = adoptRef(*new WireCache);
+    return m_wireCache;
 }
 
 inline void FetchHeaders::setGuard(Guard guard)
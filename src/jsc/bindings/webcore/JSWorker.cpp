@@ -359,6 +359,7 @@ template<> __attribute__((minsize)) JSC::EncodedJSValue JSC_HOST_CALL_ATTRIBUTES
         WebCore::propagateException(*lexicalGlobalObject, throwScope, serialized.releaseException());
         RELEASE_AND_RETURN(throwScope, {});
     }
+    serialized.returnValue()->setDeserializeOnce();
 
     Vector<TransferredMessagePort> transferredPorts;
 
@@ -97,6 +97,12 @@ auto MessageEvent::create(JSC::JSGlobalObject& globalObject, Ref<SerializedScrip
     if (topExceptionScope.exception()) [[unlikely]]
         deserialized = jsUndefined();
 
+    return create(globalObject, WTF::move(data), deserialized, didFail, origin, lastEventId, WTF::move(source), WTF::move(ports));
+}
+
+auto MessageEvent::create(JSC::JSGlobalObject& globalObject, Ref<SerializedScriptValue>&& data, JSC::JSValue deserialized, bool didFail, const String& origin, const String& lastEventId, RefPtr<MessagePort>&& source, Vector<RefPtr<MessagePort>>&& ports) -> MessageEventWithStrongData
+{
+    auto& vm = globalObject.vm();
     JSC::Strong<JSC::Unknown> strongData(vm, deserialized);
 
     auto& eventType = didFail ? eventNames().messageerrorEvent : eventNames().messageEvent;
@@ -104,6 +104,7 @@ ExceptionOr<void> MessagePort::postMessage(JSC::JSGlobalObject& state, JSC::JSVa
         return messageData.releaseException();
     }
     RETURN_IF_EXCEPTION(warnScope, {});
+    messageData.returnValue()->setDeserializeOnce();
 
     if (!isEntangled())
         return {};
@@ -12,10 +12,50 @@
 #include "MessagePortPipe.h"
 #include "ScriptExecutionContext.h"
 #include <wtf/Locker.h>
+#include <wtf/Threading.h>
 
 namespace WebCore {
 
-MessagePortPipe::~MessagePortPipe() = default;
+MessagePortPipe::~MessagePortPipe()
+{
+    // Ring slots hold leaked refs; anything never delivered is released here.
+    for (auto& side : m_sides) {
+        while (side.ring.pop()) { }
+    }
+}
+
+// Under Side::lock: move up to `max` of the oldest queued messages into
+// `draining`, ring first (see the ordering note in MessagePortPipe.h).
+size_t MessagePortPipe::takeIntoDraining(Side& s, size_t max)
+{
+    size_t n = 0;
+    for (; n < max; ++n) {
+        auto message = s.ring.pop();
+        if (!message)
+            break;
+        s.draining.append(WTF::move(*message));
+    }
+    for (; n < max && !s.inbox.isEmpty(); ++n)
+        s.draining.append(s.inbox.takeFirst());
+    s.inboxSize.store(s.inbox.size(), std::memory_order_release);
+    return n;
+}
+
+bool MessagePortPipe::hasQueuedMessages(Side& s)
+{
+    return !s.draining.isEmpty() || !s.ring.isEmpty() || !s.inbox.isEmpty();
+}
+
+// Under Side::lock, once the side looked empty: drop DrainScheduled. A lock-free
+// send that saw the bit still set left its wakeup to this drain, so look at the
+// ring again after clearing; returns true if the caller must keep draining.
+bool MessagePortPipe::stopDraining(Side& s)
+{
+    s.state.fetch_and(~uint64_t(DrainScheduled), std::memory_order_acq_rel);
+    if (s.ring.isEmpty())
+        return false;
+    return !(s.state.fetch_or(DrainScheduled, std::memory_order_acq_rel) & DrainScheduled);
+}
 
 // Defined here (not in TransferredMessagePort.h) to break the header cycle
 // MessagePortPipe.h → MessageWithMessagePorts.h → TransferredMessagePort.h.
@@ -31,31 +71,88 @@ TransferredMessagePort::~TransferredMessagePort()
 void MessagePortPipe::send(uint8_t fromSide, MessageWithMessagePorts&& message)
 {
     ASSERT(fromSide < 2);
-    auto& dst = m_sides[1 - fromSide];
+    if (trySendWithoutLock(1 - fromSide, message))
+        return;
 
+    auto& dst = m_sides[1 - fromSide];
     ScriptExecutionContextIdentifier wakeCtx = 0;
     BunLoopKind wakeLoopKind = BunLoopKind::Regular;
     {
         Locker locker { dst.lock };
-        uint64_t s = dst.state.load(std::memory_order_relaxed);
-        if (s & Closed)
+        if (dst.state.load(std::memory_order_relaxed) & Closed)
             return;
 
         dst.inbox.append(WTF::move(message));
+        dst.inboxSize.store(dst.inbox.size(), std::memory_order_release);
 
-        uint64_t ns = s + QueuedOne;
-        if ((s & Attached) && !(s & DrainScheduled)) {
-            ns |= DrainScheduled;
+        uint64_t s = dst.state.fetch_add(QueuedOne, std::memory_order_acq_rel);
+        if ((s & Attached) && !(dst.state.fetch_or(DrainScheduled, std::memory_order_acq_rel) & DrainScheduled)) {
             wakeCtx = dst.ctxId;
             wakeLoopKind = dst.ctxLoopKind;
         }
-        dst.state.store(ns, std::memory_order_release);
     }
 
     if (wakeCtx)
         scheduleDrain(1 - fromSide, wakeCtx, wakeLoopKind);
 }
 
+bool MessagePortPipe::trySendWithoutLock(uint8_t toSide, MessageWithMessagePorts& message)
+{
+    auto& dst = m_sides[toSide];
+    auto& ring = dst.ring;
+    if (!message.transferredPorts.isEmpty())
+        return false;
+
+    uint32_t self = Thread::currentSingleton().uid();
+    uint32_t producer = ring.producer.load(std::memory_order_relaxed);
+    if (producer != self) {
+        if (producer || !ring.producer.compare_exchange_strong(producer, self, std::memory_order_acq_rel))
+            return false;
+    }
+    // Something already went through the locked inbox (a transfer, another
+    // thread, a full ring): stay behind it until the receiver has taken it.
+    if (dst.inboxSize.load(std::memory_order_acquire))
+        return false;
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= Ring::capacity)
+        return false;
+
+    // Count before publishing so the receiver never pops a message it hasn't
+    // been charged for.
+    if (dst.state.fetch_add(QueuedOne, std::memory_order_acq_rel) & Closed) {
+        dst.state.fetch_sub(QueuedOne, std::memory_order_acq_rel);
+        return true;
+    }
+    ring.slots[head % Ring::capacity] = message.message.leakRef();
+    ring.head.store(head + 1, std::memory_order_release);
+
+    uint64_t s = dst.state.fetch_or(DrainScheduled, std::memory_order_acq_rel);
+    if (!(s & (DrainScheduled | Closed)))
+        wakeAfterSendWithoutLock(toSide);
+    return true;
+}
+
+void MessagePortPipe::wakeAfterSendWithoutLock(uint8_t side)
+{
+    // This thread just turned DrainScheduled on without knowing whether the side
+    // is attached. attach() makes the same decision under the lock, so either it
+    // sees the bit and leaves the drain to us, or we clear it and it schedules.
+    auto& s = m_sides[side];
+    ScriptExecutionContextIdentifier ctxId = 0;
+    BunLoopKind ctxLoopKind = BunLoopKind::Regular;
+    {
+        Locker locker { s.lock };
+        uint64_t st = s.state.load(std::memory_order_relaxed);
+        if (!(st & Attached) || (st & Closed)) {
+            s.state.fetch_and(~uint64_t(DrainScheduled), std::memory_order_acq_rel);
+            return;
+        }
+        ctxId = s.ctxId;
+        ctxLoopKind = s.ctxLoopKind;
+    }
+    scheduleDrain(side, ctxId, ctxLoopKind);
+}
+
 void MessagePortPipe::scheduleDrain(uint8_t side, ScriptExecutionContextIdentifier ctxId, BunLoopKind ctxLoopKind)
 {
     // The posted task holds a strong ref to the pipe so it can't be destroyed
@@ -83,11 +180,11 @@ void MessagePortPipe::drainAndDispatch(uint8_t side, ScriptExecutionContextIdent
     // queued when the drain began", which a sender on another thread can make
     // arbitrarily large); the rest continues after the loop has polled.
     //
-    // Messages move inbox -> `draining` a small batch per lock acquisition and are
-    // popped from `draining` one at a time (still under the lock, but without a
+    // Messages move ring/inbox -> `draining` a small batch per lock acquisition and
+    // are popped from `draining` one at a time (still under the lock, but without a
     // sender contending for it per message). If the handler transfers this port
-    // (pipe->detach clears `s.port`/`Attached`), detach() splices `draining` back
-    // in front of the inbox so everything stays buffered, in order, for the new owner.
+    // (pipe->detach clears `s.port`/`Attached`), `draining` stays in front of the
+    // ring and inbox so everything stays buffered, in order, for the new owner.
     auto& s = m_sides[side];
 
     RefPtr<MessagePort> port;
@@ -102,11 +199,12 @@ void MessagePortPipe::drainAndDispatch(uint8_t side, ScriptExecutionContextIdent
         if (s.ctxId != expectedCtx)
             return;
         port = s.port.get();
-        uint64_t st = s.state.load(std::memory_order_relaxed);
-        if (!port || (s.draining.isEmpty() && s.inbox.isEmpty())) {
-            s.state.store(st & ~DrainScheduled, std::memory_order_release);
+        if (!port) {
+            s.state.fetch_and(~uint64_t(DrainScheduled), std::memory_order_acq_rel);
             return;
         }
+        if (!hasQueuedMessages(s) && !stopDraining(s))
+            return;
         limit = 1024;
     }
 
@@ -141,11 +239,12 @@ void MessagePortPipe::drainAndDispatch(uint8_t side, ScriptExecutionContextIdent
             // already returned anything we had taken to the inbox.
             if (s.ctxId != expectedCtx || s.port.get() != port)
                 break;
-            uint64_t st = s.state.load(std::memory_order_relaxed);
-            if (!(st & Attached) || (s.draining.isEmpty() && s.inbox.isEmpty())) {
-                s.state.store(st & ~DrainScheduled, std::memory_order_release);
+            if (!(s.state.load(std::memory_order_relaxed) & Attached)) {
+                s.state.fetch_and(~uint64_t(DrainScheduled), std::memory_order_acq_rel);
                 break;
             }
+            if (!hasQueuedMessages(s) && !stopDraining(s))
+                break;
             if (s.draining.isEmpty()) {
                 if (!limit) {
                     // Yield to the rest of the event loop; DrainScheduled stays
@@ -155,13 +254,12 @@ void MessagePortPipe::drainAndDispatch(uint8_t side, ScriptExecutionContextIdent
                 }
                 // Refill: this is the only acquisition that contends with senders
                 // for more than one message's worth of work.
-                size_t n = std::min({ takeAtOnce, limit, static_cast<size_t>(s.inbox.size()) });
-                for (size_t i = 0; i < n; ++i)
-                    s.draining.append(s.inbox.takeFirst());
-                limit -= n;
+                limit -= takeIntoDraining(s, std::min(takeAtOnce, limit));
+                if (s.draining.isEmpty())
+                    continue;
             }
             message = s.draining.takeFirst();
-            s.state.store(st - QueuedOne, std::memory_order_release);
+            s.state.fetch_sub(QueuedOne, std::memory_order_acq_rel);
         }
 
         port->dispatchOneMessage(*context, WTF::move(*message));
@@ -176,8 +274,6 @@ void MessagePortPipe::drainAndDispatch(uint8_t side, ScriptExecutionContextIdent
         // pre-loop check instead of dispatching the rest to zero listeners.
         if (!port->hasMessageEventListener()) {
             Locker locker { s.lock };
-            while (!s.draining.isEmpty())
-                s.inbox.prepend(s.draining.takeLast());
             s.state.fetch_and(~uint64_t(DrainScheduled), std::memory_order_acq_rel);
             break;
         }
@@ -199,11 +295,10 @@ std::optional<MessageWithMessagePorts> MessagePortPipe::takeOne(uint8_t side)
     Locker locker { s.lock };
     // From inside a handler (receiveMessageOnPort), the next message in order may
     // already sit in the drain's batch.
-    auto& queue = s.draining.isEmpty() ? s.inbox : s.draining;
-    if (queue.isEmpty())
+    if (s.draining.isEmpty() && !takeIntoDraining(s, 1))
         return std::nullopt;
     s.state.fetch_sub(QueuedOne, std::memory_order_acq_rel);
-    return queue.takeFirst();
+    return s.draining.takeFirst();
 }
 
 void MessagePortPipe::attach(uint8_t side, ScriptExecutionContext& context, ThreadSafeWeakPtr<MessagePort> port)
@@ -218,13 +313,11 @@ void MessagePortPipe::attach(uint8_t side, ScriptExecutionContext& context, Thre
         s.ctxId = ctxId;
         s.ctxLoopKind = ctxLoopKind;
         s.port = WTF::move(port);
-        uint64_t st = s.state.load(std::memory_order_relaxed);
-        uint64_t ns = (st | Attached | ContextKnown) & ~Closed;
-        if (queuedCount(st) > 0 && !(st & DrainScheduled)) {
-            ns |= DrainScheduled;
+        uint64_t st = s.state.fetch_or(Attached | ContextKnown, std::memory_order_acq_rel);
+        if (st & Closed)
+            s.state.fetch_and(~uint64_t(Closed), std::memory_order_acq_rel);
+        if (queuedCount(st) > 0 && !(s.state.fetch_or(DrainScheduled, std::memory_order_acq_rel) & DrainScheduled))
             wakeCtx = ctxId;
-        }
-        s.state.store(ns, std::memory_order_release);
     }
     if (wakeCtx)
         scheduleDrain(side, wakeCtx, ctxLoopKind);
@@ -250,7 +343,7 @@ void MessagePortPipe::registerCloseContext(uint8_t side, ScriptExecutionContext&
         s.ctxId = ctxId;
         s.ctxLoopKind = ctxLoopKind;
         s.port = WTF::move(port);
-        s.state.store(st | ContextKnown, std::memory_order_release);
+        s.state.fetch_or(ContextKnown, std::memory_order_acq_rel);
     }
     // See attach(): re-deliver a peer-close that fired while this side had no
     // context (in transit or never registered).
@@ -262,10 +355,12 @@ void MessagePortPipe::detach(uint8_t side)
 {
     ASSERT(side < 2);
     auto& s = m_sides[side];
+    // This port is what sends to the other side; whoever entangles it next may be
+    // on another thread and gets to claim that side's ring.
+    m_sides[1 - side].ring.producer.store(0, std::memory_order_release);
     Locker locker { s.lock };
-    // Taken for dispatch by the owner that is letting go: back in front, in order.
-    while (!s.draining.isEmpty())
-        s.inbox.prepend(s.draining.takeLast());
+    // Anything the letting-go owner took for dispatch stays in `draining`, ahead
+    // of the ring and inbox, for the next owner.
     s.ctxId = 0;
     s.port = nullptr;
     // Drop Attached and DrainScheduled. A drain task already in flight on
@@ -298,11 +393,22 @@ void MessagePortPipe::close(uint8_t side, CloseKind kind)
             Locker locker { s.lock };
             s.ctxId = 0;
             s.port = nullptr;
-            // Closed is terminal; queued messages are dropped.
-            s.state.store(sdKind == CloseKind::Explicit ? (Closed | ClosedByRequest) : Closed, std::memory_order_release);
+            // Closed is terminal; queued messages are dropped. Set it before
+            // draining so a lock-free sender that charges the count from here on
+            // sees it and backs its charge out itself.
+            uint64_t closedFlags = sdKind == CloseKind::Explicit ? (Closed | ClosedByRequest) : Closed;
+            s.state.fetch_or(closedFlags, std::memory_order_acq_rel);
+            s.state.fetch_and(~((Attached | ContextKnown | DrainScheduled | ClosedByRequest) & ~closedFlags), std::memory_order_acq_rel);
             dropped = std::exchange(s.inbox, {});
+            s.inboxSize.store(0, std::memory_order_release);
+            while (auto message = s.ring.pop())
+                dropped.append(WTF::move(*message));
             while (!s.draining.isEmpty())
                 dropped.prepend(s.draining.takeLast());
+            // Uncharge exactly what was dropped; zeroing the count instead
+            // would let that sender's fetch_sub wrap it.
+            if (!dropped.isEmpty())
+                s.state.fetch_sub(QueuedOne * dropped.size(), std::memory_order_acq_rel);
         }
 
         // Harvest transferred pipes before `dropped` destructs so their
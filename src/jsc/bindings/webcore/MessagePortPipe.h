@@ -4,9 +4,19 @@
 // A pipe has two sides. Each side has an inbox (messages waiting to be
 // delivered to the port attached on that side) protected by a per-side lock,
 // plus a single atomic state word that packs all flags and the queued-message
-// count. All mutations happen under the per-side lock; the atomic exists so
-// that lockless readers (the GC's hasPendingActivity check, and senders
-// deciding whether to schedule a wakeup) can observe a consistent snapshot.
+// count. The state word is only ever changed with atomic read-modify-writes so
+// that lockless readers (the GC's hasPendingActivity check) and the lock-free
+// sender below can observe and update it without the lock.
+//
+// Each side also has a single-producer/single-consumer ring. The first thread
+// to send to a side claims its producer end; while it keeps sending plain
+// messages (no transferred ports) and the locked inbox is empty, it appends to
+// the ring and bumps the state word without taking the lock, so it only
+// contends with the receiver when it has to schedule a wakeup. Transfers,
+// other sending threads and a full ring take the locked inbox. Ring messages
+// are always older than inbox messages (the producer stops using the ring as
+// soon as the inbox is non-empty), so the receiver reads `draining`, then the
+// ring, then the inbox. Everything on the consumer end runs under the lock.
 //
 // Wakeups are coalesced: a burst of N sends schedules one cross-thread drain
 // task on the receiving context. The drain task moves messages inbox ->
@@ -14,8 +24,8 @@
 // at a time, draining microtasks between each (matching Node's MakeCallback /
 // InternalCallbackScope behavior), up to a fixed 1024 per task before
 // continuing on the loop's next iteration. A port transferred mid-loop carries
-// the whole remaining queue to the new owner: detach() puts `draining` back in
-// front of the inbox, in order.
+// the whole remaining queue to the new owner: `draining`, the ring and the
+// inbox all stay with the side, and are read in that order.
 //
 // The Web API semantics (start(), close(), transfer, event dispatch) live in
 // MessagePort; this class knows nothing about EventTarget or JS.
@@ -23,6 +33,7 @@
 #pragma once
 
 #include "MessageWithMessagePorts.h"
+#include <array>
 #include <wtf/Deque.h>
 #include <wtf/Lock.h>
 #include <wtf/ThreadSafeRefCounted.h>
@@ -92,24 +103,59 @@ private:
     void scheduleDrain(uint8_t side, ScriptExecutionContextIdentifier, BunLoopKind);
     void notifyPeerClosed(uint8_t peerSide);
     void drainAndDispatch(uint8_t side, ScriptExecutionContextIdentifier expectedCtx);
+    bool trySendWithoutLock(uint8_t toSide, MessageWithMessagePorts&);
+    void wakeAfterSendWithoutLock(uint8_t side);
+
+    // Lock-free SPSC queue of messages without transferred ports. `head` is only
+    // written by the thread in `producer`, `tail` only under Side::lock.
+    struct Ring {
+        static constexpr size_t capacity = 256;
+
+        // Thread uid that owns the producer end, or 0. Reset when the sending
+        // port is detached so the port's next owner can claim it.
+        std::atomic<uint32_t> producer { 0 };
+        alignas(64) std::atomic<size_t> head { 0 };
+        alignas(64) std::atomic<size_t> tail { 0 };
+        std::array<SerializedScriptValue*, capacity> slots {};
+
+        bool isEmpty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed); }
+        // Consumer end; the caller holds Side::lock.
+        std::optional<MessageWithMessagePorts> pop()
+        {
+            size_t t = tail.load(std::memory_order_relaxed);
+            if (head.load(std::memory_order_acquire) == t)
+                return std::nullopt;
+            RefPtr<SerializedScriptValue> message = adoptRef(slots[t % capacity]);
+            tail.store(t + 1, std::memory_order_release);
+            return MessageWithMessagePorts { WTF::move(message), {} };
+        }
+    };
 
     struct Side {
         WTF::Lock lock;
         WTF::Deque<MessageWithMessagePorts> inbox WTF_GUARDED_BY_LOCK(lock);
-        // Messages the owner's drain has taken out of `inbox` (a small batch per lock
-        // acquisition) but not dispatched yet. Still counted as queued in `state`. If the
-        // handler transfers the port mid-batch, detach() puts them back in front of `inbox`
-        // so the next owner sees everything, in order; close() drops them with the rest.
+        // Messages the owner's drain has taken out of `ring` and `inbox` (a small batch per
+        // lock acquisition) but not dispatched yet. Still counted as queued in `state`. They
+        // are older than anything in `ring` or `inbox`, so if the handler transfers the port
+        // mid-batch they stay here for the next owner; close() drops them with the rest.
         WTF::Deque<MessageWithMessagePorts> draining WTF_GUARDED_BY_LOCK(lock);
+        // inbox.size(), for the lock-free sender's "is the inbox empty" check.
+        std::atomic<size_t> inboxSize { 0 };
+        Ring ring;
         ScriptExecutionContextIdentifier ctxId WTF_GUARDED_BY_LOCK(lock) { 0 };
         // The loop `ctxId` was running when this side attached there; drains and the peer-close
         // notification are posted to it.
         BunLoopKind ctxLoopKind WTF_GUARDED_BY_LOCK(lock) { BunLoopKind::Regular };
         ThreadSafeWeakPtr<MessagePort> port WTF_GUARDED_BY_LOCK(lock);
-        // Packed flags + count. Written only while holding `lock`; read locklessly.
+        // Packed flags + count. Changed only by atomic read-modify-writes; the lock-free
+        // sender adds to the count and sets DrainScheduled without holding `lock`.
         std::atomic<uint64_t> state { 0 };
     };
     Side m_sides[2];
+
+    static bool hasQueuedMessages(Side& s) WTF_REQUIRES_LOCK(s.lock);
+    static size_t takeIntoDraining(Side& s, size_t max) WTF_REQUIRES_LOCK(s.lock);
+    static bool stopDraining(Side& s) WTF_REQUIRES_LOCK(s.lock);
 };
 
 } // namespace WebCore
@@ -189,6 +189,7 @@ enum SerializationTag {
     DOMExceptionTag = 51,
     ResizableArrayBufferTag = 54,
     ErrorInstanceTag = 55,
+    ArrayBufferSnapshotTag = 56,
 
     Bun__BlobTag = 254,
     // bun types start at 254 and decrease with each addition
@@ -424,6 +425,14 @@ const uint8_t cryptoKeyOKPOpNameTagMaximumValue = 1;
 [[maybe_unused]] static constexpr unsigned TerminatorTag = 0xFFFFFFFF;
 [[maybe_unused]] static constexpr unsigned StringPoolTag = 0xFFFFFFFE;
 [[maybe_unused]] static constexpr unsigned NonIndexPropertiesTag = 0xFFFFFFFD;
+[[maybe_unused]] static constexpr unsigned SharedStringTag = 0xFFFFFFFC;
+
+// Strings and ArrayBuffers at least this large skip the wire buffer when posted
+// to another context in this process: strings are handed over by reference and
+// ArrayBuffers are snapshotted once into contents the receiver can adopt.
+// SharedStringTag and ArrayBufferSnapshotTag index side tables that only live
+// in memory, so they are never written for storage or cross-process transfer.
+static constexpr size_t MinZeroCopyCloneLength = 64 * 1024;
 
 // The high bit of a StringData's length determines the character size.
 static constexpr unsigned StringDataIs8BitFlag = 0x80000000;
@@ -510,7 +519,8 @@ static constexpr unsigned StringDataIs8BitFlag = 0x80000000;
  *
  * StringData :-
  *      StringPoolTag <cpIndex:IndexType>
- *      (not (TerminatorTag | StringPoolTag))<is8Bit:uint32_t:1><length:uint32_t:31><characters:CharType{length}> // Added to constant pool when seen, string length 0xFFFFFFFF is disallowed
+ *      SharedStringTag <sharedStringIndex:uint32_t> // Not added to the constant pool
+ *      (not (TerminatorTag | StringPoolTag | SharedStringTag))<is8Bit:uint32_t:1><length:uint32_t:31><characters:CharType{length}> // Added to constant pool when seen, string length 0xFFFFFFFF is disallowed
  *
  * BigInt :-
  *      BigIntTag BigIntData
@@ -545,6 +555,7 @@ static constexpr unsigned StringDataIs8BitFlag = 0x80000000;
  *    ResizableArrayBufferTag <byteLength:uint64_t> <maxLength:uint64_t> <contents:byte{length}>
  *    ArrayBufferTransferTag <value:uint32_t>
  *    SharedArrayBufferTag <value:uint32_t>
+ *    ArrayBufferSnapshotTag <value:uint32_t>
  *
  * CryptoKeyHMAC :-
  *    <keySize:uint32_t> <keyData:byte{keySize}> CryptoAlgorithmIdentifierTag // Algorithm tag inner hash function.
@@ -723,7 +734,7 @@ public:
         WasmMemoryHandleArray& wasmMemoryHandles,
 #endif
         Vector<uint8_t>& out, SerializationContext context, ArrayBufferContentsArray& sharedBuffers,
-        Vector<void*>& serializedBlockListRefs,
+        Vector<void*>& serializedBlockListRefs, Vector<String>& sharedStrings, ArrayBufferContentsArray& snapshotBuffers,
         SerializationForStorage forStorage, SerializationForCrossProcessTransfer forTransfer)
     {
         CloneSerializer serializer(lexicalGlobalObject, messagePorts, arrayBuffers,
@@ -734,6 +745,8 @@ public:
             out, context, sharedBuffers, forStorage, forTransfer);
         auto code = serializer.serialize(value);
         serializedBlockListRefs = WTF::move(serializer.m_serializedBlockListRefs);
+        sharedStrings = WTF::move(serializer.m_sharedStrings);
+        snapshotBuffers = WTF::move(serializer.m_snapshotBuffers);
         return code;
     }
 
@@ -927,11 +940,27 @@ private:
         code = SerializationReturnCode::DataCloneError;
     }
 
+    // Side tables only survive while the value stays in this process, and
+    // only postMessage/structuredClone hand the value to another context.
+    bool canCloneWithoutCopy() const
+    {
+        return m_context == SerializationContext::WorkerPostMessage
+            && m_forStorage == SerializationForStorage::No
+            && m_forTransfer == SerializationForCrossProcessTransfer::No;
+    }
+
     void dumpString(const String& string)
     {
         if (string.isEmpty())
             write(EmptyStringTag);
-        else {
+        else if (string.length() >= MinZeroCopyCloneLength && canCloneWithoutCopy()) {
+            // Bypasses the constant pool: interning a multi-megabyte string as an
+            // Identifier would hash it and copy its characters into the wire buffer.
+            write(StringTag);
+            write(SharedStringTag);
+            write(static_cast<uint32_t>(m_sharedStrings.size()));
+            m_sharedStrings.append(Bun::toCrossThreadShareable(string));
+        } else {
             write(StringTag);
             write(string);
         }
@@ -1317,6 +1346,17 @@ private:
                 }
 
                 uint64_t byteLength = arrayBuffer->byteLength();
+                if (byteLength >= MinZeroCopyCloneLength && canCloneWithoutCopy()) {
+                    // One copy into contents the receiver adopts, rather than one
+                    // into the wire buffer and another back out of it.
+                    ArrayBufferContents contents;
+                    if (arrayBuffer->copyTo(contents)) {
+                        write(ArrayBufferSnapshotTag);
+                        write(static_cast<uint32_t>(m_snapshotBuffers.size()));
+                        m_snapshotBuffers.append(WTF::move(contents));
+                        return true;
+                    }
+                }
                 if (!m_buffer.tryReserveCapacity(static_cast<uint64_t>(m_buffer.size()) + sizeof(uint8_t) + sizeof(uint64_t) + byteLength)) [[unlikely]] {
                     code = SerializationReturnCode::DataCloneError;
                     return true;
@@ -1983,6 +2023,8 @@ private:
     SerializationContext m_context;
     ArrayBufferContentsArray& m_sharedBuffers;
     Vector<void*> m_serializedBlockListRefs;
+    Vector<String> m_sharedStrings;
+    ArrayBufferContentsArray m_snapshotBuffers;
 #if ENABLE(WEBASSEMBLY)
     WasmModuleArray& m_wasmModules;
     WasmMemoryHandleArray& m_wasmMemoryHandles;
@@ -2255,7 +2297,8 @@ class CloneDeserializer : public CloneBase {
 
 public:
     static DeserializationResult deserialize(JSGlobalObject* lexicalGlobalObject, JSGlobalObject* globalObject, const Vector<RefPtr<MessagePort>>& messagePorts,
-        ArrayBufferContentsArray* arrayBufferContentsArray, const std::span<uint8_t>& buffer, const Vector<String>& blobURLs, const Vector<String> blobFilePaths, ArrayBufferContentsArray* sharedBuffers
+        ArrayBufferContentsArray* arrayBufferContentsArray, const std::span<uint8_t>& buffer, const Vector<String>& blobURLs, const Vector<String> blobFilePaths, ArrayBufferContentsArray* sharedBuffers,
+        const Vector<String>* sharedStrings, ArrayBufferContentsArray* snapshotBuffers, bool adoptSnapshotBuffers
 #if ENABLE(WEBASSEMBLY)
         ,
         WasmModuleArray* wasmModules, WasmMemoryHandleArray* wasmMemoryHandles
@@ -2264,7 +2307,8 @@ public:
     {
         if (!buffer.size())
             return std::make_pair(jsNull(), SerializationReturnCode::UnspecifiedError);
-        CloneDeserializer deserializer(lexicalGlobalObject, globalObject, messagePorts, arrayBufferContentsArray, std::span<uint8_t> { buffer.begin(), buffer.end() }, blobURLs, blobFilePaths, sharedBuffers
+        CloneDeserializer deserializer(lexicalGlobalObject, globalObject, messagePorts, arrayBufferContentsArray, std::span<uint8_t> { buffer.begin(), buffer.end() }, blobURLs, blobFilePaths, sharedBuffers,
+            sharedStrings, snapshotBuffers, adoptSnapshotBuffers
 #if ENABLE(WEBASSEMBLY)
             ,
             wasmModules, wasmMemoryHandles
@@ -2356,7 +2400,8 @@ private:
             m_version = 0xFFFFFFFF;
     }
 
-    CloneDeserializer(JSGlobalObject* lexicalGlobalObject, JSGlobalObject* globalObject, const Vector<RefPtr<MessagePort>>& messagePorts, ArrayBufferContentsArray* arrayBufferContents, const std::span<uint8_t>& buffer, const Vector<String>& blobURLs, const Vector<String> blobFilePaths, ArrayBufferContentsArray* sharedBuffers
+    CloneDeserializer(JSGlobalObject* lexicalGlobalObject, JSGlobalObject* globalObject, const Vector<RefPtr<MessagePort>>& messagePorts, ArrayBufferContentsArray* arrayBufferContents, const std::span<uint8_t>& buffer, const Vector<String>& blobURLs, const Vector<String> blobFilePaths, ArrayBufferContentsArray* sharedBuffers,
+        const Vector<String>* sharedStrings, ArrayBufferContentsArray* snapshotBuffers, bool adoptSnapshotBuffers
 #if ENABLE(WEBASSEMBLY)
         ,
         WasmModuleArray* wasmModules, WasmMemoryHandleArray* wasmMemoryHandles
@@ -2374,6 +2419,8 @@ private:
         , m_blobURLs(blobURLs)
         , m_blobFilePaths(blobFilePaths)
         , m_sharedBuffers(sharedBuffers)
+        , m_snapshotBuffers(snapshotBuffers)
+        , m_adoptSnapshotBuffers(adoptSnapshotBuffers)
 #if ENABLE(WEBASSEMBLY)
         , m_wasmModules(wasmModules)
         , m_wasmMemoryHandles(wasmMemoryHandles)
@@ -2381,6 +2428,11 @@ private:
     {
         if (!read(m_version))
             m_version = 0xFFFFFFFF;
+        if (sharedStrings) {
+            m_sharedStringPool.reserveInitialCapacity(sharedStrings->size());
+            for (auto& string : *sharedStrings)
+                m_sharedStringPool.append(string);
+        }
     }
 
     DeserializationResult deserialize();
@@ -2616,6 +2668,15 @@ private:
             cachedString = CachedStringRef(&m_constantPool, *index);
             return true;
         }
+        if (length == SharedStringTag) {
+            uint32_t index;
+            if (!read(index) || index >= m_sharedStringPool.size()) {
+                fail();
+                return false;
+            }
+            cachedString = CachedStringRef(&m_sharedStringPool, index);
+            return true;
+        }
         bool is8Bit = length & StringDataIs8BitFlag;
         length &= ~StringDataIs8BitFlag;
         String str;
@@ -2750,6 +2811,7 @@ private:
         case ResizableArrayBufferTag:
         case ArrayBufferTransferTag:
         case SharedArrayBufferTag:
+        case ArrayBufferSnapshotTag:
         case ObjectReferenceTag:
             break;
         default:
@@ -3845,6 +3907,31 @@ private:
 
             return getJSValue(m_arrayBuffers[index].get());
         }
+        case ArrayBufferSnapshotTag: {
+            uint32_t index;
+            if (!read(index) || !m_snapshotBuffers || index >= m_snapshotBuffers->size()) {
+                fail();
+                return JSValue();
+            }
+            auto& contents = m_snapshotBuffers->at(index);
+            // A value that is deserialized more than once (BroadcastChannel) has
+            // to leave its snapshot intact for the next receiver.
+            RefPtr<ArrayBuffer> arrayBuffer = m_adoptSnapshotBuffers
+                ? RefPtr { ArrayBuffer::create(WTF::move(contents)) }
+                : ArrayBuffer::tryCreate({ static_cast<const uint8_t*>(contents.data()), contents.sizeInBytes() });
+            if (!arrayBuffer) {
+                fail();
+                return JSValue();
+            }
+            Structure* structure = m_globalObject->arrayBufferStructure(arrayBuffer->sharingMode());
+            if (!structure) [[unlikely]] {
+                fail();
+                return JSValue();
+            }
+            JSValue result = JSArrayBuffer::create(m_lexicalGlobalObject->vm(), structure, WTF::move(arrayBuffer));
+            addToObjectPool(result);
+            return result;
+        }
         case SharedArrayBufferTag: {
             // https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserialize
             uint32_t index = UINT_MAX;
@@ -3924,6 +4011,9 @@ private:
     const uint8_t* const m_end;
     unsigned m_version;
     Vector<CachedString> m_constantPool;
+    // Strings the serializer handed over by reference (SharedStringTag). Kept
+    // apart from m_constantPool so StringPoolTag indices still line up.
+    Vector<CachedString> m_sharedStringPool;
     // Mirrors CloneSerializer's m_objectPool: ObjectReferenceTag indexes into this.
     // Only values the serializer passed to recordObject() may be appended here (via
     // addToObjectPool), in the same order, or every later back-reference is wrong.
@@ -3934,6 +4024,8 @@ private:
     Vector<String> m_blobURLs;
     Vector<String> m_blobFilePaths;
     ArrayBufferContentsArray* m_sharedBuffers;
+    ArrayBufferContentsArray* m_snapshotBuffers { nullptr };
+    bool m_adoptSnapshotBuffers { false };
 #if ENABLE(WEBASSEMBLY)
     WasmModuleArray* const m_wasmModules;
     WasmMemoryHandleArray* const m_wasmMemoryHandles;
@@ -4239,6 +4331,14 @@ size_t SerializedScriptValue::computeMemoryCost() const
             cost += content.sizeInBytes();
     }
 
+    if (m_snapshotBufferContentsArray) {
+        for (auto& content : *m_snapshotBufferContentsArray)
+            cost += content.sizeInBytes();
+    }
+
+    for (auto& string : m_sharedStrings)
+        cost += string.sizeInBytes();
+
 #if ENABLE(WEBASSEMBLY)
     // We are not supporting WebAssembly Module memory estimation yet.
     if (m_wasmMemoryHandlesArray) {
@@ -4728,12 +4828,14 @@ ExceptionOr<Ref<SerializedScriptValue>> SerializedScriptValue::create(JSGlobalOb
 #endif
     std::unique_ptr<ArrayBufferContentsArray> sharedBuffers = makeUnique<ArrayBufferContentsArray>();
     Vector<void*> serializedBlockListRefs;
+    Vector<String> sharedStrings;
+    std::unique_ptr<ArrayBufferContentsArray> snapshotBuffers = makeUnique<ArrayBufferContentsArray>();
     auto code = CloneSerializer::serialize(&lexicalGlobalObject, value, messagePorts, arrayBuffers,
 #if ENABLE(WEBASSEMBLY)
         wasmModules,
         wasmMemoryHandles,
 #endif
-        buffer, context, *sharedBuffers, serializedBlockListRefs, forStorage, forTransfer);
+        buffer, context, *sharedBuffers, serializedBlockListRefs, sharedStrings, *snapshotBuffers, forStorage, forTransfer);
 
     auto releaseSerializedBlockListRefs = [&] {
         for (auto* ptr : serializedBlockListRefs)
@@ -4769,6 +4871,12 @@ ExceptionOr<Ref<SerializedScriptValue>> SerializedScriptValue::create(JSGlobalOb
 #endif
         ));
     result->m_serializedBlockListRefs = WTF::move(serializedBlockListRefs);
+    if (!sharedStrings.isEmpty() || !snapshotBuffers->isEmpty()) {
+        result->m_sharedStrings = WTF::move(sharedStrings);
+        if (!snapshotBuffers->isEmpty())
+            result->m_snapshotBufferContentsArray = WTF::move(snapshotBuffers);
+        result->m_memoryCost = result->computeMemoryCost();
+    }
     return result;
 }
 
@@ -4841,7 +4949,7 @@ JSC::JSValue SerializedScriptValue::fromArrayBuffer(JSC::JSGlobalObject& domGlob
     auto size = std::min(arrayBuffer->byteLength(), maxByteLength);
     auto span = std::span<uint8_t> { data, size };
 
-    auto result = CloneDeserializer::deserialize(&domGlobal, globalObject, {}, nullptr, span, blobURLs, blobFiles, nullptr
+    auto result = CloneDeserializer::deserialize(&domGlobal, globalObject, {}, nullptr, span, blobURLs, blobFiles, nullptr, nullptr, nullptr, false
 #if ENABLE(WEBASSEMBLY)
         ,
         nullptr, nullptr
@@ -5080,7 +5188,8 @@ JSValue SerializedScriptValue::deserialize(JSGlobalObject& lexicalGlobalObject,
     }
 
     DeserializationResult result = CloneDeserializer::deserialize(&lexicalGlobalObject, globalObject, messagePorts,
-        m_arrayBufferContentsArray.get(), m_data, blobURLs, blobFilePaths, m_sharedBufferContentsArray.get()
+        m_arrayBufferContentsArray.get(), m_data, blobURLs, blobFilePaths, m_sharedBufferContentsArray.get(),
+        &m_sharedStrings, m_snapshotBufferContentsArray.get(), m_deserializeOnce
 #if ENABLE(WEBASSEMBLY)
                                                                                ,
         m_wasmModulesArray.get(), m_wasmMemoryHandlesArray.get()
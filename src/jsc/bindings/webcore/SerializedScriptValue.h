@@ -152,6 +152,12 @@ public:
 
     size_t memoryCost() const { return m_memoryCost; }
 
+    // Lets deserialize() adopt large ArrayBuffers snapshotted at serialize time
+    // instead of copying them again. Only for values deserialized exactly once,
+    // such as a posted message or structuredClone; BroadcastChannel hands one
+    // value to every receiver and must not call this.
+    void setDeserializeOnce() { m_deserializeOnce = true; }
+
     WEBCORE_EXPORT ~SerializedScriptValue();
 
 private:
@@ -179,6 +185,11 @@ private:
     Vector<unsigned char> m_data;
     std::unique_ptr<ArrayBufferContentsArray> m_arrayBufferContentsArray;
     std::unique_ptr<ArrayBufferContentsArray> m_sharedBufferContentsArray;
+    // Large strings and ArrayBuffer copies that bypass m_data when the value
+    // stays in this process (see MinZeroCopyCloneLength).
+    Vector<String> m_sharedStrings;
+    std::unique_ptr<ArrayBufferContentsArray> m_snapshotBufferContentsArray;
+    bool m_deserializeOnce { false };
     // Raw `*mut BlockList` pointers whose refcount was bumped at serialize
     // time so they outlive the wire buffer; released in the destructor.
     Vector<void*> m_serializedBlockListRefs;
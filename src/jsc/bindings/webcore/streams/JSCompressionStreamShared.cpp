@@ -257,10 +257,17 @@ static JSPromise* transformChunk(JSGlobalObject* globalObject, JSTransformStream
     ASSERT(coder);
 
     if (inputLen > kAsyncCodecThreshold) {
+        // An encoder splits the chunk into blocks the pool compresses in parallel; anything else
+        // (decoders, brotli, a single block) runs its steps off-thread one at a time.
+        bool parallel = !finish && CompressionStreamCoder__transformParallel(coder, globalObject, JSValue::encode(stream), JSValue::encode(chunk), input, inputLen);
+        RETURN_IF_EXCEPTION(scope, nullptr);
         auto* promise = JSPromise::create(vm, globalObject->promiseStructure());
         stream->m_codecPromise.set(vm, stream, promise);
         stream->m_codecChunkOffThread = true;
-        dispatchStepOffThread(globalObject, stream, coder, chunk, input, inputLen, finish);
+        if (parallel)
+            stream->m_asyncCodecInFlight = true;
+        else
+            dispatchStepOffThread(globalObject, stream, coder, chunk, input, inputLen, finish);
         scope.assertNoException();
         return promise;
     }
@@ -437,5 +444,49 @@ extern "C" void Bun__CompressionStream__deliverAsync(JSC::JSGlobalObject* global
     scope.assertNoException();
 }
 
+// JS-thread completion of one piece of a chunk compressed in parallel. The coder calls it in input
+// order, parking pieces that finish early, so this only has to hand each one to the consumer as it
+// comes; the pool holds the coder until the `last` piece, and that piece settles the chunk. The
+// pieces are computed already, so a full consumer doesn't stop them: the chunk's write stays
+// pending until all of them are delivered, which is what holds the producer back. After a failed
+// piece (or an abandon) the rest are dropped.
+extern "C" void Bun__CompressionStream__deliverPiece(JSC::JSGlobalObject* globalObject, JSC::EncodedJSValue streamCell, const uint8_t* out, size_t outLen, bool last, JSC::EncodedJSValue error)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_TOP_EXCEPTION_SCOPE(vm);
+    auto* stream = dynamicDowncast<JSTransformStream>(JSValue::decode(streamCell));
+    ASSERT(stream);
+    if (!stream) [[unlikely]]
+        return;
+    ASSERT(stream->m_asyncCodecInFlight);
+
+    CodecStepResult step;
+    JSValue thrown;
+    if (error) {
+        thrown = JSValue::decode(error);
+    } else if (outLen && stream->m_codecPromise) {
+        atStreamsBoundary(globalObject, [&] { step = deliverAsyncOutput(globalObject, stream, out, outLen, !last); }, [&](JSValue error) { thrown = error; });
+        if (scope.exception()) [[unlikely]] {
+            // VM termination, as in deliverAsync.
+            Bun__VM__takeTerminationOutsideScript(globalObject);
+            if (last)
+                stream->m_asyncCodecInFlight = false;
+            return;
+        }
+    }
+
+    if (last)
+        stream->m_asyncCodecInFlight = false;
+    if (!stream->m_codecPromise) {
+        nativeTransformReleaseStateIfIdle(stream);
+        return;
+    }
+    if (thrown)
+        settleCodecChunk(globalObject, stream, thrown);
+    else if (last)
+        settlePendingChunk(globalObject, stream, consumerFull(stream, step) && stream->m_nativeSinkPtr ? CodecOutcome::DoneSinkFull : CodecOutcome::Done);
+    scope.assertNoException();
+}
+
 } // namespace WebStreams
 } // namespace Bun
@@ -14,6 +14,10 @@ extern "C" JSC::EncodedJSValue CompressionStreamCoder__transform(void* coder, JS
 extern "C" JSC::EncodedJSValue CompressionStreamCoder__transformInto(void* coder, JSC::JSGlobalObject* global, const uint8_t* input, size_t input_len, bool finish, uint8_t sinkId, void* sinkPtr, bool* more);
 // Off-thread step, completed by Bun__CompressionStream__deliverAsync.
 extern "C" void CompressionStreamCoder__transformAsync(void* coder, JSC::JSGlobalObject* global, JSC::EncodedJSValue streamCell, JSC::EncodedJSValue chunk, const uint8_t* input, size_t inputLen, bool finish);
+// A large chunk for a deflate-format or zstd encoder, compressed as independent blocks on the
+// thread pool, each piece completed in order by Bun__CompressionStream__deliverPiece. Returns false
+// with nothing scheduled when the coder can't split it; may throw (and return true).
+extern "C" bool CompressionStreamCoder__transformParallel(void* coder, JSC::JSGlobalObject* global, JSC::EncodedJSValue streamCell, JSC::EncodedJSValue chunk, const uint8_t* input, size_t inputLen);
 
 namespace Bun {
 namespace WebStreams {
@@ -51,6 +51,20 @@ static RefPtr<JSC::ArrayBuffer> cloneArrayBuffer(JSC::VM& vm, JSC::JSGlobalObjec
     return cloned;
 }
 
+// TransferArrayBuffer(view.[[ViewedArrayBuffer]]) for enqueue() and BYOB read(). A pooled
+// Buffer's slab (see BunBufferPool.h) is pinned and shared with other Buffers, so it can't be
+// detached; such a view's bytes are copied out instead and `byteOffset` is rebased to 0.
+// null ⇒ exception pending.
+static RefPtr<JSC::ArrayBuffer> transferOrCopyViewedBuffer(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::ArrayBuffer& buffer, size_t& byteOffset, size_t byteLength)
+{
+    if (buffer.isShared() || buffer.isDetachable())
+        return transferArrayBufferImpl(globalObject, buffer);
+    RefPtr<JSC::ArrayBuffer> copied = cloneArrayBuffer(vm, globalObject, buffer, byteOffset, byteLength);
+    if (copied)
+        byteOffset = 0;
+    return copied;
+}
+
 // Construct(viewConstructor, « buffer, byteOffset, length »). `length` is an element count for
 // typed arrays and a byte length for %DataView% (elementSize(TypeDataView) == 1).
 static JSC::JSArrayBufferView* constructViewOfType(JSC::JSGlobalObject* globalObject, JSC::TypedArrayType type, RefPtr<JSC::ArrayBuffer> buffer, size_t byteOffset, size_t length)
@@ -710,7 +724,7 @@ void readableByteStreamControllerEnqueue(JSGlobalObject* globalObject, JSReadabl
         Bun::throwError(globalObject, scope, Bun::ErrorCode::ERR_INVALID_STATE_TypeError, "Invalid state: chunk ArrayBuffer is zero-length or detached"_s);
         return;
     }
-    RefPtr<JSC::ArrayBuffer> transferredBuffer = transferArrayBufferImpl(globalObject, *buffer);
+    RefPtr<JSC::ArrayBuffer> transferredBuffer = transferOrCopyViewedBuffer(vm, globalObject, *buffer, byteOffset, byteLength);
     RETURN_IF_EXCEPTION(scope, void());
     if (!controller->m_pendingPullIntos.isEmpty()) {
         JSPullIntoDescriptor* firstPendingPullInto = controller->m_pendingPullIntos.first().get();
@@ -995,7 +1009,7 @@ void readableByteStreamControllerPullInto(JSGlobalObject* globalObject, JSReadab
     size_t byteOffset = view->byteOffset();
     size_t byteLength = view->byteLength();
     RefPtr<JSC::ArrayBuffer> viewedBuffer = view->possiblySharedBuffer();
-    RefPtr<JSC::ArrayBuffer> buffer = transferArrayBufferImpl(globalObject, *viewedBuffer);
+    RefPtr<JSC::ArrayBuffer> buffer = transferOrCopyViewedBuffer(vm, globalObject, *viewedBuffer, byteOffset, byteLength);
     if (JSC::Exception* exception = scope.exception()) [[unlikely]] {
         // Spec step 10: "If bufferResult is an abrupt completion, perform readIntoRequest's error
         // steps given bufferResult.[[Value]] and return."
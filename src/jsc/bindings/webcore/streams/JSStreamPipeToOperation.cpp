@@ -10,9 +10,13 @@
 #include "JSDOMGlobalObject.h"
 #include "JSReadRequest.h"
 #include "JSReadableStream.h"
+#include "JSReadableStreamDefaultController.h"
 #include "JSReadableStreamDefaultReader.h"
 #include "JSStreamsRuntime.h"
+#include "JSTransformStream.h"
+#include "JSTransformStreamDefaultController.h"
 #include "JSWritableStream.h"
+#include "JSWritableStreamDefaultController.h"
 #include "JSWritableStreamDefaultWriter.h"
 #include "WebStreamsHeapAnalyzer.h"
 #include "WebStreamsInternals.h"
@@ -131,17 +135,23 @@ static void queuePipeReactionJob(JSC::VM& vm, JSGlobalObject* globalObject, JSFu
 }
 
 // Publish a write for the shutdown paths: m_currentWrite is the newest write, and every
-// write gets the settled reaction that re-checks the pipe's state.
+// write gets the settled reaction that re-checks the pipe's state. A native pipe only needs
+// the rejection kept out of unhandledRejection; the shutdown paths wait on m_currentWrite
+// themselves.
 static void publishPipeWrite(JSGlobalObject* globalObject, JSStreamPipeToOperation* op, JSPromise* writePromise)
 {
     auto& vm = getVM(globalObject);
     op->m_currentWrite.set(vm, op, writePromise);
+    if (op->m_nativePipe) {
+        markPromiseAsHandled(vm, writePromise);
+        return;
+    }
     auto* settledHandler = JSStreamsRuntime::from(globalObject)->onPipeWriteSettled();
     registerPipeReaction(globalObject, writePromise, settledHandler, settledHandler, op);
 }
 
 // One tick of the read/write loop: backpressure first, then at most one read.
-static void pipeToLoopStep(JSGlobalObject* globalObject, JSStreamPipeToOperation* op)
+static void pipeToLoopTick(JSGlobalObject* globalObject, JSStreamPipeToOperation* op)
 {
     auto& vm = getVM(globalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
@@ -163,6 +173,63 @@ static void pipeToLoopStep(JSGlobalObject* globalObject, JSStreamPipeToOperation
     RETURN_IF_EXCEPTION(scope, );
 }
 
+// A native pipe's read can complete synchronously (a source with bytes on hand fills it
+// inside the read), and its chunk steps continue the loop in place: run the nested ticks
+// here instead of recursing once per chunk.
+static void pipeToLoopStep(JSGlobalObject* globalObject, JSStreamPipeToOperation* op)
+{
+    if (!op->m_nativePipe)
+        return pipeToLoopTick(globalObject, op);
+    if (op->m_inNativeLoop) {
+        op->m_nativeLoopAgain = true;
+        return;
+    }
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    op->m_inNativeLoop = true;
+    do {
+        op->m_nativeLoopAgain = false;
+        pipeToLoopTick(globalObject, op);
+        if (scope.exception()) [[unlikely]] {
+            op->m_inNativeLoop = false;
+            return;
+        }
+    } while (op->m_nativeLoopAgain);
+    op->m_inNativeLoop = false;
+}
+
+// Whether neither end can run user JS for a chunk: the source is a Bun native source or the
+// readable half of a native transform, the destination is the writable half of a native
+// transform (Identity included), and neither side has a user size() strategy. Such a pipe
+// needs none of the generic loop's deferral: the deferred write only exists so a user
+// enqueue() cannot reenter the destination's write algorithm.
+static bool isNativePipe(const JSReadableStream* source, const JSWritableStream* destination)
+{
+    if (source->m_controllerKind != ControllerKind::Default)
+        return false;
+    const auto* sourceController = uncheckedDowncast<JSReadableStreamDefaultController>(source->m_controller.get());
+    if (!sourceController || sourceController->m_strategySizeAlgorithm)
+        return false;
+    auto isNativeTransform = [](JSCell* context) {
+        auto* transform = dynamicDowncast<JSTransformStream>(context);
+        return transform && transform->m_controller && transform->m_controller->m_transformerKind != TransformerKind::JavaScript;
+    };
+    switch (sourceController->m_algorithms.kind) {
+    case SourceKind::Native:
+        break;
+    case SourceKind::Transform:
+        if (!isNativeTransform(sourceController->m_algorithms.algorithmContext.get()))
+            return false;
+        break;
+    default:
+        return false;
+    }
+    const auto* destinationController = destination->m_controller.get();
+    if (!destinationController || destinationController->m_strategySizeAlgorithm)
+        return false;
+    return destinationController->m_algorithms.kind == SinkKind::Transform && isNativeTransform(destinationController->m_algorithms.algorithmContext.get());
+}
+
 // The pipe's signal abort algorithm: START both actions back-to-back, then wait for ALL of
 // them. The wait-for-all latch is `op->m_pendingShutdownActions`; the last settlement
 // proceeds, and the FIRST rejection finalizes with its reason (finalize is idempotent).
@@ -454,21 +521,13 @@ WEB_STREAMS_DEFINE_PIPE_REACTION_TRAMPOLINE(onPipeWritesFinishedForShutdown, onW
 #undef WEB_STREAMS_DEFINE_PIPE_REACTION_TRAMPOLINE
 #undef WEB_STREAMS_DEFINE_PIPE_REACTION_TRAMPOLINE_WITH_VALUE
 
-// The deferred sink write's body (onPipeChunkDeferredWrite below). After the head write, chunks
-// the source already has queued are written in place while the destination reports capacity: no
-// read request, no extra microtask per chunk. The dequeue and the write both run user JS, so
-// every guard is re-established around each of them.
-static void pipeChunkDeferredWrite(JSGlobalObject* globalObject, JSStreamPipeToOperation* op, JSPromise* trackingPromise, JSValue chunk)
+// After a write, chunks the source already has queued are written in place while the
+// destination reports capacity: no read request, no extra microtask per chunk. The dequeue and
+// the write both run user JS, so every guard is re-established around each of them.
+static void pipeWriteQueuedChunks(JSGlobalObject* globalObject, JSStreamPipeToOperation* op)
 {
     auto& vm = getVM(globalObject);
     auto scope = DECLARE_THROW_SCOPE(vm);
-    if (op->m_finalized)
-        RELEASE_AND_RETURN(scope, resolvePromise(globalObject, trackingPromise, jsUndefined()));
-    auto* writePromise = writableStreamDefaultWriterWrite(globalObject, op->m_writer.get(), chunk);
-    RETURN_IF_EXCEPTION(scope, );
-    writePromise->performPromiseThenWithContext(vm, globalObject, jsUndefined(), jsUndefined(), trackingPromise, jsUndefined());
-    RETURN_IF_EXCEPTION(scope, );
-
     while (!op->m_finalized && !op->m_shuttingDown) {
         auto* writer = op->m_writer.get();
         auto desiredSize = writableStreamDefaultWriterGetDesiredSize(writer);
@@ -494,6 +553,39 @@ static void pipeChunkDeferredWrite(JSGlobalObject* globalObject, JSStreamPipeToO
     }
 }
 
+// The deferred sink write's body (onPipeChunkDeferredWrite below): the head write, then
+// whatever the source already has queued.
+static void pipeChunkDeferredWrite(JSGlobalObject* globalObject, JSStreamPipeToOperation* op, JSPromise* trackingPromise, JSValue chunk)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    if (op->m_finalized)
+        RELEASE_AND_RETURN(scope, resolvePromise(globalObject, trackingPromise, jsUndefined()));
+    auto* writePromise = writableStreamDefaultWriterWrite(globalObject, op->m_writer.get(), chunk);
+    RETURN_IF_EXCEPTION(scope, );
+    writePromise->performPromiseThenWithContext(vm, globalObject, jsUndefined(), jsUndefined(), trackingPromise, jsUndefined());
+    RETURN_IF_EXCEPTION(scope, );
+    RELEASE_AND_RETURN(scope, pipeWriteQueuedChunks(globalObject, op));
+}
+
+// A native pipe's chunk steps: the write is not deferred and gets no reaction, and the loop
+// goes straight on to the next read unless the destination is full. The chunk still goes
+// through the writer, so it still costs a write() promise, and a read request when the
+// source had nothing queued.
+static void pipeNativeChunk(JSGlobalObject* globalObject, JSStreamPipeToOperation* op, JSValue chunk)
+{
+    auto& vm = getVM(globalObject);
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto* writePromise = writableStreamDefaultWriterWrite(globalObject, op->m_writer.get(), chunk);
+    RETURN_IF_EXCEPTION(scope, );
+    publishPipeWrite(globalObject, op, writePromise);
+    pipeWriteQueuedChunks(globalObject, op);
+    RETURN_IF_EXCEPTION(scope, );
+    if (op->m_finalized || op->m_shuttingDown)
+        return;
+    RELEASE_AND_RETURN(scope, pipeToLoopStep(globalObject, op));
+}
+
 // [reaction-convention] the deferred sink write, queued as a plain job (enterStreams).
 // argument(0) = the chunk; context = InternalFieldTuple{op, the promise published as
 // m_currentWrite}, which adopts the real write's settlement. The shutdown paths wait on that
@@ -567,6 +659,11 @@ namespace WebStreams {
 
 using namespace JSC;
 
+bool isNativePipe(const JSReadableStream* source, const JSWritableStream* destination)
+{
+    return WebCore::isNativePipe(source, destination);
+}
+
 void startPipeToOperation(JSGlobalObject* globalObject, JSStreamPipeToOperation* op)
 {
     auto& vm = getVM(globalObject);
@@ -602,6 +699,7 @@ void startPipeToOperation(JSGlobalObject* globalObject, JSStreamPipeToOperation*
     RETURN_IF_EXCEPTION(scope, );
     op->checkClosingMustBePropagatedBackward(globalObject);
     RETURN_IF_EXCEPTION(scope, );
+    op->m_nativePipe = WebCore::isNativePipe(op->m_source.get(), op->m_destination.get());
     RELEASE_AND_RETURN(scope, WebCore::pipeToLoopStep(globalObject, op));
 }
 
@@ -614,6 +712,8 @@ void pipeToReadRequestChunkSteps(JSGlobalObject* globalObject, JSStreamPipeToOpe
     op->m_readInFlight = false;
     if (op->m_finalized)
         return;
+    if (op->m_nativePipe)
+        RELEASE_AND_RETURN(scope, WebCore::pipeNativeChunk(globalObject, op, chunk));
     auto* writer = op->m_writer.get();
     auto* runtime = JSStreamsRuntime::from(globalObject);
     // The sink write is deferred by one microtask so an enqueue() inside the source never
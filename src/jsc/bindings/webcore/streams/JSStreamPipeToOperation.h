@@ -144,6 +144,13 @@ public:
     bool m_preventClose : 1 { false };
     bool m_preventAbort : 1 { false };
     bool m_preventCancel : 1 { false };
+    // Both ends are native (isNativePipe): chunks are written as they are read, with no
+    // deferred-write job and no per-write reaction, and the loop continues in place while
+    // the destination has capacity. m_inNativeLoop / m_nativeLoopAgain trampoline the
+    // synchronous read → write → read recursion of a source that fills reads immediately.
+    bool m_nativePipe : 1 { false };
+    bool m_inNativeLoop : 1 { false };
+    bool m_nativeLoopAgain : 1 { false };
 
 private:
     JSStreamPipeToOperation(JSC::VM&, JSC::Structure*);
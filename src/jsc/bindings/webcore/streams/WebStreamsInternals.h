@@ -604,6 +604,8 @@ void startPipeToOperation(JSC::JSGlobalObject*, JSStreamPipeToOperation*); // us
 void pipeToReadRequestChunkSteps(JSC::JSGlobalObject*, JSStreamPipeToOperation*, JSC::JSValue chunk); // userJS: yes — JSStreamPipeToOperation.cpp
 void pipeToReadRequestCloseSteps(JSC::JSGlobalObject*, JSStreamPipeToOperation*); // userJS: yes — JSStreamPipeToOperation.cpp
 void pipeToReadRequestErrorSteps(JSC::JSGlobalObject*, JSStreamPipeToOperation*, JSC::JSValue error); // userJS: yes — JSStreamPipeToOperation.cpp
+// Whether a pipe between these ends takes the native path (neither end runs user JS).
+bool isNativePipe(const JSReadableStream*, const JSWritableStream*); // userJS: no — JSStreamPipeToOperation.cpp
 
 // JSReadableStreamAsyncIterator.cpp — its methods are on the cell; nothing is cross-file.
 
@@ -1431,6 +1431,22 @@ pub fn get_active_tasks(global_object: &JSGlobalObject, _frame: &CallFrame) -> J
     Ok(result)
 }
 
+/// Testing API to expose the HTTP server's cork pool counters
+#[bun_jsc::host_fn]
+pub fn get_cork_stats(global_object: &JSGlobalObject, _frame: &CallFrame) -> JsResult<JSValue> {
+    let event_loop = global_object.bun_vm().event_loop_shared();
+    // SAFETY: usockets_loop() returns the live process-global loop.
+    let stats = unsafe { (*event_loop.usockets_loop()).cork_stats() };
+    let result = JSValue::create_empty_object(global_object, 6);
+    result.put(global_object, b"evictions", JSValue::js_number(stats.evictions as f64));
+    result.put(global_object, b"flushes", JSValue::js_number(stats.flushes as f64));
+    result.put(global_object, b"flushedBytes", JSValue::js_number(stats.flushed_bytes as f64));
+    result.put(global_object, b"slabFlushes", JSValue::js_number(stats.slab_flushes as f64));
+    result.put(global_object, b"slots", JSValue::js_number(stats.slots as f64));
+    result.put(global_object, b"peakSlots", JSValue::js_number(stats.peak_slots as f64));
+    Ok(result)
+}
+
 #[cfg(windows)]
 extern "C" fn noop_forever_timer(_: *mut uws::Timer) {
     // do nothing
@@ -1,15 +1,33 @@
 //! `Bun.JSONC` — `parse()` host function.
+//!
+//! `parse(text, { lazy: true })` keeps the parsed rows, and builds each object's
+//! properties only when the object is first read (`JSONRowsToJS.cpp`). The rows
+//! point into an arena and a copy of the source that belong to the result, so
+//! they are parsed outside the recycled per-thread arena.
+
+use core::ffi::c_void;
 
 use bun_js_parser_jsc::ExprJsc;
 use bun_jsc::{CallFrame, JSGlobalObject, JSValue, JsError, JsResult};
 use bun_parsers::json;
 
 pub(crate) fn create(global: &JSGlobalObject) -> JSValue {
-    bun_jsc::create_host_function_object(global, &[("parse", __jsc_host_parse, 1)])
+    bun_jsc::create_host_function_object(global, &[("parse", __jsc_host_parse, 2)])
 }
 
 #[bun_jsc::host_fn]
 pub(crate) fn parse(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSValue> {
+    let options = frame.argument(1);
+    let lazy = if options.is_undefined_or_null() {
+        false
+    } else if options.is_object() && !options.is_callable() {
+        options.get_boolean_strict(global, "lazy")?.unwrap_or(false)
+    } else {
+        return Err(
+            global.throw_invalid_arguments(format_args!("JSONC.parse options must be an object"))
+        );
+    };
+
     super::with_text_format_source(
         global,
         frame,
@@ -25,34 +43,11 @@ pub(crate) fn parse(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSVa
                     ))),
                 );
             }
-            let parsed = match json::ParsedJson::parse_jsonc(source, log) {
-                Ok(v) => v,
-                Err(bun_parsers::Error::StackOverflow) => {
-                    return Err(global.throw_stack_overflow());
-                }
-                Err(bun_parsers::Error::Alloc(_)) => {
-                    return Err(JsError::OutOfMemory);
-                }
-                Err(_) => {
-                    // Skip duplicate-key warnings so the message names the fatal error.
-                    let first_msg = log
-                        .msgs
-                        .iter()
-                        .find(|m| m.kind == bun_ast::Kind::Err)
-                        .or_else(|| log.msgs.first());
-                    if let Some(first_msg) = first_msg {
-                        return Err(global.throw_value(global.create_syntax_error_instance(
-                            format_args!(
-                                "JSONC Parse error: {}",
-                                bstr::BStr::new(&first_msg.data.text),
-                            ),
-                        )));
-                    }
-                    return Err(global.throw_value(global.create_syntax_error_instance(
-                        format_args!("JSONC Parse error: Unable to parse JSONC string"),
-                    )));
-                }
-            };
+            if lazy {
+                return parse_lazy(global, log, source);
+            }
+            let parsed = json::ParsedJson::parse_jsonc(source, log)
+                .map_err(|err| throw_parse_error(global, log, err))?;
 
             parsed
                 .root
@@ -61,3 +56,78 @@ pub(crate) fn parse(global: &JSGlobalObject, frame: &CallFrame) -> JsResult<JSVa
         },
     )
 }
+
+fn throw_parse_error(
+    global: &JSGlobalObject,
+    log: &bun_ast::Log,
+    err: bun_parsers::Error,
+) -> JsError {
+    match err {
+        bun_parsers::Error::StackOverflow => global.throw_stack_overflow(),
+        bun_parsers::Error::Alloc(_) => JsError::OutOfMemory,
+        _ => {
+            // Skip duplicate-key warnings so the message names the fatal error.
+            let first_msg = log
+                .msgs
+                .iter()
+                .find(|m| m.kind == bun_ast::Kind::Err)
+                .or_else(|| log.msgs.first());
+            if let Some(first_msg) = first_msg {
+                return global.throw_value(global.create_syntax_error_instance(format_args!(
+                    "JSONC Parse error: {}",
+                    bstr::BStr::new(&first_msg.data.text),
+                )));
+            }
+            global.throw_value(global.create_syntax_error_instance(format_args!(
+                "JSONC Parse error: Unable to parse JSONC string"
+            )))
+        }
+    }
+}
+
+/// Everything the rows of a lazy result point into. Dropped by
+/// [`release_lazy_document`] once the last lazy object is collected.
+struct LazyDocument {
+    parsed: json::ParsedJson,
+    /// Holds the `ObjectJSON` / `ArrayJSON` nodes.
+    arena: bun_alloc::Arena,
+    /// Tape strings without escapes borrow from it.
+    source: bun_ast::Source,
+}
+
+unsafe extern "C" fn release_lazy_document(owner: *mut c_void) {
+    // SAFETY: `owner` is the `Box::into_raw` from `parse_lazy`, released once.
+    drop(unsafe { Box::from_raw(owner.cast::<LazyDocument>()) });
+}
+
+fn parse_lazy(
+    global: &JSGlobalObject,
+    log: &mut bun_ast::Log,
+    input: &bun_ast::Source,
+) -> JsResult<JSValue> {
+    let source = bun_ast::Source::init_path_string_owned(b"input.jsonc", input.contents.to_vec());
+    let arena = bun_alloc::Arena::new();
+    let parsed = {
+        let mut ast_memory_allocator = bun_ast::ASTMemoryAllocator::borrowing(&arena);
+        let _ast_scope = ast_memory_allocator.enter();
+        json::ParsedJson::parse_jsonc(&source, log)
+    }
+    .map_err(|err| throw_parse_error(global, log, err))?;
+
+    let cost = source.contents.len() * 2;
+    let document = Box::new(LazyDocument {
+        parsed,
+        arena,
+        source,
+    });
+    // The boxed fields don't move from here on, so the rows stay where the
+    // parser put them.
+    let root: *const bun_ast::Expr = &document.parsed.root;
+    let owner = Box::into_raw(document).cast::<c_void>();
+    // SAFETY: `owner` keeps `root` and everything it points at alive, and is
+    // freed only through `release_lazy_document`.
+    unsafe {
+        bun_js_parser_jsc::expr_to_lazy_js(&*root, global, owner, release_lazy_document, cost)
+    }
+    .map_err(|e| bun_js_parser_jsc::to_js_error(e, global))
+}
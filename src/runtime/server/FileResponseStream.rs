@@ -178,7 +178,10 @@ impl FileResponseStream {
         if use_sendfile {
             this_ref.sendfile.set(Sendfile {
                 #[cfg(any(target_os = "linux", target_os = "android"))]
-                socket_fd: opts.resp.get_native_handle(),
+                socket_fd: opts
+                    .resp
+                    .kernel_tls_fd()
+                    .unwrap_or_else(|| opts.resp.get_native_handle()),
                 offset: opts.offset,
                 remain: opts.length.expect("can_sendfile gates None"),
                 #[cfg(any(target_os = "linux", target_os = "android"))]
@@ -620,8 +623,9 @@ fn can_sendfile(resp: AnyResponse, file_type: FileType, length: Option<u64>) ->
     #[cfg(any(target_os = "linux", target_os = "android"))]
     {
         // sendfile() needs a real socket fd; SSL writes go through BIO and H3
-        // through lsquic stream frames — neither has one.
-        if !matches!(resp, AnyResponse::TCP(_)) {
+        // through lsquic stream frames — neither has one, unless the kernel
+        // seals this TLS connection's records (`kernelTLS`).
+        if !matches!(resp, AnyResponse::TCP(_)) && resp.kernel_tls_fd().is_none() {
             return false;
         }
         if file_type != FileType::File {
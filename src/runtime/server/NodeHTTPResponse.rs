@@ -65,7 +65,8 @@ pub struct NodeHTTPResponse {
     /// [u32 nameLen][u32 valueLen][name][value]... so req.rawHeaders /
     /// req.headers materialize lazily (takeRawHeaders) instead of paying
     /// 2N JSStrings + a JSArray on every request. One-shot: emptied on first
-    /// access.
+    /// access. A slab from [`RAW_HEADER_SLABS`], returned there when taken or
+    /// when the response is freed.
     pub(crate) raw_request_headers: JsCell<Vec<u8>>,
     pub(crate) bytes_written: Cell<usize>,
 
@@ -2430,7 +2431,10 @@ impl NodeHTTPResponse {
         if section.is_empty() {
             return JSValue::UNDEFINED;
         }
-        Bun__NodeHTTP__buildRawHeadersArray(global_object, section.as_ptr(), section.len())
+        let headers =
+            Bun__NodeHTTP__buildRawHeadersArray(global_object, section.as_ptr(), section.len());
+        recycle_raw_header_slab(section);
+        headers
     }
 
     /// `handle.takeRequestTrailers()` — this request's captured trailer section
@@ -2570,6 +2574,7 @@ impl NodeHTTPResponse {
 
         self.buffered_request_body_data_during_pause
             .with_mut(|b| b.clear_and_free());
+        recycle_raw_header_slab(self.raw_request_headers.replace(Vec::new()));
         self.poll_ref.with_mut(|r| r.unref(vm_get()));
         self.body_read_ref.with_mut(|r| r.unref(vm_get()));
 
@@ -2632,24 +2637,52 @@ impl bun_ptr::AnyRefCounted for NodeHTTPResponse {
     }
 }
 
+// Buffers for the captured request header sections. A server busy with
+// requests whose handlers never read the headers then allocates nothing for
+// them: each dispatch copies the section into a slab a finished response
+// gave back. `#[thread_local]` so there is no destructor at thread exit (as
+// for the parser arena in `api.rs`); parked slabs are reclaimed with the
+// thread.
+#[thread_local]
+static RAW_HEADER_SLABS: core::cell::RefCell<Vec<Vec<u8>>> = core::cell::RefCell::new(Vec::new());
+const RAW_HEADER_SLABS_MAX: usize = 64;
+/// Larger sections (a big cookie jar, a raised maxHeaderSize) are freed
+/// rather than parked.
+const RAW_HEADER_SLAB_MAX_CAPACITY: usize = 16 * 1024;
+
+fn recycle_raw_header_slab(mut slab: Vec<u8>) {
+    if slab.capacity() == 0 || slab.capacity() > RAW_HEADER_SLAB_MAX_CAPACITY {
+        return;
+    }
+    let mut slabs = RAW_HEADER_SLABS.borrow_mut();
+    if slabs.len() < RAW_HEADER_SLABS_MAX {
+        slab.clear();
+        slabs.push(slab);
+    }
+}
+
+/// Hands C++ `length` bytes of this request's `raw_request_headers` to fill
+/// with the captured header section.
+///
 /// # Safety
 /// `response` is the pointer written to `node_response_ptr` by
-/// `NodeHTTPResponse__createForJS` earlier in the same dispatch and is live;
-/// `data`/`length` describe a caller-owned buffer valid for the call.
+/// `NodeHTTPResponse__createForJS` earlier in the same dispatch and is live.
+/// The caller writes all `length` bytes before returning to JS.
 #[unsafe(no_mangle)]
-pub(crate) unsafe extern "C" fn NodeHTTPResponse__adoptRawRequestHeaders(
+pub(crate) unsafe extern "C" fn NodeHTTPResponse__reserveRawRequestHeaders(
     response: *mut NodeHTTPResponse,
-    data: *const u8,
     length: usize,
-) {
+) -> *mut u8 {
     // SAFETY: see the function-level contract above.
     let response = unsafe { &*response };
-    // SAFETY: `data`/`length` describe a caller-owned buffer valid for the
-    // call (function-level contract above).
-    let bytes = unsafe { core::slice::from_raw_parts(data, length) };
-    response
-        .raw_request_headers
-        .with_mut(|v| v.append_slice(bytes));
+    let mut slab = RAW_HEADER_SLABS.borrow_mut().pop().unwrap_or_default();
+    slab.reserve_exact(length);
+    // SAFETY: capacity is at least `length`; the caller initializes every
+    // byte before anything reads them (function-level contract above).
+    unsafe { slab.set_len(length) };
+    let data = slab.as_mut_ptr();
+    recycle_raw_header_slab(response.raw_request_headers.replace(slab));
+    data
 }
 
 /// # Safety
@@ -58,9 +58,13 @@ pub struct ServerConfig {
     pub(crate) websocket: Option<WebSocketServerContext>,
 
     pub(crate) reuse_port: bool,
+    /// `reusePort: "cpu"` — also steer connections to the listener matching the receiving CPU.
+    pub(crate) reuse_port_cpu: bool,
     pub(crate) id: Box<[u8]>,
     pub(crate) allow_hot: bool,
     pub(crate) ipv6_only: bool,
+    /// `kernelTLS` — hand TLS 1.2 record sealing to the kernel after the handshake.
+    pub(crate) kernel_tls: bool,
     pub(crate) http3: bool,
     pub(crate) http1: bool,
 
@@ -92,9 +96,11 @@ impl Default for ServerConfig {
             is_node_http_server: false,
             websocket: None,
             reuse_port: false,
+            reuse_port_cpu: false,
             id: Box::default(),
             allow_hot: true,
             ipv6_only: false,
+            kernel_tls: false,
             http3: false,
             http1: true,
             had_routes_object: false,
@@ -290,9 +296,11 @@ impl ServerConfig {
             is_node_http_server: self.is_node_http_server,
             websocket: self.websocket.take(),
             reuse_port: self.reuse_port,
+            reuse_port_cpu: self.reuse_port_cpu,
             id: core::mem::take(&mut self.id),
             allow_hot: self.allow_hot,
             ipv6_only: self.ipv6_only,
+            kernel_tls: self.kernel_tls,
             http3: self.http3,
             http1: self.http1,
             had_routes_object: self.had_routes_object,
@@ -628,10 +636,18 @@ impl ServerConfig {
             bun_uws_sys::LIBUS_LISTEN_EXCLUSIVE_PORT
         };
 
+        if self.reuse_port && self.reuse_port_cpu {
+            out |= bun_uws_sys::LIBUS_LISTEN_REUSE_PORT_CPU;
+        }
+
         if self.ipv6_only {
             out |= bun_uws_sys::LIBUS_SOCKET_IPV6_ONLY;
         }
 
+        if self.kernel_tls {
+            out |= bun_uws_sys::LIBUS_LISTEN_KERNEL_TLS;
+        }
+
         out
     }
 }
@@ -1312,7 +1328,14 @@ impl ServerConfig {
         }
 
         if let Some(dev) = arg.get(global, "reusePort")? {
-            args.reuse_port = dev.to_boolean();
+            // "cpu": one listener per Worker thread, each on its own event loop.
+            // Any other value, strings included, keeps the truthy coercion.
+            if dev.is_string() && dev.to_slice(global)?.slice() == b"cpu" {
+                args.reuse_port = true;
+                args.reuse_port_cpu = true;
+            } else {
+                args.reuse_port = dev.to_boolean();
+            }
         }
         if global.has_exception() {
             return Err(JsError::Thrown);
@@ -1325,6 +1348,13 @@ impl ServerConfig {
             return Err(JsError::Thrown);
         }
 
+        if let Some(dev) = arg.get(global, "kernelTLS")? {
+            args.kernel_tls = dev.to_boolean();
+        }
+        if global.has_exception() {
+            return Err(JsError::Thrown);
+        }
+
         if let Some(v) = arg.get(global, "http3")? {
             args.http3 = v.to_boolean();
         }
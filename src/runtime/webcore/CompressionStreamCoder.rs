@@ -15,9 +15,17 @@
 //! (`JSCompressionStreamShared.cpp`) delivers each step's output and steps
 //! again once the consumer has room; in between, the coder keeps the chunk's
 //! unconsumed input ([`Pending`]).
+//!
+//! A large chunk for an encoder that can be split (deflate formats, zstd) is
+//! instead compressed as independent blocks in parallel on the work pool, like
+//! pigz / multi-frame zstd ([`CompressionStreamCoder__transformParallel`]);
+//! the C++ arm delivers the blocks in input order.
 
-use core::ffi::c_int;
+use core::cell::RefCell;
+use core::ffi::{c_int, c_uint};
 use core::ptr::{self, NonNull};
+use std::rc::Rc;
+use std::sync::Arc;
 
 use bun_jsc::ZigStringJsc as _;
 use bun_jsc::zig_string::ZigString as JscZigString;
@@ -58,6 +66,16 @@ impl Format {
             Self::Brotli | Self::Zstd => unreachable!(),
         }
     }
+
+    /// Continues the wrapper's check over `bytes`: CRC-32 for gzip, Adler-32
+    /// for deflate (zlib); deflate-raw has none.
+    fn update_check(self, check: u32, bytes: &[u8]) -> u32 {
+        match self {
+            Self::Gzip => zlib::crc32_bytes(check, bytes),
+            Self::Deflate => zlib::adler32_bytes(check, bytes),
+            _ => check,
+        }
+    }
 }
 
 /// Growth granularity of a step's output buffer.
@@ -74,6 +92,120 @@ fn spare(out: &mut Vec<u8>, cap: usize) -> Result<&mut [core::mem::MaybeUninit<u
     Ok(&mut spare[..len])
 }
 
+/// A deflate stream at the spec's "default compression level"
+/// (Z_DEFAULT_COMPRESSION = -1); `window_bits` picks the wrapper.
+fn deflate_init(window_bits: c_int) -> Result<Box<zlib::z_stream>, CodecError> {
+    let mut s = Box::new(bun_core::ffi::zeroed::<zlib::z_stream>());
+    // SAFETY: `s` is a zeroed, #[repr(C)] z_stream; zlibVersion() is a static
+    // C string.
+    let rc = unsafe {
+        zlib::deflateInit2_(
+            &raw mut *s,
+            -1,
+            8, // Z_DEFLATED
+            window_bits,
+            8, // default mem_level
+            0, // Z_DEFAULT_STRATEGY
+            zlib::zlibVersion().cast(),
+            core::mem::size_of::<zlib::z_stream>() as c_int,
+        )
+    };
+    if rc != zlib::ReturnCode::Ok {
+        return Err(CodecError::Message("failed to initialize deflate"));
+    }
+    Ok(s)
+}
+
+/// Drives deflate over `input`, ending it with `last` (`NoFlush` to keep
+/// going, `SyncFlush` for a byte boundary, `Finish`), until that is done or
+/// `out` holds `cap` bytes. `consumed` sees the input in the order deflate
+/// takes it.
+fn deflate_run(
+    s: &mut zlib::z_stream,
+    input: &[u8],
+    last: zlib::FlushValue,
+    cap: usize,
+    out: &mut Vec<u8>,
+    mut consumed: impl FnMut(&[u8]),
+) -> Result<Progress, CodecError> {
+    // `avail_in` is `uInt`; clamp and refill so a ≥4 GiB chunk isn't silently
+    // truncated by the `as u32` cast.
+    let mut remaining = input;
+    loop {
+        if out.len() >= cap {
+            return Ok(Progress::More {
+                consumed: input.len() - remaining.len(),
+            });
+        }
+        let take = remaining.len().min(u32::MAX as usize);
+        let tail = remaining.len() > take;
+        let flush = if tail {
+            zlib::FlushValue::NoFlush
+        } else {
+            last
+        };
+        s.next_in = remaining.as_ptr();
+        s.avail_in = take as u32;
+        let spare = spare(out, cap)?;
+        s.next_out = spare.as_mut_ptr().cast();
+        s.avail_out = spare.len().min(u32::MAX as usize) as u32;
+        let before = s.avail_out;
+        // SAFETY: `s` was initialized by `deflateInit2_`; next_in/avail_in
+        // borrow `remaining`, next_out/avail_out borrow the Vec's spare
+        // capacity for this one call.
+        let rc = unsafe { zlib::deflate(&raw mut *s, flush) };
+        let written = (before - s.avail_out) as usize;
+        // SAFETY: deflate wrote exactly `written` bytes.
+        unsafe { out.set_len(out.len() + written) };
+        let used = take - s.avail_in as usize;
+        consumed(&remaining[..used]);
+        remaining = &remaining[used..];
+        match rc {
+            zlib::ReturnCode::Ok | zlib::ReturnCode::BufError => {}
+            zlib::ReturnCode::StreamEnd => return Ok(Progress::Done),
+            zlib::ReturnCode::MemError => return Err(CodecError::OutOfMemory),
+            _ => return Err(CodecError::Message("deflate failed")),
+        }
+        if s.avail_out != 0 && remaining.is_empty() {
+            return Ok(Progress::Done);
+        }
+    }
+}
+
+/// Feeds all of `input` to `cctx` and ends its frame (ZSTD_e_end).
+fn zstd_end_frame(
+    cctx: NonNull<zstd::ZSTD_CCtx>,
+    input: &[u8],
+    out: &mut Vec<u8>,
+) -> Result<(), CodecError> {
+    let mut input_buf = zstd::ZSTD_inBuffer {
+        src: input.as_ptr().cast(),
+        size: input.len(),
+        pos: 0,
+    };
+    loop {
+        let spare = spare(out, usize::MAX)?;
+        let mut output_buf = zstd::ZSTD_outBuffer {
+            dst: spare.as_mut_ptr().cast(),
+            size: spare.len(),
+            pos: 0,
+        };
+        // SAFETY: `cctx` is a live CCtx; the buffers borrow `input` / spare
+        // for this one call. 2 = ZSTD_e_end.
+        let remaining = unsafe {
+            zstd::ZSTD_compressStream2(cctx.as_ptr(), &raw mut output_buf, &raw mut input_buf, 2)
+        };
+        // SAFETY: compressStream2 wrote exactly `output_buf.pos` bytes.
+        unsafe { out.set_len(out.len() + output_buf.pos) };
+        if zstd::ZSTD_isError(remaining) != 0 {
+            return Err(zstd_error(remaining, "zstd encode failed"));
+        }
+        if remaining == 0 {
+            return Ok(());
+        }
+    }
+}
+
 /// `CodecError` for a `ZSTD_isError` return value.
 fn zstd_error(rc: usize, message: &'static str) -> CodecError {
     if zstd::ZSTD_getErrorCode(rc) == zstd::ZSTD_error_memory_allocation {
@@ -102,7 +234,12 @@ enum Progress {
 }
 
 enum Backend {
-    Deflate(Box<zlib::z_stream>),
+    Deflate {
+        state: Box<zlib::z_stream>,
+        format: Format,
+    },
+    /// A deflate stream after its first parallel chunk; see [`Spliced`].
+    DeflateSpliced(Box<Spliced>),
     Inflate {
         state: Box<zlib::z_stream>,
         /// Gzip only: after the first member ends, any further bytes must be
@@ -117,6 +254,72 @@ enum Backend {
     ZstdDecode(NonNull<zstd::ZSTD_DStream>),
 }
 
+/// A deflate / deflate-raw / gzip encoder once part of its output came from
+/// blocks compressed on the pool. zlib can't splice foreign blocks into a
+/// wrapped stream, so from then on the serial steps run a raw stream and the
+/// coder writes the wrapper's trailer itself.
+struct Spliced {
+    stream: Box<zlib::z_stream>,
+    format: Format,
+    /// [`Format::update_check`] of all input so far.
+    check: u32,
+    /// Input length so far, mod 2^32 (gzip's ISIZE).
+    total: u32,
+    /// The raw stream has taken input since it was last flushed to a byte
+    /// boundary.
+    dirty: bool,
+    /// The last [`WINDOW`] bytes of input, if they came from a parallel chunk:
+    /// the first block of the next one is primed with them. Serial input
+    /// clears it.
+    tail: Vec<u8>,
+}
+
+impl Spliced {
+    /// Starts the raw stream over after a parallel chunk, with the end of that
+    /// chunk as its history, so the next serial step continues after it.
+    fn restart(&mut self, window: &[u8]) -> Result<(), CodecError> {
+        // SAFETY: `stream` is an initialized raw deflate stream; resetting it
+        // puts it where a dictionary may be set.
+        let ok = unsafe {
+            zlib::deflateReset(&raw mut *self.stream) == zlib::ReturnCode::Ok
+                && zlib::deflateSetDictionary(
+                    &raw mut *self.stream,
+                    window.as_ptr(),
+                    window.len() as c_uint,
+                ) == zlib::ReturnCode::Ok
+        };
+        if !ok {
+            return Err(CodecError::Message("deflate failed"));
+        }
+        Ok(())
+    }
+
+    /// Appends the wrapper's trailer once the raw stream has ended.
+    fn write_trailer(&self, out: &mut Vec<u8>) -> Result<(), CodecError> {
+        out.try_reserve(8).map_err(|_| CodecError::OutOfMemory)?;
+        match self.format {
+            Format::Gzip => {
+                out.extend_from_slice(&self.check.to_le_bytes());
+                out.extend_from_slice(&self.total.to_le_bytes());
+            }
+            Format::Deflate => out.extend_from_slice(&self.check.to_be_bytes()),
+            _ => {}
+        }
+        Ok(())
+    }
+}
+
+/// Zstd encode only: where the CCtx is relative to a frame.
+#[derive(Clone, Copy, PartialEq, Eq)]
+enum ZstdFrame {
+    /// Nothing has been written.
+    Empty,
+    /// Input went into a frame that has not been ended.
+    Open,
+    /// A parallel chunk ended the last frame, so the stream is complete as is.
+    Closed,
+}
+
 #[derive(bun_ptr::ThreadSafeRefCounted)]
 pub struct CompressionStreamCoder {
     backend: Backend,
@@ -135,6 +338,7 @@ pub struct CompressionStreamCoder {
     /// ends with <4 bytes after frame-complete we cannot tell which yet.
     zstd_head: [u8; 4],
     zstd_head_len: u8,
+    zstd_frame: ZstdFrame,
     /// The stream's `highWaterMark`: output bound of one step. A chunk larger
     /// than this may produce up to its own size per step (the bound is on
     /// expansion), so a big chunk still finishes in a step or two.
@@ -155,8 +359,11 @@ impl Drop for CompressionStreamCoder {
         // here).
         unsafe {
             match &mut self.backend {
-                Backend::Deflate(s) => {
-                    zlib::deflateEnd(&raw mut **s);
+                Backend::Deflate { state, .. } => {
+                    zlib::deflateEnd(&raw mut **state);
+                }
+                Backend::DeflateSpliced(sp) => {
+                    zlib::deflateEnd(&raw mut *sp.stream);
                 }
                 Backend::Inflate { state, .. } => {
                     zlib::inflateEnd(&raw mut **state);
@@ -192,31 +399,13 @@ impl CompressionStreamCoder {
         high_water_mark: usize,
     ) -> Result<Box<Self>, CodecError> {
         let backend = match (format, decompress) {
-            (Format::Deflate | Format::DeflateRaw | Format::Gzip, false) => {
-                let mut s = Box::new(bun_core::ffi::zeroed::<zlib::z_stream>());
-                // Spec: "default compression level". Z_DEFAULT_COMPRESSION = -1.
-                // SAFETY: `s` is a zeroed, #[repr(C)] z_stream; zlibVersion() is
-                // a static C string.
-                let rc = unsafe {
-                    zlib::deflateInit2_(
-                        &raw mut *s,
-                        -1,
-                        8, // Z_DEFLATED
-                        format.window_bits(),
-                        8, // default mem_level
-                        0, // Z_DEFAULT_STRATEGY
-                        zlib::zlibVersion().cast(),
-                        core::mem::size_of::<zlib::z_stream>() as c_int,
-                    )
-                };
-                if rc != zlib::ReturnCode::Ok {
-                    return Err(CodecError::Message("failed to initialize deflate"));
-                }
-                Backend::Deflate(s)
-            }
+            (Format::Deflate | Format::DeflateRaw | Format::Gzip, false) => Backend::Deflate {
+                state: deflate_init(format.window_bits())?,
+                format,
+            },
             (Format::Deflate | Format::DeflateRaw | Format::Gzip, true) => {
                 let mut s = Box::new(bun_core::ffi::zeroed::<zlib::z_stream>());
-                // SAFETY: as above.
+                // SAFETY: as in `deflate_init`.
                 let rc = unsafe {
                     zlib::inflateInit2_(
                         &raw mut *s,
@@ -266,6 +455,7 @@ impl CompressionStreamCoder {
             ended: false,
             zstd_head: [0; 4],
             zstd_head_len: 0,
+            zstd_frame: ZstdFrame::Empty,
             high_water_mark,
             pending: None,
         }))
@@ -344,48 +534,41 @@ impl CompressionStreamCoder {
         out: &mut Vec<u8>,
     ) -> Result<Progress, CodecError> {
         match &mut self.backend {
-            Backend::Deflate(s) => {
-                // `avail_in` is `uInt`; clamp and refill so a ≥4 GiB chunk
-                // isn't silently truncated by the `as u32` cast.
-                let mut remaining = input;
-                loop {
-                    if out.len() >= cap {
-                        return Ok(Progress::More {
-                            consumed: input.len() - remaining.len(),
-                        });
-                    }
-                    let take = remaining.len().min(u32::MAX as usize);
-                    let tail = remaining.len() > take;
-                    let flush = if finish && !tail {
-                        zlib::FlushValue::Finish
-                    } else {
-                        zlib::FlushValue::NoFlush
-                    };
-                    s.next_in = remaining.as_ptr();
-                    s.avail_in = take as u32;
-                    let spare = spare(out, cap)?;
-                    s.next_out = spare.as_mut_ptr().cast();
-                    s.avail_out = spare.len().min(u32::MAX as usize) as u32;
-                    let before = s.avail_out;
-                    // SAFETY: `s` was initialized by `deflateInit2_`; next_in/
-                    // avail_in borrow `remaining`, next_out/avail_out borrow
-                    // the Vec's spare capacity for this one call.
-                    let rc = unsafe { zlib::deflate(&raw mut **s, flush) };
-                    let written = (before - s.avail_out) as usize;
-                    // SAFETY: deflate wrote exactly `written` bytes.
-                    unsafe { out.set_len(out.len() + written) };
-                    let consumed = take - s.avail_in as usize;
-                    remaining = &remaining[consumed..];
-                    match rc {
-                        zlib::ReturnCode::Ok | zlib::ReturnCode::BufError => {}
-                        zlib::ReturnCode::StreamEnd => return Ok(Progress::Done),
-                        zlib::ReturnCode::MemError => return Err(CodecError::OutOfMemory),
-                        _ => return Err(CodecError::Message("deflate failed")),
-                    }
-                    if s.avail_out != 0 && remaining.is_empty() {
-                        return Ok(Progress::Done);
-                    }
+            Backend::Deflate { state, .. } => {
+                let last = if finish {
+                    zlib::FlushValue::Finish
+                } else {
+                    zlib::FlushValue::NoFlush
+                };
+                deflate_run(state, input, last, cap, out, |_| {})
+            }
+            Backend::DeflateSpliced(sp) => {
+                let Spliced {
+                    stream,
+                    format,
+                    check,
+                    total,
+                    dirty,
+                    tail,
+                } = &mut **sp;
+                if !input.is_empty() {
+                    tail.clear();
+                    *dirty = true;
+                }
+                let format = *format;
+                let last = if finish {
+                    zlib::FlushValue::Finish
+                } else {
+                    zlib::FlushValue::NoFlush
+                };
+                let progress = deflate_run(stream, input, last, cap, out, |bytes| {
+                    *check = format.update_check(*check, bytes);
+                    *total = total.wrapping_add(bytes.len() as u32);
+                })?;
+                if finish && matches!(progress, Progress::Done) {
+                    sp.write_trailer(out)?;
                 }
+                Ok(progress)
             }
             Backend::Inflate { state: s, gzip } => {
                 let gzip = *gzip;
@@ -579,6 +762,12 @@ impl CompressionStreamCoder {
                 }
             }
             Backend::ZstdEncode(p) => {
+                if !input.is_empty() {
+                    self.zstd_frame = ZstdFrame::Open;
+                } else if finish && !continuing && self.zstd_frame == ZstdFrame::Closed {
+                    // A parallel chunk ended the last frame: no empty one after it.
+                    return Ok(Progress::Done);
+                }
                 // ZSTD_EndDirective: 0 = ZSTD_e_continue, 2 = ZSTD_e_end.
                 let end: core::ffi::c_uint = if finish { 2 } else { 0 };
                 let mut input_buf = zstd::ZSTD_inBuffer {
@@ -694,6 +883,115 @@ impl CompressionStreamCoder {
             }
         }
     }
+
+    /// Block size for [`CompressionStreamCoder__transformParallel`], or `None`
+    /// for a coder whose output can't be cut into independent pieces
+    /// (decoders, brotli).
+    fn parallel_block(&self) -> Option<usize> {
+        match self.backend {
+            Backend::Deflate { .. } | Backend::DeflateSpliced(_) => Some(DEFLATE_BLOCK),
+            Backend::ZstdEncode(_) => Some(ZSTD_BLOCK),
+            _ => None,
+        }
+    }
+
+    /// JS thread: plans `input` as pieces of `block` bytes. Ends the serial
+    /// stream at a boundary they can follow, with what it held going to
+    /// `prefix` (ahead of the first block), and moves the stream state past
+    /// `input` so the next chunk continues after it.
+    fn split(
+        &mut self,
+        input: &[u8],
+        block: usize,
+        prefix: &mut Vec<u8>,
+    ) -> Result<Vec<PieceKind>, CodecError> {
+        let blocks = (0..input.len())
+            .step_by(block)
+            .map(|start| (start, (start + block).min(input.len())));
+        if let Backend::ZstdEncode(p) = &self.backend {
+            if self.zstd_frame == ZstdFrame::Open {
+                zstd_end_frame(*p, &[], prefix)?;
+            }
+            self.zstd_frame = ZstdFrame::Closed;
+            return Ok(blocks
+                .map(|(start, end)| PieceKind::Zstd { start, end })
+                .collect());
+        }
+
+        let sp = self.splice(prefix)?;
+        let mut pieces = Vec::new();
+        if sp.format != Format::DeflateRaw {
+            pieces.push(PieceKind::Check {
+                format: sp.format,
+                value: sp.check,
+            });
+        }
+        let mut tail = core::mem::take(&mut sp.tail);
+        pieces.extend(blocks.map(|(start, end)| PieceKind::Deflate {
+            start,
+            end,
+            tail: core::mem::take(&mut tail),
+        }));
+        sp.total = sp.total.wrapping_add(input.len() as u32);
+        // `input` is more than one block, so at least a window.
+        let window = &input[input.len() - WINDOW..];
+        sp.restart(window)?;
+        sp.tail
+            .try_reserve_exact(WINDOW)
+            .map_err(|_| CodecError::OutOfMemory)?;
+        sp.tail.extend_from_slice(window);
+        Ok(pieces)
+    }
+
+    /// The deflate encoder as [`Spliced`], flushed to a byte boundary. The
+    /// first call converts the wrapped stream, writing its header if nothing
+    /// has been compressed yet.
+    fn splice(&mut self, prefix: &mut Vec<u8>) -> Result<&mut Spliced, CodecError> {
+        if let Backend::Deflate { state, format } = &mut self.backend {
+            let mut stream = deflate_init(Format::DeflateRaw.window_bits())?;
+            if let Err(e) = deflate_run(
+                state,
+                &[],
+                zlib::FlushValue::SyncFlush,
+                usize::MAX,
+                prefix,
+                |_| {},
+            ) {
+                // SAFETY: initialized just above; never used again.
+                unsafe { zlib::deflateEnd(&raw mut *stream) };
+                return Err(e);
+            }
+            // After the flush zlib has taken all input, so `adler` (a CRC-32
+            // for gzip) and `total_in` cover the whole stream so far.
+            let spliced = Spliced {
+                stream,
+                format: *format,
+                check: state.adler as u32,
+                total: state.total_in as u32,
+                dirty: false,
+                tail: Vec::new(),
+            };
+            // SAFETY: initialized by `deflateInit2_`; the backend is replaced
+            // below, so it is ended exactly once.
+            unsafe { zlib::deflateEnd(&raw mut **state) };
+            self.backend = Backend::DeflateSpliced(Box::new(spliced));
+        }
+        let Backend::DeflateSpliced(sp) = &mut self.backend else {
+            unreachable!();
+        };
+        if sp.dirty {
+            deflate_run(
+                &mut sp.stream,
+                &[],
+                zlib::FlushValue::SyncFlush,
+                usize::MAX,
+                prefix,
+                |_| {},
+            )?;
+            sp.dirty = false;
+        }
+        Ok(sp)
+    }
 }
 
 /// A chunk's bytes for the pool thread: a pinned ArrayBuffer's backing
@@ -706,6 +1004,9 @@ pub(crate) enum AsyncInput {
 // SAFETY: `Pinned.ptr` is a backing store pinned + protected by the paired
 // `PinnedChunk` for as long as the job lives; read only under the pool borrow.
 unsafe impl Send for AsyncInput {}
+// SAFETY: never written after construction; the pieces of a parallel chunk
+// read it from several pool threads at once.
+unsafe impl Sync for AsyncInput {}
 
 /// The pin + GC protection on a chunk whose bytes went to the pool; released
 /// on drop (JS thread, with the job's Js side).
@@ -1047,3 +1348,268 @@ pub extern "C" fn CompressionStreamCoder__transformAsync(
         },
     );
 }
+
+// ─── parallel path (large chunks for deflate formats and zstd) ─────────────
+
+/// History a deflate block may refer back into.
+const WINDOW: usize = 32 * 1024;
+/// Input per deflate block (pigz's default). Each block is primed with the
+/// [`WINDOW`] before it, so cutting costs only the sync-flush marker and the
+/// restarted Huffman tables.
+const DEFLATE_BLOCK: usize = 128 * 1024;
+/// Input per zstd frame. Frames share no history, so these are larger than
+/// deflate blocks to keep the ratio close to one frame's.
+const ZSTD_BLOCK: usize = 1024 * 1024;
+
+unsafe extern "C" {
+    /// JS-thread completion of one piece of a parallel chunk in
+    /// `JSCompressionStreamShared.cpp`, called in input order; `last` marks
+    /// the chunk's final piece.
+    fn Bun__CompressionStream__deliverPiece(
+        global: &JSGlobalObject,
+        stream_cell: JSValue,
+        out: *const u8,
+        out_len: usize,
+        last: bool,
+        error: JSValue,
+    );
+}
+
+enum PieceKind {
+    /// `input[start..end]` as raw deflate ending on a byte boundary
+    /// (Z_SYNC_FLUSH), primed with the window before `start`: `tail` for the
+    /// chunk's first block.
+    Deflate {
+        start: usize,
+        end: usize,
+        tail: Vec<u8>,
+    },
+    /// `input[start..end]` as a zstd frame of its own.
+    Zstd { start: usize, end: usize },
+    /// The wrapper's check continued over the whole chunk (the serial part
+    /// pigz runs on a thread of its own); written back to the coder when it
+    /// is delivered. It goes first, so the chunk's last piece is always a
+    /// block with output.
+    Check { format: Format, value: u32 },
+}
+
+/// One piece of a chunk compressed in parallel. Pieces don't touch the coder:
+/// everything they depend on was fixed by [`CompressionStreamCoder::split`].
+pub struct ParallelPiece {
+    input: Arc<AsyncInput>,
+    kind: PieceKind,
+    /// For the chunk's first piece, starts with what the serial stream held.
+    out: Vec<u8>,
+    error: Option<CodecError>,
+}
+
+impl ParallelPiece {
+    fn compute(&mut self) -> Result<(), CodecError> {
+        let input = self.input.slice();
+        match &mut self.kind {
+            PieceKind::Deflate { start, end, tail } => {
+                let dict = if *start == 0 {
+                    &tail[..]
+                } else {
+                    &input[start.saturating_sub(WINDOW)..*start]
+                };
+                deflate_block(dict, &input[*start..*end], &mut self.out)
+            }
+            PieceKind::Zstd { start, end } => {
+                let cctx = NonNull::new(zstd::ZSTD_createCCtx()).ok_or(CodecError::OutOfMemory)?;
+                let result = zstd_end_frame(cctx, &input[*start..*end], &mut self.out);
+                // SAFETY: created just above; freed once.
+                unsafe { zstd::ZSTD_freeCCtx(cctx.as_ptr()) };
+                result
+            }
+            PieceKind::Check { format, value } => {
+                *value = format.update_check(*value, input);
+                Ok(())
+            }
+        }
+    }
+}
+
+/// `block` as raw deflate ending on a byte boundary, primed with `dict`.
+fn deflate_block(dict: &[u8], block: &[u8], out: &mut Vec<u8>) -> Result<(), CodecError> {
+    let mut s = deflate_init(Format::DeflateRaw.window_bits())?;
+    let result = (|| {
+        // SAFETY: `s` is a fresh raw deflate stream, where a dictionary may be
+        // set; `dict` is at most `WINDOW` bytes.
+        if !dict.is_empty()
+            && unsafe {
+                zlib::deflateSetDictionary(&raw mut *s, dict.as_ptr(), dict.len() as c_uint)
+            } != zlib::ReturnCode::Ok
+        {
+            return Err(CodecError::Message("deflate failed"));
+        }
+        // One allocation for the whole block; the sync flush adds a few bytes
+        // past deflateBound.
+        // SAFETY: `s` is initialized.
+        let bound = unsafe { zlib::deflateBound(&raw mut *s, block.len() as zlib::uLong) } as usize;
+        out.try_reserve(bound + 16)
+            .map_err(|_| CodecError::OutOfMemory)?;
+        deflate_run(
+            &mut s,
+            block,
+            zlib::FlushValue::SyncFlush,
+            usize::MAX,
+            out,
+            |_| {},
+        )
+        .map(|_| ())
+    })();
+    // SAFETY: initialized by `deflate_init`; ended once.
+    unsafe { zlib::deflateEnd(&raw mut *s) };
+    result
+}
+
+/// The JS-thread side of a parallel chunk, shared by its pieces' completions:
+/// holds the pieces that finish early until those before them are delivered.
+struct ParallelBatch {
+    /// One coder reference for the whole batch, released by `Drop`; the check
+    /// piece's delivery writes back into the coder.
+    coder: *mut CompressionStreamCoder,
+    /// GC root for the `JSTransformStream` cell, as [`CompressionAsyncJs::stream`].
+    stream: Strong,
+    pieces: Vec<Option<ParallelPiece>>,
+    /// Index of the next piece to deliver.
+    next: usize,
+    _pin: Option<PinnedChunk>,
+}
+
+impl Drop for ParallelBatch {
+    fn drop(&mut self) {
+        // SAFETY: ref'd in `CompressionStreamCoder__transformParallel`; the
+        // batch drops that reference exactly once.
+        unsafe { bun_ptr::ThreadSafeRefCount::<CompressionStreamCoder>::deref(self.coder) };
+    }
+}
+
+impl ParallelBatch {
+    /// Delivers every piece that is ready, in order.
+    fn deliver_ready(batch: &Rc<RefCell<Self>>, global: &JSGlobalObject) {
+        loop {
+            // Not borrowed across the delivery, which runs stream code.
+            let (piece, last, stream, coder) = {
+                let mut b = batch.borrow_mut();
+                let next = b.next;
+                let Some(piece) = b.pieces.get_mut(next).and_then(Option::take) else {
+                    return;
+                };
+                b.next += 1;
+                (piece, b.next == b.pieces.len(), b.stream.get(), b.coder)
+            };
+            if let (PieceKind::Check { value, .. }, None) = (&piece.kind, &piece.error) {
+                // SAFETY: the batch's reference keeps the coder alive, and it
+                // is idle until its chunk settles (after its last piece).
+                if let Backend::DeflateSpliced(sp) = unsafe { &mut (*coder).backend } {
+                    sp.check = *value;
+                }
+            }
+            let (out, out_len, err) = match &piece.error {
+                None => (piece.out.as_ptr(), piece.out.len(), JSValue::ZERO),
+                Some(e) => (core::ptr::null(), 0, codec_error_to_js(global, e)),
+            };
+            // SAFETY: FFI into `JSCompressionStreamShared.cpp`; `out` is
+            // consumed before it returns.
+            unsafe {
+                Bun__CompressionStream__deliverPiece(global, stream, out, out_len, last, err)
+            };
+        }
+    }
+}
+
+pub struct ParallelJs {
+    batch: Rc<RefCell<ParallelBatch>>,
+    index: usize,
+}
+// SAFETY: the batch (a Strong, a pin, a coder reference) is created, shared
+// and dropped on the JS thread only; `Rc` keeps it there.
+unsafe impl bun_jsc::job::JsAffine for ParallelJs {}
+
+impl bun_jsc::JobContext for ParallelPiece {
+    type OffThread = Self;
+    type Js = ParallelJs;
+
+    fn run(this: &mut Self, done: bun_jsc::Completion<Self>) -> Option<bun_jsc::Completion<Self>> {
+        if let Err(e) = this.compute() {
+            this.error = Some(e);
+        }
+        Some(done)
+    }
+
+    fn then(this: Self, js: ParallelJs, cx: &bun_jsc::JsThread<'_>) -> bun_jsc::JsResult<()> {
+        js.batch.borrow_mut().pieces[js.index] = Some(this);
+        ParallelBatch::deliver_ready(&js.batch, cx.global());
+        Ok(())
+    }
+}
+
+/// A chunk's first step for an encoder, split into blocks the work pool
+/// compresses in parallel: raw deflate blocks primed with the window before
+/// them (pigz), or one zstd frame per block. Each piece completes through
+/// `Bun__CompressionStream__deliverPiece`, in input order.
+///
+/// Returns false with nothing scheduled when the coder can't split or the
+/// chunk is a single block (the caller runs one off-thread step instead).
+/// Throws and returns true if the serial stream couldn't be ended.
+#[unsafe(no_mangle)]
+#[allow(clippy::not_unsafe_ptr_arg_deref)]
+pub extern "C" fn CompressionStreamCoder__transformParallel(
+    this: *mut CompressionStreamCoder,
+    global: &JSGlobalObject,
+    stream_cell: JSValue,
+    chunk: JSValue,
+    input: *const u8,
+    input_len: usize,
+) -> bool {
+    // SAFETY: `this` is the live coder owned by the calling JS cell, between
+    // chunks (TransformStream serializes writes), on the JS thread.
+    let coder = unsafe { &mut *this };
+    let Some(block) = coder.parallel_block() else {
+        return false;
+    };
+    if input.is_null() || input_len <= block || coder.pending.is_some() {
+        return false;
+    }
+    // SAFETY: the caller passes a BufferSource's bytes; pinned or copied below
+    // before this returns.
+    let bytes = unsafe { core::slice::from_raw_parts(input, input_len) };
+    let mut prefix = Vec::new();
+    let kinds = match coder.split(bytes, block, &mut prefix) {
+        Ok(kinds) => kinds,
+        Err(e) => {
+            throw_codec_error(global, e);
+            return true;
+        }
+    };
+    let (input, pin) = AsyncInput::new(global, chunk, bytes);
+    let input = Arc::new(input);
+    // SAFETY: as above; the batch takes its own reference.
+    unsafe { bun_ptr::ThreadSafeRefCount::<CompressionStreamCoder>::ref_(this) };
+    let batch = Rc::new(RefCell::new(ParallelBatch {
+        coder: this,
+        stream: Strong::create(stream_cell, global),
+        pieces: kinds.iter().map(|_| None).collect(),
+        next: 0,
+        _pin: pin,
+    }));
+    let cx = global.js_thread();
+    for (index, kind) in kinds.into_iter().enumerate() {
+        bun_jsc::Job::<ParallelPiece>::schedule(
+            &cx,
+            ParallelPiece {
+                input: input.clone(),
+                kind,
+                out: core::mem::take(&mut prefix),
+                error: None,
+            },
+            ParallelJs {
+                batch: batch.clone(),
+                index,
+            },
+        );
+    }
+    true
+}
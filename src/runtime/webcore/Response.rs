@@ -1246,8 +1246,8 @@ impl Response {
         if let BodyValue::Blob(blob) = body.value.get() {
             if let Some(headers) = init.headers.as_deref_mut() {
                 let content_type = blob.content_type_slice();
-                if !content_type.is_empty() && !headers.fast_has(HTTPHeaderName::ContentType) {
-                    headers.put(
+                if !content_type.is_empty() {
+                    headers.put_default(
                         HTTPHeaderName::ContentType,
                         &BunString::ascii(content_type),
                         global_this,
@@ -63,6 +63,10 @@ pub struct InternalLoopData {
     // Higher tier (`bun_runtime`) casts this back when reading.
     pub jsc_vm: *const c_void,
     pub tick_depth: c_int,
+    pub(crate) timeout_wheel_tick: u32,
+    /// `LIBUS_TIMEOUT_WHEEL_SLOTS` buckets of sockets keyed by the sweep tick
+    /// that may expire them. Owned by `loop.c`; never touched from Rust.
+    pub(crate) timeout_wheel: [*mut us_socket_t; 240],
 }
 
 impl InternalLoopData {
@@ -12,6 +12,20 @@ bun_core::declare_scope!(Loop, visible);
 /// it reaches the idle sweep, so passing this costs nothing on the paths that never park.
 pub const NOW_NS_UNKNOWN: u64 = 0;
 
+/// Mirrors `uWS::LoopData::CorkStats` (packages/bun-uws/src/LoopData.h).
+#[repr(C)]
+#[derive(Clone, Copy, Default, Debug)]
+pub struct CorkStats {
+    /// Sockets force-uncorked because every cork slot held data.
+    pub evictions: u64,
+    pub flushes: u64,
+    pub flushed_bytes: u64,
+    /// Flushes that had outgrown the 16 KiB cork buffer into a slab.
+    pub slab_flushes: u64,
+    pub slots: u64,
+    pub peak_slots: u64,
+}
+
 // ───────────────────────────── PosixLoop ─────────────────────────────
 
 // Mirrors C `struct us_loop_t` (packages/bun-usockets/src/internal/eventing/
@@ -119,6 +133,13 @@ impl PosixLoop {
         unsafe { c::uws_loop_date_header_timer_update(self) };
     }
 
+    pub fn cork_stats(&mut self) -> CorkStats {
+        let mut stats = CorkStats::default();
+        // SAFETY: self is a valid loop pointer; `stats` is a live out-param
+        unsafe { c::uws_loop_cork_stats(self, &mut stats) };
+        stats
+    }
+
     pub fn iteration_number(&self) -> u64 {
         self.internal_loop_data.iteration_nr
     }
@@ -506,6 +527,13 @@ impl WindowsLoop {
         unsafe { c::uws_loop_date_header_timer_update(self) };
     }
 
+    pub fn cork_stats(&mut self) -> CorkStats {
+        let mut stats = CorkStats::default();
+        // SAFETY: self is a valid loop pointer; `stats` is a live out-param
+        unsafe { c::uws_loop_cork_stats(self, &mut stats) };
+        stats
+    }
+
     /// # Safety
     /// `this` must have been returned by `us_create_loop`/`uws_get_loop_with_native`
     /// and not yet freed.
@@ -598,6 +626,7 @@ mod c {
         #[cfg(windows)]
         pub(super) fn uws_get_loop_with_native(native: *mut c_void) -> *mut WindowsLoop;
         pub(super) fn uws_loop_date_header_timer_update(loop_: *mut Loop);
+        pub(super) fn uws_loop_cork_stats(loop_: *mut Loop, out: *mut CorkStats);
     }
 }
 // Re-exported raw externs for cross-thread callers (e.g. bun_http's
@@ -358,6 +358,20 @@ impl<const SSL: bool> Response<SSL> {
         }
     }
 
+    /// The socket fd when the kernel seals this TLS response's records
+    /// (`kernelTLS`), so the sendfile path can write plaintext into it.
+    pub(crate) fn kernel_tls_fd(&mut self) -> Option<Fd> {
+        #[cfg(windows)]
+        {
+            return None;
+        }
+        #[cfg(not(windows))]
+        {
+            let fd = c::uws_res_kernel_tls_fd(Self::ssl_flag(), self.as_raw());
+            (fd >= 0).then(|| Fd::from_native(fd))
+        }
+    }
+
     pub fn get_remote_socket_info(&mut self) -> Option<SocketAddress> {
         let mut ip_ptr: *const u8 = core::ptr::null();
         let mut port: i32 = 0;
@@ -889,6 +903,13 @@ impl AnyResponse {
         }
     }
 
+    pub fn kernel_tls_fd(self) -> Option<Fd> {
+        match self {
+            AnyResponse::SSL(ptr) => TLSResponse::as_handle(ptr).kernel_tls_fd(),
+            AnyResponse::TCP(_) | AnyResponse::H3(_) => None,
+        }
+    }
+
     pub fn prepare_for_sendfile(self) {
         any_dispatch!(self, |r| r.prepare_for_sendfile())
     }
@@ -1222,6 +1243,7 @@ pub mod c {
         pub(crate) safe fn uws_res_end_stream(ssl: i32, res: &mut uws_res, close_connection: bool);
         pub(crate) safe fn uws_res_prepare_for_sendfile(ssl: i32, res: &mut uws_res);
         pub(crate) safe fn uws_res_get_native_handle(ssl: i32, res: &mut uws_res) -> *mut Socket;
+        pub(crate) safe fn uws_res_kernel_tls_fd(ssl: i32, res: &mut uws_res) -> c_int;
         pub(crate) safe fn uws_res_on_data(
             ssl: i32,
             res: &mut uws_res,
@@ -35,6 +35,10 @@ extern "C"
     loopData->updateDate();
   }
 
+  void uws_loop_cork_stats(us_loop_t *loop, uWS::LoopData::CorkStats *out) {
+    *out = uWS::Loop::data(loop)->getCorkStats();
+  }
+
   uws_app_t *uws_create_app(int ssl, struct us_bun_socket_context_options_t options)
   {
     uWS::SocketContextOptions socket_context_options;
@@ -1966,6 +1970,15 @@ __attribute__((callback (corker, ctx)))
     }
   }
 
+  /* The socket fd when the kernel seals this TLS response's records, so the
+   * sendfile path can use it; -1 for plain TCP and user-space TLS. */
+  int uws_res_kernel_tls_fd(int ssl, uws_res_r res)
+  {
+    if (!ssl)
+      return -1;
+    return us_socket_kernel_tls_fd((us_socket_t *)res);
+  }
+
   size_t uws_ws_memory_cost(int ssl, uws_websocket_t *ws) {
     if (ssl) {
       return ((TLSWebSocket*)ws)->memoryCost();
@@ -119,6 +119,8 @@ unsafe extern "C" {
     pub fn inflateReset(stream: *mut zStream_struct) -> ReturnCode;
 
     pub fn crc32(crc: uLong, buf: *const Bytef, len: uInt) -> uLong;
+
+    pub fn adler32(adler: uLong, buf: *const Bytef, len: uInt) -> uLong;
 }
 
 /// Safe CRC-32 over an arbitrary-length slice. zlib's `crc32` takes a 32-bit
@@ -132,6 +134,17 @@ pub fn crc32_bytes(crc: u32, data: &[u8]) -> u32 {
     crc as u32
 }
 
+/// Safe Adler-32 over an arbitrary-length slice; see [`crc32_bytes`]. The
+/// initial value is 1.
+pub fn adler32_bytes(adler: u32, data: &[u8]) -> u32 {
+    let mut adler: uLong = uLong::from(adler);
+    for chunk in data.chunks(u32::MAX as usize) {
+        // SAFETY: `chunk` is a valid slice with `len <= u32::MAX`.
+        adler = unsafe { adler32(adler, chunk.as_ptr(), chunk.len() as uInt) };
+    }
+    adler as u32
+}
+
 pub use bun_core::compress::State;
 type ZlibReaderArrayListState = State;
 type ZlibCompressorArrayListState = State;
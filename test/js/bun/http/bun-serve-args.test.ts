@@ -1,6 +1,7 @@
 import { serve } from "bun";
 import { describe, expect, test } from "bun:test";
-import { isWindows, tmpdirSync } from "../../../harness";
+import { isWindows, tempDir, tls, tmpdirSync } from "../../../harness";
+import path from "path";
 
 const defaultHostname = "localhost";
 
@@ -127,6 +128,79 @@ describe("hostname and port works", () => {
   }
 });
 
+describe("Bun.serve reusePort", () => {
+  test.skipIf(isWindows)('"cpu" lets two servers share a port', async () => {
+    using first = serve({
+      port: 0,
+      reusePort: "cpu",
+      fetch() {
+        return new Response("ok");
+      },
+    });
+    using second = serve({
+      port: first.port,
+      reusePort: "cpu",
+      fetch() {
+        return new Response("ok");
+      },
+    });
+    expect(second.port).toBe(first.port);
+    expect(await fetch(first.url).then(res => res.text())).toBe("ok");
+  });
+
+  test.skipIf(isWindows)("other strings are coerced to a boolean", async () => {
+    using first = serve({
+      port: 0,
+      // @ts-expect-error - Testing runtime behavior
+      reusePort: "true",
+      fetch() {
+        return new Response("ok");
+      },
+    });
+    using second = serve({
+      port: first.port,
+      // @ts-expect-error - Testing runtime behavior
+      reusePort: "yes",
+      fetch() {
+        return new Response("ok");
+      },
+    });
+    expect(second.port).toBe(first.port);
+    expect(await fetch(first.url).then(res => res.text())).toBe("ok");
+  });
+});
+
+describe("Bun.serve kernelTLS", () => {
+  // Whether or not the kernel takes the keys (tls module loaded, Linux only),
+  // responses must arrive intact: the fallback is the user-space path.
+  for (const maxVersion of [0x0303, undefined]) {
+    test(`serves responses and files${maxVersion ? " over TLS 1.2" : ""}`, async () => {
+      const file = Buffer.alloc(3 * 1024 * 1024 + 17);
+      for (let i = 0; i < file.length; i++) file[i] = (i * 31) & 0xff;
+      using dir = tempDir("serve-kernel-tls", { "large.bin": file });
+
+      using server = serve({
+        port: 0,
+        kernelTLS: true,
+        tls: { ...tls, maxVersion },
+        fetch(req) {
+          if (new URL(req.url).pathname === "/file") {
+            return new Response(Bun.file(path.join(String(dir), "large.bin")));
+          }
+          return new Response("ok".repeat(50_000));
+        },
+      });
+
+      for (let i = 0; i < 3; i++) {
+        const res = await fetch(new URL("/", server.url), { tls: { rejectUnauthorized: false } });
+        expect(await res.text()).toBe("ok".repeat(50_000));
+      }
+      const res = await fetch(new URL("/file", server.url), { tls: { rejectUnauthorized: false } });
+      expect(Buffer.from(await res.arrayBuffer()).equals(file)).toBe(true);
+    });
+  }
+});
+
 describe("Bun.serve error handling", () => {
   test("missing fetch handler throws", () => {
     // @ts-expect-error - Testing runtime behavior
@@ -1,4 +1,5 @@
 import { describe, expect, test } from "bun:test";
+import { headersHaveCachedWireBlock } from "bun:internal-for-testing";
 import { once } from "node:events";
 import * as net from "node:net";
 
@@ -109,6 +110,14 @@ describe("response Connection: close closes the socket", () => {
     await check(() => new Response("bye", { headers: { Connection: "TE, close" } }));
   });
 
+  test("shared Headers object", async () => {
+    // Written to a second response unchanged, the headers come from the cached
+    // serialization, which must carry the close flag too.
+    const headers = new Headers({ Connection: "close" });
+    await check(() => new Response("bye", { headers }));
+    await check(() => new Response("bye", { headers }));
+  });
+
   test("streaming body", async () => {
     await check(
       () =>
@@ -160,3 +169,90 @@ describe("response Connection: close closes the socket", () => {
     }
   });
 });
+
+describe("a Headers object shared by many responses", () => {
+  test("is written in full and follows later changes", async () => {
+    const shared = new Headers({
+      "Access-Control-Allow-Origin": "*",
+      "Cache-Control": "public, max-age=60",
+      "X-Custom": "custom value",
+    });
+    shared.append("Set-Cookie", "a=1");
+    shared.append("Set-Cookie", "b=2");
+
+    using server = Bun.serve({
+      port: 0,
+      development: false,
+      fetch(req) {
+        const { pathname } = new URL(req.url);
+        if (pathname === "/mutate") {
+          shared.delete("X-Custom");
+          shared.set("Cache-Control", "no-store");
+        }
+        return new Response("ok", { headers: shared });
+      },
+    });
+
+    for (let i = 0; i < 5; i++) {
+      const res = await fetch(server.url);
+      expect(await res.text()).toBe("ok");
+      expect(res.headers.get("access-control-allow-origin")).toBe("*");
+      expect(res.headers.get("cache-control")).toBe("public, max-age=60");
+      expect(res.headers.get("x-custom")).toBe("custom value");
+      expect(res.headers.getSetCookie()).toEqual(["a=1", "b=2"]);
+      expect(res.headers.get("content-length")).toBe("2");
+      expect(res.headers.get("date")).not.toBeNull();
+    }
+    expect(headersHaveCachedWireBlock(shared)).toBe(true);
+
+    await (await fetch(new URL("/mutate", server.url))).text();
+    expect(headersHaveCachedWireBlock(shared)).toBe(false);
+    for (let i = 0; i < 3; i++) {
+      const res = await fetch(server.url);
+      expect(await res.text()).toBe("ok");
+      expect(res.headers.get("cache-control")).toBe("no-store");
+      expect(res.headers.has("x-custom")).toBe(false);
+      expect(res.headers.getSetCookie()).toEqual(["a=1", "b=2"]);
+    }
+    expect(headersHaveCachedWireBlock(shared)).toBe(true);
+  });
+
+  test.each([
+    ["Response.json()", (headers: Headers) => Response.json({ ok: true }, { headers }), "application/json"],
+    [
+      "a Blob body",
+      (headers: Headers) => new Response(new Blob(['{"ok":true}'], { type: "text/x-ok" }), { headers }),
+      "text/x-ok",
+    ],
+  ])("stays cached when %s adds a Content-Type", async (_, respond, contentType) => {
+    const shared = new Headers({ "Access-Control-Allow-Origin": "*", "Cache-Control": "public, max-age=60" });
+    using server = Bun.serve({
+      port: 0,
+      development: false,
+      fetch: () => respond(shared),
+    });
+    for (let i = 0; i < 4; i++) {
+      const res = await fetch(server.url);
+      expect(await res.json()).toEqual({ ok: true });
+      expect(res.headers.get("content-type")).toBe(contentType);
+      expect(res.headers.get("access-control-allow-origin")).toBe("*");
+      expect(res.headers.get("cache-control")).toBe("public, max-age=60");
+    }
+    expect(shared.has("content-type")).toBe(false);
+    expect(headersHaveCachedWireBlock(shared)).toBe(true);
+  });
+
+  test("keeps a user Date header instead of adding one", async () => {
+    const headers = new Headers({ Date: "Thu, 01 Jan 1970 00:00:00 GMT", "Content-Type": "text/plain" });
+    using server = Bun.serve({
+      port: 0,
+      development: false,
+      fetch: () => new Response("ok", { headers }),
+    });
+    for (let i = 0; i < 3; i++) {
+      const res = await fetch(server.url);
+      expect(res.headers.get("date")).toBe("Thu, 01 Jan 1970 00:00:00 GMT");
+      expect(await res.text()).toBe("ok");
+    }
+  });
+});
@@ -380,6 +380,42 @@ describe("route precedence", () => {
   });
 });
 
+describe("many routes", () => {
+  let server: Server;
+
+  beforeAll(() => {
+    const routes = {};
+    for (let i = 0; i < 3000; i++) {
+      routes[`/api/v1/items${i}/list`] = () => new Response(`static ${i}`);
+      routes[`/users/${i}/:id`] = req => new Response(`user ${i} ${req.params.id}`);
+    }
+    routes["/api/v1/items7/*"] = () => new Response("items7 catchall");
+    server = Bun.serve({
+      port: 0,
+      fetch: () => new Response("fallback"),
+      routes,
+    });
+    server.unref();
+  });
+
+  afterAll(() => {
+    server.stop(true);
+  });
+
+  it("matches static and parameter routes", async () => {
+    for (const i of [0, 1, 1499, 2999]) {
+      expect(await fetch(new URL(`/api/v1/items${i}/list`, server.url)).then(res => res.text())).toBe(`static ${i}`);
+      expect(await fetch(new URL(`/users/${i}/abc`, server.url)).then(res => res.text())).toBe(`user ${i} abc`);
+    }
+  });
+
+  it("falls through to wildcards and fetch", async () => {
+    expect(await fetch(new URL("/api/v1/items7/other", server.url)).then(res => res.text())).toBe("items7 catchall");
+    expect(await fetch(new URL("/api/v1/items3000/list", server.url)).then(res => res.text())).toBe("fallback");
+    expect(await fetch(new URL("/api/v1/items1", server.url)).then(res => res.text())).toBe("fallback");
+  });
+});
+
 describe("error handling", () => {
   let server: Server;
 
@@ -0,0 +1,47 @@
+import { getCorkStats } from "bun:internal-for-testing";
+import { expect, test } from "bun:test";
+
+test("a response larger than the cork buffer is flushed from a slab in one piece", async () => {
+  const body = Buffer.alloc(40 * 1024, "x").toString();
+  using server = Bun.serve({
+    port: 0,
+    fetch() {
+      return new Response(body);
+    },
+  });
+
+  const before = getCorkStats();
+  const res = await fetch(server.url);
+  expect(await res.text()).toBe(body);
+
+  const after = getCorkStats();
+  expect(after.slabFlushes).toBeGreaterThan(before.slabFlushes);
+  expect(after.flushedBytes - before.flushedBytes).toBeGreaterThanOrEqual(body.length);
+});
+
+test("many sockets responding in the same tick all get their responses", async () => {
+  const { promise: release, resolve } = Promise.withResolvers<void>();
+  let pending = 0;
+  const count = 48;
+  using server = Bun.serve({
+    port: 0,
+    async fetch(req) {
+      if (++pending === count) resolve();
+      await release;
+      return new Response(new URL(req.url).pathname);
+    },
+  });
+
+  const before = getCorkStats();
+  const bodies = await Promise.all(
+    Array.from({ length: count }, (_, i) =>
+      fetch(new URL(`/${i}`, server.url), { keepalive: false }).then(r => r.text()),
+    ),
+  );
+  expect(bodies).toEqual(Array.from({ length: count }, (_, i) => `/${i}`));
+
+  const after = getCorkStats();
+  expect(after.flushes).toBeGreaterThan(before.flushes);
+  expect(after.slots).toBeGreaterThanOrEqual(2);
+  expect(after.slots).toBeLessThanOrEqual(64);
+});
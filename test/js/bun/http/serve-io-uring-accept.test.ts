@@ -0,0 +1,35 @@
+import { expect, test } from "bun:test";
+import { bunEnv, bunExe, isLinux } from "harness";
+
+// BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT takes a listen socket's backlog in
+// io_uring batches of 8. On kernels older than 6.10 the flag is ignored and the
+// same assertions cover the accept4() path.
+test.skipIf(!isLinux)("io_uring accept batching serves a burst larger than one batch", async () => {
+  const script = `
+    const count = 50;
+    let served = 0;
+    const server = Bun.serve({
+      port: 0,
+      hostname: "127.0.0.1",
+      fetch(req, server) {
+        served++;
+        return new Response(server.requestIP(req)?.address ?? "none");
+      },
+    });
+    const bodies = await Promise.all(
+      Array.from({ length: count }, () => fetch(server.url, { keepalive: false }).then(r => r.text())),
+    );
+    server.stop(true);
+    console.log(JSON.stringify({ served, addresses: [...new Set(bodies)] }));
+  `;
+  await using proc = Bun.spawn({
+    cmd: [bunExe(), "-e", script],
+    env: { ...bunEnv, BUN_FEATURE_FLAG_EXPERIMENTAL_IO_URING_ACCEPT: "1" },
+    stdout: "pipe",
+    stderr: "pipe",
+  });
+  const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+  expect(stderr).toBe("");
+  expect(JSON.parse(stdout)).toEqual({ served: 50, addresses: ["127.0.0.1"] });
+  expect(exitCode).toBe(0);
+});
@@ -1,3 +1,4 @@
+import { describe as describeCell, heapStats } from "bun:jsc";
 import { describe, expect, test } from "bun:test";
 import { bunEnv, bunExe } from "harness";
 
@@ -419,6 +420,39 @@ test("Bun.JSONC.parse builds objects the way JSON.parse does: index keys first,
   expect(Bun.JSONC.parse(`[[],[1,"a",{}],[[["deep"]]]]`)).toEqual([[], [1, "a", {}], [[["deep"]]]]);
 });
 
+test("Bun.JSONC.parse gives same-shaped records one shape, and keeps look-alike objects distinct", () => {
+  const records = Array.from({ length: 2000 }, (_, i) => ({
+    id: i,
+    name: "user" + i,
+    tags: i % 2 ? ["a"] : [],
+    address: { city: "c" + (i % 7), zip: String(i).padStart(5, "0") },
+  }));
+  const tricky = [
+    { a: 1, b: 2 },
+    { a: 1, "0": 2 },
+    { a: 1, a2: 2 },
+    { b: 1, a: 2 },
+    { a: 3, b: 4 },
+  ];
+  const doc = JSON.stringify(records).slice(0, -1) + "," + JSON.stringify(tricky).slice(1);
+  const parsed = Bun.JSONC.parse(doc) as any[];
+  const reference = JSON.parse(doc);
+  expect(parsed).toEqual(reference);
+  for (let i = 0; i < parsed.length; i++) expect(Object.keys(parsed[i])).toEqual(Object.keys(reference[i]));
+
+  const { describe: shapeOf } = require("bun:jsc");
+  expect(shapeOf(parsed[1500]).includes("StructureID")).toBe(true);
+  const structureOf = (o: object) => /StructureID: (\d+)/.exec(shapeOf(o))?.[1];
+  expect(structureOf(parsed[1500])).toBe(structureOf(parsed[0]));
+  expect(structureOf(parsed[1500].address)).toBe(structureOf(parsed[3].address));
+
+  // Duplicate keys keep the last value and one property, like JSON.parse.
+  const dupes = `[{"a":1,"a":2},{"a":3,"a":4},{"a":5,"b":6}]`;
+  expect(Bun.JSONC.parse(dupes)).toEqual(JSON.parse(dupes));
+  parsed[0].extra = true;
+  expect(Object.keys(parsed[1])).toEqual(["id", "name", "tags", "address"]);
+});
+
 describe("structural index window seams", () => {
   const WINDOW = 8192;
   const BLOCK = 64;
@@ -631,3 +665,115 @@ describe("structural index window seams", () => {
     expect((Bun.JSONC.parse(singleQuoted) as Record<string, unknown>).z).toBe("x");
   });
 });
+
+describe("Bun.JSONC.parse with { lazy: true }", () => {
+  const doc = JSON.stringify({
+    id: "evt_123",
+    type: "invoice.paid",
+    data: {
+      object: { amount: 4200, currency: "eur", lines: [{ id: 1, tags: ["a"] }, { id: 2, tags: [] }] },
+      previous: null,
+    },
+    "clé": "värde \u{1F600}",
+    empty: {},
+    list: [1, "two", { three: 3 }, [4]],
+  });
+
+  test("matches the eager result", () => {
+    const lazy = Bun.JSONC.parse(doc, { lazy: true });
+    expect(lazy).toEqual(JSON.parse(doc));
+    expect(JSON.stringify(Bun.JSONC.parse(doc, { lazy: true }))).toBe(doc);
+  });
+
+  // describe() dumps the object's Structure, i.e. the properties built so far.
+  function builtKeys(object: object) {
+    const properties = /\{([^}]*)\}/.exec(describeCell(object))![1];
+    return properties
+      .split(",")
+      .map(entry => entry.trim().split(":")[0])
+      .filter(Boolean)
+      .sort();
+  }
+
+  test("reads nested fields without touching the rest", () => {
+    const lazy = Bun.JSONC.parse(doc, { lazy: true }) as any;
+    expect(builtKeys(lazy)).toEqual([]);
+    expect(lazy.type).toBe("invoice.paid");
+    expect(lazy.data.object.amount).toBe(4200);
+    expect(lazy.data.object.lines[1].id).toBe(2);
+    expect(Array.isArray(lazy.list)).toBe(true);
+    expect(lazy.list[2].three).toBe(3);
+    expect(lazy["clé"]).toBe("värde \u{1F600}");
+    expect(lazy.missing).toBeUndefined();
+    expect("type" in lazy).toBe(true);
+    expect(Object.hasOwn(lazy, "nope")).toBe(false);
+    expect(Object.getPrototypeOf(lazy)).toBe(Object.prototype);
+    expect(Object.prototype.toString.call(lazy)).toBe("[object Object]");
+
+    expect(builtKeys(lazy.data.object)).toEqual(["amount", "currency", "lines"]);
+    const unread = lazy.data.object.lines[0];
+    expect(builtKeys(unread)).toEqual([]);
+    expect(unread.id).toBe(1);
+    expect(builtKeys(unread)).toEqual(["id", "tags"]);
+  });
+
+  test("keeps JSON.parse key order, index keys and duplicates", () => {
+    const text = '{"b":1,"2":"two","a":{"y":1,"x":2},"1":"one","b":3}';
+    const lazy = Bun.JSONC.parse(text, { lazy: true }) as any;
+    expect(Object.keys(lazy)).toEqual(Object.keys(JSON.parse(text)));
+    expect(lazy[2]).toBe("two");
+    expect(lazy.b).toBe(3);
+    expect(Object.entries(lazy.a)).toEqual([
+      ["y", 1],
+      ["x", 2],
+    ]);
+  });
+
+  test("can be modified like a plain object", () => {
+    const lazy = Bun.JSONC.parse('{"a":1,"b":{"c":2},"d":3}', { lazy: true }) as any;
+    lazy.e = 4;
+    delete lazy.d;
+    lazy.b.c++;
+    Object.defineProperty(lazy, "f", { value: 5, enumerable: true });
+    expect(JSON.stringify(lazy)).toBe('{"a":1,"b":{"c":3},"e":4,"f":5}');
+    expect({ ...lazy.b }).toEqual({ c: 3 });
+
+    const frozen = Object.freeze(Bun.JSONC.parse('{"a":1}', { lazy: true }) as any);
+    expect(Object.isFrozen(frozen)).toBe(true);
+    expect(frozen.a).toBe(1);
+  });
+
+  test("accepts comments and non-object roots", () => {
+    expect(Bun.JSONC.parse('{ // c\n"a": [1, 2,], }', { lazy: true })).toEqual({ a: [1, 2] });
+    expect(Bun.JSONC.parse("42", { lazy: true })).toBe(42);
+    expect(Bun.JSONC.parse('"s"', { lazy: true })).toBe("s");
+    expect(Bun.JSONC.parse('[{"a":1}]', { lazy: true })).toEqual([{ a: 1 }]);
+    expect(() => Bun.JSONC.parse('{"a":}', { lazy: true })).toThrow(SyntaxError);
+    expect(() => Bun.JSONC.parse("{}", 1 as any)).toThrow();
+  });
+
+  test("nested objects outlive the root", () => {
+    const kept: any[] = [];
+    for (let i = 0; i < 200; i++) {
+      const lazy = Bun.JSONC.parse(`{"n":${i},"inner":{"v":"value ${i}"}}`, { lazy: true }) as any;
+      kept.push(lazy.inner);
+    }
+    Bun.gc(true);
+    for (let i = 0; i < kept.length; i++) expect(kept[i].v).toBe(`value ${i}`);
+  });
+
+  test("a nested object keeps the document charged to the GC after the root is dropped", () => {
+    const padding = Buffer.alloc(4 * 1024 * 1024, "x").toString();
+    for (const text of [`{"padding":"${padding}","inner":{"v":1}}`, `[{"v":1},"${padding}"]`]) {
+      Bun.gc(true);
+      const before = heapStats().extraMemorySize;
+      const inner = (() => {
+        const root = Bun.JSONC.parse(text, { lazy: true }) as any;
+        return Array.isArray(root) ? root[0] : root.inner;
+      })();
+      Bun.gc(true);
+      expect(heapStats().extraMemorySize - before).toBeGreaterThanOrEqual(text.length);
+      expect(inner.v).toBe(1);
+    }
+  });
+});
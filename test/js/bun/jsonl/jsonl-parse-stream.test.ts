@@ -0,0 +1,153 @@
+import { describe, expect, test } from "bun:test";
+
+async function collect(source: AsyncIterable<unknown> | ReadableStream, options?: { format?: "jsonl" | "array" }) {
+  const values: unknown[] = [];
+  for await (const value of Bun.JSONL.parseStream(source, options)) values.push(value);
+  return values;
+}
+
+// Splits `text` into chunks of `size` bytes, cutting through multi-byte characters.
+function chunked(text: string, size: number) {
+  const bytes = Buffer.from(text);
+  return new ReadableStream<Uint8Array>({
+    start(controller) {
+      for (let i = 0; i < bytes.length; i += size) controller.enqueue(bytes.subarray(i, i + size));
+      controller.close();
+    },
+  });
+}
+
+describe("Bun.JSONL.parseStream", () => {
+  const records = Array.from({ length: 500 }, (_, i) => ({
+    id: i,
+    name: `record ${i} é ${"\u{1F600}".repeat(i % 3)}`,
+    tags: i % 2 ? ["a", "b,c", "]"] : [],
+    nested: { text: 'with "quotes", \\backslashes\\ and [brackets]', depth: [[[i]]] },
+  }));
+
+  describe('format: "jsonl"', () => {
+    test("yields one value per line across chunk boundaries", async () => {
+      const text = records.map(r => JSON.stringify(r)).join("\n") + "\n";
+      for (const size of [1, 7, 64, 4096]) {
+        expect(await collect(chunked(text, size))).toEqual(records);
+      }
+    });
+
+    test("accepts strings and a final line without a newline", async () => {
+      async function* source() {
+        yield '{"a":1}\n{"b"';
+        yield ":2}\n3";
+      }
+      expect(await collect(source())).toEqual([{ a: 1 }, { b: 2 }, 3]);
+    });
+
+    test("rejects after the values before the error", async () => {
+      const values: unknown[] = [];
+      const iterate = async () => {
+        for await (const value of Bun.JSONL.parseStream(chunked('{"a":1}\n{bad}\n', 4))) values.push(value);
+      };
+      await expect(iterate()).rejects.toThrow(SyntaxError);
+      expect(values).toEqual([{ a: 1 }]);
+      await expect(collect(chunked('{"a":1}\n{"b":', 4))).rejects.toThrow(SyntaxError);
+    });
+
+    test("yields the values before a bad line in the same chunk, then rejects", async () => {
+      for (const text of ['{"a":1}\n{bad}\n', '{"a":1}\n{bad}']) {
+        const values: unknown[] = [];
+        const iterate = async () => {
+          for await (const value of Bun.JSONL.parseStream(chunked(text, text.length))) values.push(value);
+        };
+        await expect(iterate()).rejects.toThrow(SyntaxError);
+        expect(values).toEqual([{ a: 1 }]);
+      }
+    });
+
+    test("does not read Bun.JSONL.parseChunk at call time", async () => {
+      const { parseChunk } = Bun.JSONL;
+      (Bun.JSONL as any).parseChunk = () => {
+        throw new Error("user parseChunk was called");
+      };
+      try {
+        expect(await collect(chunked('{"a":1}\n{"b":2}\n', 5))).toEqual([{ a: 1 }, { b: 2 }]);
+      } finally {
+        (Bun.JSONL as any).parseChunk = parseChunk;
+      }
+    });
+  });
+
+  describe('format: "array"', () => {
+    test("yields the elements of a top-level array across chunk boundaries", async () => {
+      const text = JSON.stringify(records, null, 2);
+      for (const size of [1, 13, 64, 1000, 65536]) {
+        expect(await collect(chunked(text, size), { format: "array" })).toEqual(records);
+      }
+    });
+
+    test("handles scalars, empty arrays, whitespace and a BOM", async () => {
+      const text = ' [ 1 , "two" , null , true , -3.5e2 , {} , [] ] \n';
+      expect(await collect(chunked(text, 3), { format: "array" })).toEqual([1, "two", null, true, -350, {}, []]);
+      expect(await collect(chunked("[]", 1), { format: "array" })).toEqual([]);
+      expect(await collect(chunked("\uFEFF[1,2]", 1), { format: "array" })).toEqual([1, 2]);
+    });
+
+    test("yields elements before the stream ends", async () => {
+      let release!: () => void;
+      const blocked = new Promise<void>(resolve => (release = resolve));
+      const stream = new ReadableStream({
+        async pull(controller) {
+          // Input is indexed in 64-byte blocks, so pad past the last separator.
+          const head = JSON.stringify(records.slice(0, 100)).slice(0, -1) + "," + " ".repeat(64);
+          controller.enqueue(Buffer.from(head));
+          await blocked;
+          controller.enqueue(Buffer.from("1]"));
+          controller.close();
+        },
+      });
+      const iterator = Bun.JSONL.parseStream(stream, { format: "array" });
+      for (let i = 0; i < 100; i++) expect((await iterator.next()).value).toEqual(records[i]);
+      release();
+      expect((await iterator.next()).value).toBe(1);
+      expect((await iterator.next()).done).toBe(true);
+    });
+
+    test("rejects malformed arrays", async () => {
+      const malformed = [
+        '{"a":1}',
+        "[1,]",
+        "[1,,2]",
+        "[1 2]",
+        "[1}",
+        "[1]]",
+        "[1] 2",
+        "[1, 2",
+        '["abc',
+        "[1, // c\n2]",
+      ];
+      for (const text of malformed) {
+        await expect(collect(chunked(text, 2), { format: "array" })).rejects.toThrow(SyntaxError);
+      }
+    });
+
+    test("breaking out of the loop cancels the source", async () => {
+      let cancelled = false;
+      const stream = new ReadableStream({
+        pull(controller) {
+          controller.enqueue(Buffer.from("[" + "1,".repeat(1000)));
+        },
+        cancel() {
+          cancelled = true;
+        },
+      });
+      for await (const value of Bun.JSONL.parseStream(stream, { format: "array" })) {
+        expect(value).toBe(1);
+        break;
+      }
+      expect(cancelled).toBe(true);
+    });
+  });
+
+  test("validates its arguments", () => {
+    expect(() => Bun.JSONL.parseStream("[1]" as any)).toThrow(TypeError);
+    expect(() => Bun.JSONL.parseStream(chunked("", 1), { format: "csv" as any })).toThrow();
+  });
+});
@@ -2753,3 +2753,227 @@ it("exec/run with an embedded NUL byte in the SQL string does not hang", async (
     exitCode: 0,
   });
 });
+
+describe("columnar", () => {
+  function createDatabase() {
+    const db = new Database(":memory:");
+    db.run("CREATE TABLE t (id INTEGER, amount REAL, region TEXT, note TEXT, extra)");
+    const insert = db.prepare("INSERT INTO t VALUES (?, ?, ?, ?, ?)");
+    const regions = ["north", "south", "", "south"];
+    for (let i = 0; i < 10; i++) {
+      insert.run(i, i / 2, regions[i % regions.length], i % 3 === 0 ? null : "n" + i, i === 5 ? "five" : i);
+    }
+    return db;
+  }
+
+  it("returns one typed array per column", () => {
+    const db = createDatabase();
+    const { length, columns } = db.query("SELECT * FROM t ORDER BY id").columnar();
+    expect(length).toBe(10);
+    expect(columns.map(c => [c.name, c.type])).toEqual([
+      ["id", "integer"],
+      ["amount", "float"],
+      ["region", "text"],
+      ["note", "text"],
+      ["extra", "mixed"],
+    ]);
+
+    const [id, amount, region, note, extra] = columns;
+    expect(id.values).toBeInstanceOf(Float64Array);
+    expect(Array.from(id.values)).toEqual([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    expect(id.nulls).toBeUndefined();
+    expect(Array.from(amount.values)).toEqual([0, 0.5, 1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5]);
+
+    expect(region.values).toBeInstanceOf(Uint32Array);
+    expect(region.dictionary).toEqual(["north", "south", ""]);
+    expect(Array.from(region.values, i => region.dictionary[i])).toEqual(
+      db
+        .query("SELECT region FROM t ORDER BY id")
+        .values()
+        .map(r => r[0]),
+    );
+
+    expect(Array.from(note.nulls)).toEqual([1, 0, 0, 1, 0, 0, 1, 0, 0, 1]);
+    expect(Array.from(note.values, (i, row) => (note.nulls[row] ? null : note.dictionary[i]))).toEqual([
+      null,
+      "n1",
+      "n2",
+      null,
+      "n4",
+      "n5",
+      null,
+      "n7",
+      "n8",
+      null,
+    ]);
+
+    expect(extra.values).toEqual([0, 1, 2, 3, 4, "five", 6, 7, 8, 9]);
+  });
+
+  it("uses BigInt64Array with safeIntegers", () => {
+    const db = new Database(":memory:", { safeIntegers: true });
+    const { columns } = db.query("SELECT 9007199254740993 AS big, NULL AS nothing, x'0102' AS blob").columnar();
+    expect(columns[0].type).toBe("integer");
+    expect(columns[0].values).toBeInstanceOf(BigInt64Array);
+    expect(columns[0].values[0]).toBe(9007199254740993n);
+    expect(columns[1]).toEqual({ name: "nothing", type: "null", values: [null] });
+    expect(columns[2].type).toBe("mixed");
+    expect(columns[2].values[0]).toEqual(new Uint8Array([1, 2]));
+  });
+
+  it("binds parameters", () => {
+    const db = createDatabase();
+    const query = db.query("SELECT id FROM t WHERE id >= ? ORDER BY id");
+    expect(Array.from(query.columnar(7).columns[0].values)).toEqual([7, 8, 9]);
+    expect(Array.from(query.columnar([8]).columns[0].values)).toEqual([8, 9]);
+    const named = db.query("SELECT id FROM t WHERE id < $max ORDER BY id");
+    expect(Array.from(named.columnar({ $max: 2 }).columns[0].values)).toEqual([0, 1]);
+  });
+
+  it("returns an empty chunk when there are no rows", () => {
+    const db = createDatabase();
+    const { length, columns } = db.query("SELECT id, region FROM t WHERE id < 0").columnar();
+    expect(length).toBe(0);
+    expect(columns.map(c => c.values)).toEqual([[], []]);
+  });
+
+  it("columnarChunks steps the statement in chunks", () => {
+    const db = createDatabase();
+    const query = db.query("SELECT id, region FROM t WHERE id >= ? ORDER BY id");
+    const chunks = [...query.columnarChunks(4, 1)];
+    expect(chunks.map(c => c.length)).toEqual([4, 4, 1]);
+    expect(chunks.flatMap(c => Array.from(c.columns[0].values))).toEqual([1, 2, 3, 4, 5, 6, 7, 8, 9]);
+    // Dictionaries are per chunk.
+    expect(chunks[2].columns[1].dictionary).toEqual(["south"]);
+
+    expect([...query.columnarChunks(3, 1)].map(c => c.length)).toEqual([3, 3, 3]);
+    expect([...query.columnarChunks(3, 100)]).toEqual([]);
+    expect(() => [...query.columnarChunks(0)]).toThrow(RangeError);
+  });
+});
+
+describe("pool", () => {
+  function createDatabase(dir, options) {
+    const file = path.join(String(dir), "pool.sqlite");
+    const setup = new Database(file);
+    setup.exec("CREATE TABLE t (id INTEGER PRIMARY KEY, name TEXT, data BLOB)");
+    const insert = setup.prepare("INSERT INTO t (id, name, data) VALUES (?, ?, ?)");
+    for (let i = 0; i < 1000; i++) insert.run(i, "row " + i, i % 2 ? new Uint8Array([i & 0xff]) : null);
+    insert.finalize();
+    setup.close();
+    return new Database(file, options);
+  }
+
+  it("runs queries and resolves with rows", async () => {
+    using dir = tempDir("sqlite-pool", {});
+    using db = createDatabase(dir);
+    using pool = db.pool({ readers: 2 });
+
+    const rows = await pool.all("SELECT id, name, data FROM t ORDER BY id");
+    expect(rows).toHaveLength(1000);
+    expect(rows[0]).toEqual({ id: 0, name: "row 0", data: null });
+    expect(rows[999]).toEqual({ id: 999, name: "row 999", data: new Uint8Array([999 & 0xff]) });
+    expect(rows).toEqual(db.query("SELECT id, name, data FROM t ORDER BY id").all());
+
+    expect(await pool.get("SELECT name FROM t WHERE id = ?", 5)).toEqual({ name: "row 5" });
+    expect(await pool.get("SELECT name FROM t WHERE id = ?", [-1])).toBeNull();
+    expect(await pool.values("SELECT id, name FROM t WHERE id < 2 ORDER BY id")).toEqual([
+      [0, "row 0"],
+      [1, "row 1"],
+    ]);
+    expect(await pool.get("SELECT name FROM t WHERE id = $id", { $id: 7 })).toEqual({ name: "row 7" });
+  });
+
+  it("runs concurrent reads and serialized writes", async () => {
+    using dir = tempDir("sqlite-pool-concurrent", {});
+    using db = createDatabase(dir);
+    using pool = db.pool();
+
+    const writes = Array.from({ length: 20 }, (_, i) =>
+      pool.run("INSERT INTO t (id, name) VALUES (?, ?)", 1000 + i, "new"),
+    );
+    const reads = Array.from({ length: 20 }, () => pool.get("SELECT count(*) AS n FROM t"));
+    const results = await Promise.all([...writes, ...reads]);
+
+    expect(results.slice(0, 20).map(r => r.changes)).toEqual(Array(20).fill(1));
+    expect(results.slice(0, 20).map(r => r.lastInsertRowid)).toEqual(Array.from({ length: 20 }, (_, i) => 1000 + i));
+    for (const { n } of results.slice(20)) expect(n).toBeGreaterThanOrEqual(1000);
+    expect(db.query("SELECT count(*) AS n FROM t").get()).toEqual({ n: 1020 });
+    expect(db.query("PRAGMA journal_mode").get()).toEqual({ journal_mode: "wal" });
+  });
+
+  it("routes writing queries to the writer", async () => {
+    using dir = tempDir("sqlite-pool-returning", {});
+    using db = createDatabase(dir);
+    using pool = db.pool();
+
+    expect(await pool.all("INSERT INTO t (id, name) VALUES (?, ?) RETURNING id, name", 2000, "returned")).toEqual([
+      { id: 2000, name: "returned" },
+    ]);
+    expect(await pool.get("SELECT name FROM t WHERE id = 2000")).toEqual({ name: "returned" });
+  });
+
+  it("respects safeIntegers and strict", async () => {
+    using dir = tempDir("sqlite-pool-flags", {});
+    using db = createDatabase(dir, { safeIntegers: true, strict: true });
+    using pool = db.pool();
+
+    expect(await pool.get("SELECT id FROM t WHERE id = $id", { id: 3n })).toEqual({ id: 3n });
+    expect((await pool.run("UPDATE t SET name = 'x' WHERE id = $id", { id: 3 })).changes).toBe(1);
+    await expect(pool.get("SELECT id FROM t WHERE id = $id", {})).rejects.toThrow('Missing parameter "id"');
+  });
+
+  it("rejects with SQLiteError", async () => {
+    using dir = tempDir("sqlite-pool-errors", {});
+    using db = createDatabase(dir);
+    using pool = db.pool();
+
+    const error = await pool.all("SELECT * FROM missing").catch(e => e);
+    expect(error).toBeInstanceOf(SQLiteError);
+    expect(error.message).toBe("no such table: missing");
+    expect(error.code).toBe("SQLITE_ERROR");
+
+    const constraint = await pool.run("INSERT INTO t (id) VALUES (1)").catch(e => e);
+    expect(constraint).toBeInstanceOf(SQLiteError);
+    expect(constraint.code).toBe("SQLITE_CONSTRAINT_PRIMARYKEY");
+
+    // The pool keeps working after an error.
+    expect(await pool.get("SELECT count(*) AS n FROM t")).toEqual({ n: 1000 });
+  });
+
+  it("rejects writes on a readonly database", async () => {
+    using dir = tempDir("sqlite-pool-readonly", {});
+    createDatabase(dir).close();
+    using db = new Database(path.join(String(dir), "pool.sqlite"), { readonly: true });
+    using pool = db.pool();
+
+    expect(await pool.get("SELECT count(*) AS n FROM t")).toEqual({ n: 1000 });
+    await expect(pool.run("DELETE FROM t")).rejects.toThrow("Cannot write to a pool opened on a readonly database");
+    await expect(pool.all("DELETE FROM t RETURNING id")).rejects.toThrow("Cannot write to a pool opened on a readonly database");
+  });
+
+  it("rejects queries after close", async () => {
+    using dir = tempDir("sqlite-pool-close", {});
+    using db = createDatabase(dir);
+    const pool = db.pool();
+
+    const pending = pool.get("SELECT count(*) AS n FROM t");
+    pool.close();
+    expect(pool.closed).toBe(true);
+    expect(await pending).toEqual({ n: 1000 });
+    await expect(pool.all("SELECT 1")).rejects.toThrow("Database pool is closed");
+
+    const other = db.pool();
+    db.close();
+    expect(other.closed).toBe(true);
+  });
+
+  it("validates options", () => {
+    using dir = tempDir("sqlite-pool-options", {});
+    using db = createDatabase(dir);
+    expect(() => db.pool({ readers: 0 })).toThrow(RangeError);
+    expect(() => db.pool({ readers: 1.5 })).toThrow(RangeError);
+    expect(() => db.pool(1)).toThrow(TypeError);
+    expect(() => new Database(":memory:").pool()).toThrow("Cannot create a pool for an in-memory database.");
+  });
+});
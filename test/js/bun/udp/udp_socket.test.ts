@@ -643,3 +643,36 @@ test("sendMany() sends every packet of a larger-than-one-batch call", async () =
     server.close();
   }
 });
+
+// On Linux a run of same-size datagrams to one peer goes out as a single
+// UDP_SEGMENT send, and the receiver may get them back coalesced by UDP_GRO.
+// Either way each datagram must arrive whole and on its own.
+test("sendMany() delivers a run of equal-size datagrams and a shorter tail one by one", async () => {
+  const count = 64;
+  const size = 1200;
+  const payloads: Buffer[] = [];
+  for (let i = 0; i < count; i++) payloads.push(Buffer.alloc(size, i));
+  payloads.push(Buffer.alloc(333, 0xff));
+
+  const { promise, resolve } = Promise.withResolvers<{ data: Buffer; truncated: boolean }[]>();
+  const received: { data: Buffer; truncated: boolean }[] = [];
+  const server = await udpSocket({
+    binaryType: "buffer",
+    socket: {
+      data(_socket, data, _port, _address, flags) {
+        received.push({ data: Buffer.from(data), truncated: flags.truncated });
+        if (received.length === payloads.length) resolve(received);
+      },
+    },
+  });
+  const client = await udpSocket({ connect: { port: server.port, hostname: "127.0.0.1" } });
+  try {
+    expect(client.sendMany(payloads)).toBe(payloads.length);
+    const messages = await promise;
+    expect(messages.map(m => m.truncated)).toEqual(payloads.map(() => false));
+    expect(messages.map(m => m.data)).toEqual(payloads);
+  } finally {
+    client.close();
+    server.close();
+  }
+});
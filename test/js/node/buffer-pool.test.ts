@@ -0,0 +1,127 @@
+import { afterEach, expect, test } from "bun:test";
+
+const defaultPoolSize = Buffer.poolSize;
+afterEach(() => {
+  Buffer.poolSize = defaultPoolSize;
+});
+
+test("small allocUnsafe buffers are carved from one 8-byte aligned slab", () => {
+  // Changing the pool size starts a fresh slab.
+  Buffer.poolSize = 16 * 1024;
+  const a = Buffer.allocUnsafe(1500);
+  const b = Buffer.allocUnsafe(1500);
+  expect(a.buffer.byteLength).toBe(16 * 1024);
+  expect(a.byteOffset).toBe(0);
+  expect(b.buffer).toBe(a.buffer);
+  expect(b.byteOffset).toBe(1504);
+  expect(b.byteOffset % 8).toBe(0);
+
+  a.fill(1);
+  b.fill(2);
+  expect(a.every(x => x === 1)).toBe(true);
+  expect(b.every(x => x === 2)).toBe(true);
+});
+
+test("buffers from half the pool size up to 16 KiB share 64 KiB slabs", () => {
+  const buffers = Array.from({ length: 16 }, () => Buffer.allocUnsafe(Buffer.poolSize / 2));
+  buffers.push(Buffer.allocUnsafe(16 * 1024));
+  for (const buf of buffers) {
+    expect(buf.buffer.byteLength).toBe(64 * 1024);
+    expect(buf.byteOffset % 8).toBe(0);
+  }
+  // 16 * 4 KiB + 16 KiB spans at most three slabs.
+  expect(new Set(buffers.map(buf => buf.buffer)).size).toBeLessThanOrEqual(3);
+
+  const text = Buffer.alloc(10000, "abc").toString();
+  const encoded = Buffer.from(text);
+  expect(encoded.buffer.byteLength).toBe(64 * 1024);
+  expect(encoded.toString()).toBe(text);
+});
+
+test("tiny buffers and buffers over 16 KiB get their own allocation", () => {
+  for (const size of [16, 1000, 16 * 1024 + 1, 64 * 1024]) {
+    const buf = Buffer.allocUnsafe(size);
+    expect(buf.byteOffset).toBe(0);
+    expect(buf.buffer.byteLength).toBe(size);
+  }
+});
+
+test("Buffer.poolSize is read on every allocation", () => {
+  Buffer.poolSize = 32 * 1024;
+  const a = Buffer.allocUnsafe(12 * 1024);
+  expect(a.buffer.byteLength).toBe(32 * 1024);
+
+  Buffer.poolSize = 0;
+  expect(Buffer.allocUnsafe(1500).buffer.byteLength).toBe(1500);
+  expect(Buffer.allocUnsafe(8192).buffer.byteLength).toBe(8192);
+  expect(Buffer.from(Buffer.alloc(1500, "x").toString()).buffer.byteLength).toBe(1500);
+});
+
+test("Buffer.from(string) encodes into the pool", () => {
+  const ascii = Buffer.alloc(3000, "abc").toString();
+  const latin1 = Buffer.alloc(2400, "é").toString();
+  const wide = Buffer.alloc(1600, "\u{1F600}").toString();
+
+  const utf8 = Buffer.from(ascii);
+  expect(utf8.buffer.byteLength).toBe(Buffer.poolSize);
+  expect(utf8.toString()).toBe(ascii);
+
+  expect(Buffer.from(latin1).toString()).toBe(latin1);
+  expect(Buffer.from(latin1, "latin1").toString("latin1")).toBe(latin1);
+  expect(Buffer.from(wide).toString()).toBe(wide);
+  expect(Buffer.from(wide, "utf16le").toString("utf16le")).toBe(wide);
+  expect(Buffer.from(ascii, "hex").byteOffset).toBe(0);
+});
+
+test("transferring a pooled buffer's ArrayBuffer leaves its neighbours intact", () => {
+  Buffer.poolSize = 16 * 1024;
+  const a = Buffer.allocUnsafe(2000).fill(1);
+  const b = Buffer.allocUnsafe(2000).fill(2);
+  expect(b.buffer).toBe(a.buffer);
+
+  const moved = structuredClone(a.buffer, { transfer: [a.buffer] });
+  expect(moved.byteLength).toBe(a.buffer.byteLength);
+  expect(a.length).toBe(2000);
+  expect(b.every(x => x === 2)).toBe(true);
+});
+
+test("readable byte streams copy enqueued pooled buffers", async () => {
+  const a = Buffer.allocUnsafe(2000).fill(1);
+  const b = Buffer.allocUnsafe(2000).fill(2);
+  expect(b.buffer).toBe(a.buffer);
+
+  const stream = new ReadableStream({
+    type: "bytes",
+    start(controller) {
+      controller.enqueue(a);
+      controller.close();
+    },
+  });
+  const chunks = await Array.fromAsync(stream);
+  expect(Buffer.concat(chunks)).toEqual(Buffer.alloc(2000, 1));
+  expect(a.length).toBe(2000);
+  expect(b.every(x => x === 2)).toBe(true);
+});
+
+test("BYOB reads into a pooled buffer", async () => {
+  Buffer.poolSize = 32 * 1024;
+  const view = Buffer.allocUnsafe(8192);
+  const neighbour = Buffer.allocUnsafe(2000).fill(2);
+  expect(neighbour.buffer).toBe(view.buffer);
+
+  const stream = new ReadableStream({
+    type: "bytes",
+    pull(controller) {
+      const request = controller.byobRequest!;
+      request.view!.fill(7);
+      request.respond(request.view!.byteLength);
+      controller.close();
+    },
+  });
+  const { value, done } = await stream.getReader({ mode: "byob" }).read(view);
+  expect(done).toBe(false);
+  expect(value!.byteLength).toBe(8192);
+  expect(Buffer.from(value!.buffer, value!.byteOffset, value!.byteLength)).toEqual(Buffer.alloc(8192, 7));
+  expect(view.length).toBe(8192);
+  expect(neighbour.every(x => x === 2)).toBe(true);
+});
@@ -4191,3 +4191,39 @@ test("https 'clientError' for a connection whose handshake completes after close
     raw.destroy();
   }
 });
+
+test("each request sees its own headers when earlier handlers skipped them", async () => {
+  // Handlers that never read req.headers leave their captured header bytes to
+  // be reused; requests after them must still see exactly what they sent.
+  const seen: Record<string, unknown>[] = [];
+  const server = createServer((req, res) => {
+    const seq = Number(req.url!.slice(1));
+    if (seq % 3 === 0) {
+      seen.push({
+        seq,
+        value: req.headers["x-value"],
+        rawCount: req.rawHeaders.filter(h => h.toLowerCase() === "x-value").length,
+      });
+    }
+    res.end("ok");
+  });
+  await once(server.listen(0, "127.0.0.1"), "listening");
+  try {
+    const { port } = server.address() as AddressInfo;
+    for (let seq = 0; seq < 30; seq++) {
+      const res = await fetch(`http://127.0.0.1:${port}/${seq}`, {
+        headers: { "x-value": `${seq}:${"v".repeat((seq * 37) % 300)}` },
+      });
+      expect(await res.text()).toBe("ok");
+    }
+    expect(seen).toEqual(
+      Array.from({ length: 10 }, (_, i) => ({
+        seq: i * 3,
+        value: `${i * 3}:${"v".repeat((i * 3 * 37) % 300)}`,
+        rawCount: 1,
+      })),
+    );
+  } finally {
+    server.close();
+  }
+});
@@ -222,3 +222,91 @@ test("user options are forwarded through custom inspect", () => {
     "BroadcastChannel { name:\n   'hello',\n  active:\n   true }",
   );
 });
+
+test("same-context receivers of one message get their own object but share strings", async () => {
+  const sender = new BroadcastChannel("shared-snapshot");
+  const receivers = [new BroadcastChannel("shared-snapshot"), new BroadcastChannel("shared-snapshot")];
+  try {
+    const received = receivers.map(
+      channel =>
+        new Promise<any[]>(resolve => {
+          const data: any[] = [];
+          channel.onmessage = e => {
+            data.push(e.data);
+            if (data.length === 2) resolve(data);
+          };
+        }),
+    );
+    sender.postMessage({ key: "user:1" });
+    sender.postMessage("user:2");
+    const [first, second] = await Promise.all(received);
+    expect(first[0]).not.toBe(second[0]);
+    first[0].key = "changed";
+    expect(second[0]).toEqual({ key: "user:1" });
+    expect(first[1]).toBe("user:2");
+    expect(second[1]).toBe("user:2");
+  } finally {
+    sender.close();
+    for (const channel of receivers) channel.close();
+  }
+});
+
+test("a burst across channel names is delivered in post order", async () => {
+  const senders = [new BroadcastChannel("burst-a"), new BroadcastChannel("burst-b")];
+  const receivers = [new BroadcastChannel("burst-a"), new BroadcastChannel("burst-b"), new BroadcastChannel("burst-a")];
+  const count = 300;
+  const seen: string[] = [];
+  const { promise, resolve } = Promise.withResolvers<void>();
+  receivers.forEach((channel, i) => {
+    channel.onmessage = e => {
+      seen.push(`${i}:${e.data}`);
+      if (seen.length === count * 2 - count / 2) resolve();
+    };
+  });
+  try {
+    for (let i = 0; i < count; i++) senders[i % 2].postMessage(i);
+    await promise;
+    const expected: string[] = [];
+    for (let i = 0; i < count; i++) {
+      if (i % 2) expected.push(`1:${i}`);
+      else expected.push(`0:${i}`, `2:${i}`);
+    }
+    expect(seen).toEqual(expected);
+  } finally {
+    for (const channel of [...senders, ...receivers]) channel.close();
+  }
+});
+
+test("microtasks queued by onmessage run before the next message is dispatched", async () => {
+  const sender = new BroadcastChannel("microtask-checkpoint");
+  const receivers = [new BroadcastChannel("microtask-checkpoint"), new BroadcastChannel("microtask-checkpoint")];
+  const log: string[] = [];
+  const { promise, resolve } = Promise.withResolvers<void>();
+  receivers.forEach((channel, i) => {
+    channel.onmessage = e => {
+      log.push(`${i}:${e.data}`);
+      queueMicrotask(() => {
+        log.push(`${i}:${e.data} microtask`);
+        if (log.length === 8) resolve();
+      });
+    };
+  });
+  try {
+    sender.postMessage("first");
+    sender.postMessage("second");
+    await promise;
+    expect(log).toEqual([
+      "0:first",
+      "0:first microtask",
+      "1:first",
+      "1:first microtask",
+      "0:second",
+      "0:second microtask",
+      "1:second",
+      "1:second microtask",
+    ]);
+  } finally {
+    sender.close();
+    for (const channel of receivers) channel.close();
+  }
+});
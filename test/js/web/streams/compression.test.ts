@@ -435,6 +435,62 @@ describe("CompressionStream and DecompressionStream", () => {
       expect(out.byteLength).toBe(big.byteLength);
       expect(Buffer.compare(out, Buffer.from(big.buffer))).toBe(0);
     });
+
+    // Encoders split a large chunk into blocks the pool compresses in
+    // parallel (raw deflate blocks for the deflate formats, one frame per
+    // block for zstd), spliced between whatever the serial steps write.
+    describe("parallel blocks", () => {
+      function text(len: number, seed: number) {
+        let s = "";
+        for (let i = 0; s.length < len; i++) s += `line ${i} ${(i * seed) % 1000} ${"abcdefgh".repeat(i % 5)}\n`;
+        return Buffer.from(s.slice(0, len));
+      }
+
+      async function compress(format: "gzip" | "deflate" | "deflate-raw" | "zstd", chunks: Uint8Array[]) {
+        const cs = new CompressionStream(format);
+        const writer = cs.writable.getWriter();
+        const out = new Response(cs.readable).arrayBuffer();
+        for (const chunk of chunks) await writer.write(chunk);
+        await writer.close();
+        return Buffer.from(await out);
+      }
+
+      const decoders = {
+        "gzip": zlib.gunzipSync,
+        "deflate": zlib.inflateSync,
+        "deflate-raw": zlib.inflateRawSync,
+        "zstd": zlib.zstdDecompressSync,
+      } as const;
+
+      test.each(Object.keys(decoders) as (keyof typeof decoders)[])(
+        "%s: large chunks between small ones decode with a standard decoder",
+        async format => {
+          const chunks = [text(1000, 7), text(3 * 1024 * 1024, 31), text(5000, 13), text(2 * 1024 * 1024 + 17, 101)];
+          const compressed = await compress(format, chunks);
+          expect(decoders[format](compressed).equals(Buffer.concat(chunks))).toBe(true);
+
+          const ds = new DecompressionStream(format);
+          const roundTrip = Buffer.from(await new Response(new Blob([compressed]).stream().pipeThrough(ds)).arrayBuffer());
+          expect(roundTrip.equals(Buffer.concat(chunks))).toBe(true);
+        },
+      );
+
+      test.each(Object.keys(decoders) as (keyof typeof decoders)[])(
+        "%s: back-to-back large chunks and an empty flush",
+        async format => {
+          const chunks = [text(3 * 1024 * 1024, 3), text(3 * 1024 * 1024, 5)];
+          const compressed = await compress(format, chunks);
+          expect(decoders[format](compressed).equals(Buffer.concat(chunks))).toBe(true);
+        },
+      );
+
+      test("blocks keep the deflate window, so the ratio stays close to one stream's", async () => {
+        const input = text(4 * 1024 * 1024, 31);
+        const parallel = await compress("gzip", [input]);
+        expect(zlib.gunzipSync(parallel).equals(input)).toBe(true);
+        expect(parallel.byteLength).toBeLessThan(zlib.gzipSync(input).byteLength * 1.05);
+      });
+    });
   });
 });
 
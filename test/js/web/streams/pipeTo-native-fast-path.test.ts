@@ -0,0 +1,106 @@
+import { webStreamsInternals } from "bun:internal-for-testing";
+import { describe, expect, test } from "bun:test";
+import { tempDir } from "harness";
+import { join } from "node:path";
+import zlib from "node:zlib";
+
+// A pipe from a native source (Bun.file, Blob, fetch bodies) into a native transform's
+// writable writes each chunk as it is read, without the generic loop's deferred write.
+describe("pipeTo between native streams", () => {
+  const bytes = new Uint8Array(3 * 1024 * 1024 + 17);
+  for (let i = 0; i < bytes.length; i++) bytes[i] = (i * 31) ^ (i >> 11);
+
+  test("Bun.file() through an identity TransformStream", async () => {
+    using dir = tempDir("pipeto-native", {});
+    const path = join(String(dir), "data.bin");
+    await Bun.write(path, bytes);
+    const { readable, writable } = new TransformStream();
+    const [piped, out] = await Promise.all([
+      Bun.file(path).stream().pipeTo(writable),
+      new Response(readable).bytes(),
+    ]);
+    expect(piped).toBeUndefined();
+    expect(Buffer.from(out).equals(bytes)).toBe(true);
+  });
+
+  test("takes the native path only when neither end runs user JS", () => {
+    const { isNativePipe } = webStreamsInternals;
+    const native = () => new Blob([bytes]).stream();
+    const userSource = () => new ReadableStream({ pull: controller => controller.close() });
+    const userTransform = () => new TransformStream({ transform: (chunk, controller) => controller.enqueue(chunk) });
+
+    expect(isNativePipe(native(), new CompressionStream("gzip").writable)).toBe(true);
+    expect(isNativePipe(native(), new TransformStream().writable)).toBe(true);
+    expect(isNativePipe(new TextEncoderStream().readable, new CompressionStream("gzip").writable)).toBe(true);
+
+    expect(isNativePipe(userSource(), new CompressionStream("gzip").writable)).toBe(false);
+    expect(isNativePipe(native(), userTransform().writable)).toBe(false);
+    expect(isNativePipe(native(), new WritableStream())).toBe(false);
+    expect(isNativePipe(native(), new TransformStream({}, { size: () => 1 }).writable)).toBe(false);
+  });
+
+  test("Blob chunks into a CompressionStream", async () => {
+    const gzip = new CompressionStream("gzip");
+    const compressed = await new Response(new Blob([bytes]).stream().pipeThrough(gzip)).bytes();
+    expect(Buffer.from(zlib.gunzipSync(compressed)).equals(bytes)).toBe(true);
+  });
+
+  test("chained native transforms", async () => {
+    const text = "héllo wörld ".repeat(50_000);
+    const out = await new Response(
+      new Blob([text])
+        .stream()
+        .pipeThrough(new CompressionStream("deflate"))
+        .pipeThrough(new DecompressionStream("deflate"))
+        .pipeThrough(new TextDecoderStream()),
+    ).text();
+    expect(out).toBe(text);
+  });
+
+  test("preventClose leaves the destination writable", async () => {
+    const { readable, writable } = new TransformStream();
+    const collected = new Response(readable).text();
+    await new Blob(["abc"]).stream().pipeTo(writable, { preventClose: true });
+    const writer = writable.getWriter();
+    await writer.write(new TextEncoder().encode("def"));
+    await writer.close();
+    expect(await collected).toBe("abcdef");
+  });
+
+  test("an abort signal stops the pipe and cancels the source", async () => {
+    const controller = new AbortController();
+    const { readable, writable } = new TransformStream();
+    const source = new Blob([bytes]).stream();
+    const piped = source.pipeTo(writable, { signal: controller.signal });
+    const reader = readable.getReader();
+    const first = await reader.read();
+    expect(first.done).toBe(false);
+    controller.abort(new Error("stop"));
+    await expect(piped).rejects.toThrow("stop");
+    await expect(reader.read()).rejects.toThrow("stop");
+    expect(source.locked).toBe(false);
+  });
+
+  test("a destination error cancels the source", async () => {
+    const { readable, writable } = new TransformStream();
+    const source = new Blob([bytes]).stream();
+    const piped = source.pipeTo(writable);
+    await readable.cancel(new Error("gone"));
+    await expect(piped).rejects.toThrow("gone");
+  });
+
+  test("proxying a response body through a TransformStream", async () => {
+    using upstream = Bun.serve({ port: 0, fetch: () => new Response(bytes) });
+    using proxy = Bun.serve({
+      port: 0,
+      async fetch() {
+        const { readable, writable } = new TransformStream();
+        const res = await fetch(upstream.url);
+        res.body!.pipeTo(writable);
+        return new Response(readable);
+      },
+    });
+    const out = await (await fetch(proxy.url)).bytes();
+    expect(Buffer.from(out).equals(bytes)).toBe(true);
+  });
+});
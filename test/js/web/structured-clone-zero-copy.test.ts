@@ -0,0 +1,74 @@
+import { describe, expect, test } from "bun:test";
+
+// Strings and ArrayBuffers of 64 KiB or more bypass the wire buffer when the
+// value stays in this process. These cover the general (non-fast-path)
+// serializer, so every value is wrapped in something the fast paths reject.
+describe("structuredClone of large strings and buffers", () => {
+  const text = Buffer.alloc(256 * 1024, "abc").toString();
+  const wide = Buffer.alloc(128 * 1024, "é").toString("latin1") + "\u{1F600}";
+
+  test("large strings inside an object round-trip", () => {
+    const input = { nested: new Map([["text", text]]), wide, again: text };
+    const out = structuredClone(input);
+    expect(out.nested.get("text")).toBe(text);
+    expect(out.wide).toBe(wide);
+    expect(out.again).toBe(text);
+  });
+
+  test("a large ArrayBuffer is copied, not aliased", () => {
+    const buffer = new ArrayBuffer(1024 * 1024);
+    new Uint8Array(buffer).fill(7);
+    const view = new Uint8Array(buffer, 16, 32);
+    const out = structuredClone({ buffer, view, map: new Map() });
+
+    new Uint8Array(buffer).fill(1);
+    expect(out.buffer.byteLength).toBe(buffer.byteLength);
+    expect(new Uint8Array(out.buffer).every(b => b === 7)).toBe(true);
+    expect(out.view.buffer).toBe(out.buffer);
+    expect(out.view.byteOffset).toBe(16);
+    expect(out.view.length).toBe(32);
+  });
+
+  test("a large Buffer survives a round-trip through a worker", async () => {
+    const worker = new Worker(
+      URL.createObjectURL(
+        new Blob([`self.onmessage = ({ data }) => postMessage(data);`], { type: "application/javascript" }),
+      ),
+    );
+    try {
+      const payload = { text, bytes: Buffer.alloc(512 * 1024, "xyz"), list: [new Set()] };
+      const { promise, resolve, reject } = Promise.withResolvers<MessageEvent>();
+      worker.onmessage = resolve;
+      worker.onerror = reject;
+      worker.postMessage(payload);
+      const { data } = await promise;
+      expect(data.text).toBe(text);
+      expect(Buffer.from(data.bytes).equals(payload.bytes)).toBe(true);
+    } finally {
+      worker.terminate();
+    }
+  });
+
+  test("every BroadcastChannel receiver gets its own intact copy", async () => {
+    const name = "structured-clone-zero-copy";
+    const sender = new BroadcastChannel(name);
+    const receivers = [new BroadcastChannel(name), new BroadcastChannel(name)];
+    try {
+      const received = Promise.all(
+        receivers.map(channel => new Promise<any>(resolve => (channel.onmessage = ({ data }) => resolve(data)))),
+      );
+      const buffer = new Uint8Array(256 * 1024).fill(3).buffer;
+      sender.postMessage({ buffer, text, tag: new Set([1]) });
+
+      const [first, second] = await received;
+      expect(first.buffer).not.toBe(second.buffer);
+      new Uint8Array(first.buffer).fill(0);
+      expect(new Uint8Array(second.buffer).every(b => b === 3)).toBe(true);
+      expect(first.text).toBe(text);
+      expect(second.text).toBe(text);
+    } finally {
+      sender.close();
+      for (const channel of receivers) channel.close();
+    }
+  });
+});
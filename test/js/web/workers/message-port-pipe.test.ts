@@ -363,6 +363,58 @@ describe("MessagePort pipe", () => {
     expect(stdout.trim()).toBe("OK");
     expect(exitCode).toBe(0);
   });
+
+  test("lock-free sends stay in order around messages that carry transfers", async () => {
+    await using proc = Bun.spawn({
+      cmd: [
+        bunExe(),
+        "-e",
+        `
+          const { Worker, MessageChannel } = require("worker_threads");
+          const { port1, port2 } = new MessageChannel();
+          const w = new Worker(
+            \`
+              const { parentPort, MessageChannel } = require("worker_threads");
+              parentPort.once("message", ({ port }) => {
+                for (let i = 0; i < 3000; i++) {
+                  if (i % 97 === 0) {
+                    const extra = new MessageChannel().port1;
+                    port.postMessage({ i, extra }, [extra]);
+                  } else {
+                    port.postMessage({ i });
+                  }
+                }
+                port.postMessage("end");
+              });
+            \`,
+            { eval: true },
+          );
+          w.postMessage({ port: port2 }, [port2]);
+          let next = 0;
+          port1.on("message", v => {
+            if (v === "end") {
+              if (next !== 3000) { console.error("got", next); process.exit(1); }
+              console.log("OK");
+              port1.close();
+              w.terminate();
+              return;
+            }
+            if (v.i !== next) { console.error("out of order", v.i, next); process.exit(1); }
+            if ((next % 97 === 0) !== !!v.extra) { console.error("transfer mismatch", next); process.exit(1); }
+            v.extra?.close();
+            next++;
+          });
+        `,
+      ],
+      env: bunEnv,
+      stdout: "pipe",
+      stderr: "pipe",
+    });
+    const [stdout, stderr, exitCode] = await Promise.all([proc.stdout.text(), proc.stderr.text(), proc.exited]);
+    expect(stderr).toBe("");
+    expect(stdout.trim()).toBe("OK");
+    expect(exitCode).toBe(0);
+  });
 });
 
 // worker.postMessage / parentPort.postMessage go through the same coalesced
@@ -0,0 +1,116 @@
+import { describe, expect, test } from "bun:test";
+
+describe("Bun.SharedRing", () => {
+  test("round-trips strings and bytes in order on one thread", () => {
+    const ring = new Bun.SharedRing(100);
+    expect(ring.capacity).toBe(128);
+    expect(ring.read()).toBeUndefined();
+
+    expect(ring.write("héllo")).toBe(true);
+    expect(ring.write(new Uint16Array([1, 2]))).toBe(true);
+    expect(ring.read()).toBe("héllo");
+    const bytes = ring.read() as Uint8Array;
+    expect(bytes).toBeInstanceOf(Uint8Array);
+    expect(bytes.buffer).toBe(ring.buffer);
+    expect([...new Uint16Array(bytes.slice().buffer)]).toEqual([1, 2]);
+    expect(ring.read()).toBeUndefined();
+  });
+
+  test("wraps around without splitting a message", () => {
+    const ring = new Bun.SharedRing(64);
+    for (let i = 0; i < 100; i++) {
+      const message = Buffer.alloc(5 + (i % 20), i);
+      expect(ring.write(message)).toBe(true);
+      expect(Buffer.from(ring.read() as Uint8Array).equals(message)).toBe(true);
+      expect(ring.read()).toBeUndefined();
+    }
+  });
+
+  test("write reports a full ring and rejects messages that can never fit", () => {
+    const ring = new Bun.SharedRing(64);
+    expect(ring.write("x".repeat(28))).toBe(true);
+    expect(ring.write("y".repeat(28))).toBe(true);
+    expect(ring.write("z")).toBe(false);
+    expect(() => ring.write("x".repeat(29))).toThrow();
+    expect(ring.read()).toBe("x".repeat(28));
+    expect(ring.write("z")).toBe(true);
+  });
+
+  test("a binary view stays valid until the next read", () => {
+    const ring = new Bun.SharedRing(64);
+    ring.write(new Uint8Array(28).fill(1));
+    ring.write(new Uint8Array(28).fill(2));
+    const view = ring.read() as Uint8Array;
+    expect(ring.write(new Uint8Array(28).fill(3))).toBe(false);
+    expect(view.every(b => b === 1)).toBe(true);
+    expect((ring.read() as Uint8Array).every(b => b === 2)).toBe(true);
+    expect(ring.write(new Uint8Array(28).fill(3))).toBe(true);
+  });
+
+  test("rejects buffers that are not a ring", () => {
+    expect(() => new Bun.SharedRing(new SharedArrayBuffer(1024))).toThrow();
+    expect(() => new Bun.SharedRing(0)).toThrow();
+  });
+
+  test("close drains pending messages, then ends iteration and fails writes", async () => {
+    const ring = new Bun.SharedRing(1024);
+    ring.write("a");
+    ring.write("b");
+    ring.close();
+    expect(ring.closed).toBe(true);
+    expect(() => ring.write("c")).toThrow();
+    const received: unknown[] = [];
+    for await (const message of ring) received.push(message);
+    expect(received).toEqual(["a", "b"]);
+  });
+
+  test("streams to a worker with backpressure", async () => {
+    const ring = new Bun.SharedRing(4096);
+    const results = new Bun.SharedRing(1024);
+    const worker = new Worker(
+      URL.createObjectURL(
+        new Blob(
+          [
+            `self.onmessage = async ({ data }) => {
+              const input = new Bun.SharedRing(data.input);
+              const output = new Bun.SharedRing(data.output);
+              let count = 0, sum = 0;
+              for await (const message of input) {
+                count++;
+                sum += typeof message === "string" ? Number(message) : message[message.length - 1];
+              }
+              await output.writeAsync(count + ":" + sum);
+            };`,
+          ],
+          { type: "application/javascript" },
+        ),
+      ),
+    );
+    try {
+      ring.closeWith(worker);
+      worker.postMessage({ input: ring.buffer, output: results.buffer });
+
+      const count = 20_000;
+      let sum = 0;
+      for (let i = 0; i < count; i++) {
+        const message = i % 2 ? String(i % 100) : new Uint8Array(1 + (i % 300)).fill(i % 100);
+        sum += i % 100;
+        await ring.writeAsync(message);
+      }
+      ring.close();
+      expect(await results.readAsync()).toBe(`${count}:${sum}`);
+    } finally {
+      worker.terminate();
+    }
+  });
+
+  test("closeWith wakes a reader parked on a worker that exits", async () => {
+    const ring = new Bun.SharedRing(1024);
+    const worker = new Worker(
+      URL.createObjectURL(new Blob(["process.exit(0)"], { type: "application/javascript" })),
+    );
+    ring.closeWith(worker);
+    expect(await ring.readAsync()).toBeUndefined();
+    expect(ring.closed).toBe(true);
+  });
+});